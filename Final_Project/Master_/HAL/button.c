@@ -118,3 +118,21 @@ void BUTTONS_initPortF(void) {
     GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, GPIO_PIN_0 | GPIO_PIN_4);
     GPIOPadConfigSet(GPIO_PORTF_BASE, GPIO_PIN_0 | GPIO_PIN_4, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
 }
+
+/***********************************************
+ * Function Name: BUTTONS_enableInterrupt
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Registers `BUTTONS_handler` for Port F and enables a falling-edge
+ *              (press) interrupt on PF0 and PF4. Must be called after
+ *              BUTTONS_initPortF. Contact bounce may raise several interrupts
+ *              per press; the handler only signals the reader.
+ ***********************************************/
+void BUTTONS_enableInterrupt(void) {
+    GPIOIntRegister(GPIO_PORTF_BASE, BUTTONS_handler);   // Register Port F interrupt handler
+    GPIOIntTypeSet(GPIO_PORTF_BASE, GPIO_PIN_0 | GPIO_PIN_4, GPIO_FALLING_EDGE);
+    GPIOIntClear(GPIO_PORTF_BASE, GPIO_PIN_0 | GPIO_PIN_4);
+    GPIOIntEnable(GPIO_PORTF_BASE, GPIO_PIN_0 | GPIO_PIN_4);
+}
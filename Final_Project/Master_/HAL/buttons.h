@@ -40,5 +40,7 @@ void BUTTONS_initPortF(void);
 bool BUTTONS_rightButton(void);
 bool BUTTONS_leftButton(void);
 bool HAL_voidButtons(uint32_t Button);
+void BUTTONS_enableInterrupt(void);
+void BUTTONS_handler(void);
 
 #endif /* BUTTONS_H_ */
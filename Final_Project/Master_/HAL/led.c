@@ -148,7 +148,7 @@ void LED_initPortF(void) {
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
  * Description: Controls the red LED to blink with a 1-second ON and 1-second
- *              OFF interval. Utilizes the TIMER0_delayMs function for delays.
+ *              OFF interval, paced by HAL_voidLedBlink from the SysTick count.
  ***********************************************/
 void LED_redBlink(void)
 {
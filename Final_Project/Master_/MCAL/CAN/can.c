@@ -1,11 +1,54 @@
 #include "CAN.h"
 #include "CAN_config.h"
 #include <MCAL/Timers/TIMER0/timer0.h>
+#include "OS/trace.h"
+#include "OS/spsc.h"
+#include "OS/timebase.h"
+
+
+// Received frames, pushed by CAN_handler and popped by the task calling CAN_Receive
+static CAN_Frame_t g_stCanRxFrames[CAN_RX_RING_LEN];
+static SpscRing g_stCanRxRing;
+static volatile uint32_t g_ui32CanRxReceived = 0;
+static volatile uint32_t g_ui32CanRxOverruns = 0;
+static void (*g_ptrCanRxHook)(const CAN_Frame_t *frame) = 0;   // Called by CAN_handler for each checked frame
+
+// Receive FIFOs, one per group of CAN_RX_FIFO_TABLE
+#define CAN_RX_FIFO_ENTRY(id, mask, depth)      {(id), (mask), (depth)},
+#define CAN_RX_FIFO_DEPTH(id, mask, depth)      + (depth)
+#if (0 CAN_RX_FIFO_TABLE(CAN_RX_FIFO_DEPTH)) > 16
+#error "CAN_RX_FIFO_TABLE needs more than the 16 receive message objects"
+#endif
+static const CAN_RxFifoConfig_t g_stCanRxFifos[] = {
+    CAN_RX_FIFO_TABLE(CAN_RX_FIFO_ENTRY)
+};
+
+// Frames waiting for a mailbox, sorted in bus order (CAN_TxBefore), and the frame loaded in each mailbox.
+// Shared by CAN_Send and CAN_handler; accessed with interrupts masked.
+static CAN_Frame_t g_stCanTxQueue[CAN_TX_QUEUE_LEN];
+static CAN_Frame_t g_stCanTxMailbox[CAN_TX_MAILBOXES];
+static uint32_t g_ui32CanTxQueued = 0;
+static uint32_t g_ui32CanTxLoaded = 0;
+static uint32_t g_ui32CanTxBusy = 0;      // Bit i set while mailbox i holds a frame not yet confirmed
+static uint64_t g_ui64CanTxLatencySum = 0;
+static CAN_TxStats_t g_stCanTxStats;
+
+// Network description (can_db.h), and the alive counters of its sealed messages: the next one to send (written
+// with interrupts masked) and the last one received (written by the task calling CAN_Receive)
+const CAN_DbMessage_t g_stCanDbMessages[CAN_DB_MESSAGE_COUNT] = {
+    CAN_DB_MESSAGE_TABLE(CAN_DB_MESSAGE_ENTRY)
+};
+#define CAN_DB_ALIVE_NONE       0xFFU     // No frame received yet; never equal to a 4-bit counter
+static uint8_t g_ui8CanDbTxAlive[CAN_DB_MESSAGE_COUNT];
+static uint8_t g_ui8CanDbRxAlive[CAN_DB_MESSAGE_COUNT];
+static uint32_t g_ui32CanRxRejected = 0;
 
 
 
 // Function to initialize the CAN peripheral
 void CAN_Init(void) {
+    uint32_t i = 0;
+
     // Enable the CAN module and the GPIO port based on the selected CAN module
     SysCtlPeripheralEnable(CAN_SYSCTL_PERIPH);
     SysCtlPeripheralEnable(CAN_GPIO_PORT_BASE);
@@ -27,8 +70,19 @@ void CAN_Init(void) {
 
 
 
+    // The ring and the TX queue must be empty before CAN_handler can use them; CANInit has emptied the mailboxes
+    OS_voidSpscInit(&g_stCanRxRing, g_stCanRxFrames, sizeof(CAN_Frame_t), CAN_RX_RING_LEN);
+    g_ui32CanTxQueued = 0;
+    g_ui32CanTxLoaded = 0;
+    g_ui32CanTxBusy = 0;
+    for (i = 0; i < CAN_DB_MESSAGE_COUNT; i++) {
+        g_ui8CanDbTxAlive[i] = 0;
+        g_ui8CanDbRxAlive[i] = CAN_DB_ALIVE_NONE;
+    }
+
     // Enable CAN interrupts if configured
     #if CAN_INTERRUPT_MODE == CAN_INT_ENABLE
+        CANIntRegister(CAN_BASE, CAN_handler);  // Register CAN interrupt handler
         CANIntEnable(CAN_BASE, CAN_INT_FLAGS);
         IntEnable(CAN_INT);
     #endif
@@ -38,24 +92,307 @@ void CAN_Init(void) {
     CANEnable(CAN_BASE);
 }
 
-// Function to send data via CAN
-void CAN_SendMessage(uint32_t messageID , uint32_t msgObjectID , uint8_t *data, uint8_t dataLength) {
+// Returns true if frame a goes on the bus before frame b: lower identifier first (CAN priority), and among equal
+// identifiers the earlier CAN_Send first
+static bool CAN_TxBefore(const CAN_Frame_t *a, const CAN_Frame_t *b) {
+    return (a->id < b->id) || ((a->id == b->id) && (a->timestamp < b->timestamp));
+}
+
+// Function to insert a frame into the TX queue in bus order; the caller checks that there is room
+static void CAN_TxInsert(const CAN_Frame_t *frame) {
+    uint32_t i = g_ui32CanTxQueued;
+
+    while ((i > 0U) && CAN_TxBefore(frame, &g_stCanTxQueue[i - 1U])) {
+        g_stCanTxQueue[i] = g_stCanTxQueue[i - 1U];
+        i--;
+    }
+    g_stCanTxQueue[i] = *frame;
+    g_ui32CanTxQueued++;
+}
+
+// Function to move the head of the TX queue into a mailbox and request its transmission
+static void CAN_TxLoad(uint32_t mailbox) {
     tCANMsgObject messageObject;
+    CAN_Frame_t *ptrFrame = &g_stCanTxMailbox[mailbox];
+    uint32_t i = 0;
+
+    *ptrFrame = g_stCanTxQueue[0];
+    g_ui32CanTxQueued--;
+    for (i = 0; i < g_ui32CanTxQueued; i++) {
+        g_stCanTxQueue[i] = g_stCanTxQueue[i + 1U];
+    }
+    ptrFrame->object = (uint8_t)(CAN_TX_FIRST_OBJ + mailbox);
+
+    messageObject.ui32MsgID = ptrFrame->id;
+    messageObject.ui32MsgIDMask = 0; // No filtering for transmission
+    messageObject.ui32Flags = MSG_OBJ_TX_INT_ENABLE; // TXOK interrupt confirms the frame
+    messageObject.ui32MsgLen = ptrFrame->length;
+    messageObject.pui8MsgData = ptrFrame->data;
+    CANMessageSet(CAN_BASE, ptrFrame->object, &messageObject, MSG_OBJ_TYPE_TX);
+    OS_voidTraceRecord(OS_TRACE_CAN_TX, ptrFrame->object, (uint16_t)ptrFrame->id);
+
+    g_ui32CanTxBusy |= (1UL << mailbox);
+    g_ui32CanTxLoaded++;
+}
+
+// Function to give the mailbox to the head of the TX queue and put its frame back into the queue. Fails once the
+// controller has started sending that frame (it clears NEWDAT when it copies the object to the shift register): the
+// frame is left to complete. A frame whose transmission starts between the check and the clear is sent twice; the
+// state frames sent here are idempotent.
+static bool CAN_TxSwap(uint32_t mailbox) {
+    CAN_Frame_t stTaken;
+    uint32_t ui32Object = CAN_TX_FIRST_OBJ + mailbox;
+
+    if ((CANStatusGet(CAN_BASE, CAN_STS_NEWDAT) & (1UL << (ui32Object - 1U))) == 0U) {
+        return false;
+    }
+    CANMessageClear(CAN_BASE, ui32Object);
+    stTaken = g_stCanTxMailbox[mailbox];
+    g_ui32CanTxBusy &= ~(1UL << mailbox);
+    g_ui32CanTxLoaded--;
+
+    // Load first: it frees the queue entry the taken frame goes back into
+    CAN_TxLoad(mailbox);
+    CAN_TxInsert(&stTaken);
+    g_stCanTxStats.requeued++;
+    return true;
+}
+
+// Function to load queued frames into free mailboxes, with interrupts masked.
+// The controller sends the pending mailbox with the lowest object number first, whatever the identifiers, so the
+// mailboxes are kept in bus order: a frame goes into a free mailbox above every busy one that must go before it and
+// below every busy one that must go after it. When there is no such mailbox the head takes the mailbox of the first
+// frame that must go after it, which returns to the queue; if that one is already on the bus the head waits for the
+// next TXOK.
+static void CAN_TxRefill(void) {
+    uint32_t i = 0;
+    uint32_t ui32Lowest = 0;    // Lowest mailbox the head may use
+    uint32_t ui32After = 0;     // First busy mailbox holding a frame that goes after the head
+
+    while (g_ui32CanTxQueued != 0U) {
+        ui32Lowest = 0;
+        ui32After = CAN_TX_MAILBOXES;
+        for (i = 0; i < CAN_TX_MAILBOXES; i++) {
+            if ((g_ui32CanTxBusy & (1UL << i)) == 0U) {
+                continue;
+            }
+            if (CAN_TxBefore(&g_stCanTxMailbox[i], &g_stCanTxQueue[0])) {
+                ui32Lowest = i + 1U;
+            } else if (ui32After == CAN_TX_MAILBOXES) {
+                ui32After = i;
+            }
+        }
+
+        for (i = ui32Lowest; i < ui32After; i++) {
+            if ((g_ui32CanTxBusy & (1UL << i)) == 0U) {
+                break;
+            }
+        }
+
+        if (i < ui32After) {
+            CAN_TxLoad(i);
+        } else if ((ui32After == CAN_TX_MAILBOXES) || !CAN_TxSwap(ui32After)) {
+            break;
+        }
+    }
+}
+
+// Function to find the description of a message in can_db.h; 0 if the identifier is not described there
+const CAN_DbMessage_t *CAN_FindMessage(uint32_t messageID) {
+    uint32_t i = 0;
+
+    for (i = 0; i < CAN_DB_MESSAGE_COUNT; i++) {
+        if (g_stCanDbMessages[i].id == messageID) {
+            return &g_stCanDbMessages[i];
+        }
+    }
+    return 0;
+}
+
+// Function to compute the CRC-8 (SAE J1850: polynomial 0x1D, initial and final XOR 0xFF) of a sealed frame over the
+// two bytes of its identifier, then its first length data bytes
+static uint8_t CAN_Crc8(uint32_t messageID, const uint8_t *data, uint32_t length) {
+    uint8_t ui8Crc = 0xFF;
+    uint8_t ui8Byte = 0;
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    for (i = 0; i < (length + 2U); i++) {
+        ui8Byte = (i == 0U) ? (uint8_t)messageID : ((i == 1U) ? (uint8_t)(messageID >> 8) : data[i - 2U]);
+        ui8Crc ^= ui8Byte;
+        for (j = 0; j < 8U; j++) {
+            ui8Crc = (ui8Crc & 0x80U) ? (uint8_t)((ui8Crc << 1) ^ 0x1DU) : (uint8_t)(ui8Crc << 1);
+        }
+    }
+    return (uint8_t)(ui8Crc ^ 0xFFU);
+}
+
+// Function to write the alive counter and the checksum of a sealed frame (see can_db.h); the counter of the
+// message advances once per frame queued
+static void CAN_Seal(CAN_Frame_t *frame, uint32_t index) {
+    CAN_PackBits(frame->data, ((frame->length - 2U) * 8U) + 4U, 4U, g_ui8CanDbTxAlive[index]);
+    g_ui8CanDbTxAlive[index] = (uint8_t)((g_ui8CanDbTxAlive[index] + 1U) & 0x0FU);
+    frame->data[frame->length - 1U] = CAN_Crc8(frame->id, frame->data, frame->length - 1U);
+}
+
+// Function to check a received frame against its description: the described length, then for a sealed message the
+// checksum. A frame of length 0 is a remote request and carries nothing to check, as does an undescribed identifier.
+// Keeps no state, so CAN_handler can check a frame before it is queued.
+static bool CAN_CheckFrame(const CAN_Frame_t *frame, const CAN_DbMessage_t *ptrMessage) {
+    if ((ptrMessage == 0) || (frame->length == 0U)) {
+        return true;
+    }
+    if (frame->length != ptrMessage->dlc) {
+        return false;
+    }
+    if (ptrMessage->protection != CAN_DB_SEALED) {
+        return true;
+    }
+    return (CAN_Crc8(frame->id, frame->data, frame->length - 1U) == frame->data[frame->length - 1U]);
+}
+
+// Function to accept a received frame: CAN_CheckFrame, then for a sealed message an alive counter that differs from
+// the previous frame's (a repeated one means the sender is stuck).
+static bool CAN_Accept(const CAN_Frame_t *frame) {
+    const CAN_DbMessage_t *ptrMessage = CAN_FindMessage(frame->id);
+    uint32_t ui32Index = 0;
+    uint8_t ui8Alive = 0;
+
+    if (!CAN_CheckFrame(frame, ptrMessage)) {
+        return false;
+    }
+    if ((ptrMessage == 0) || (frame->length == 0U) || (ptrMessage->protection != CAN_DB_SEALED)) {
+        return true;
+    }
+
+    ui32Index = (uint32_t)(ptrMessage - g_stCanDbMessages);
+    ui8Alive = (uint8_t)CAN_UnpackBits(frame->data, ((frame->length - 2U) * 8U) + 4U, 4U);
+    if (ui8Alive == g_ui8CanDbRxAlive[ui32Index]) {
+        return false;
+    }
+    g_ui8CanDbRxAlive[ui32Index] = ui8Alive;
+    return true;
+}
+
+// Function to queue a frame for transmission; false if the TX queue is full and the frame was dropped.
+// The frame is copied, so the caller's buffer may be reused at once. A frame of a sealed message gets its alive
+// counter and checksum here; the caller leaves those bytes to CAN_Send.
+bool CAN_Send(uint32_t messageID, const uint8_t *data, uint8_t dataLength) {
+    const CAN_DbMessage_t *ptrMessage = CAN_FindMessage(messageID);
+    CAN_Frame_t stFrame;
+    uint32_t i = 0;
+    uint32_t ui32Depth = 0;
+    bool boolQueued = false;
+    bool boolMasked = false;
 
     // Ensure the length is valid
     if (dataLength > 8) {
         dataLength = 8; // CAN data payload cannot exceed 8 bytes
     }
 
-    // Set up the message object for transmission
-    messageObject.ui32MsgID = messageID;
-    messageObject.ui32MsgIDMask = 0; // No filtering for transmission
-    messageObject.ui32Flags = MSG_OBJ_TX_INT_ENABLE; // Enable TX interrupt
-    messageObject.ui32MsgLen = dataLength;
-    messageObject.pui8MsgData = data;
+    stFrame.id = messageID;
+    stFrame.length = dataLength;
+    stFrame.object = 0;
+    for (i = 0; i < dataLength; i++) {
+        stFrame.data[i] = data[i];
+    }
 
-    // Send the message
-    CANMessageSet(CAN_BASE, msgObjectID, &messageObject, MSG_OBJ_TYPE_TX);
+    // The queue, the mailboxes and the IF1 registers are shared with CAN_handler and with deferred jobs that send
+    boolMasked = IntMasterDisable();
+    stFrame.timestamp = OS_ui64TimeCycles();
+    if (g_ui32CanTxQueued < CAN_TX_QUEUE_LEN) {
+        if ((ptrMessage != 0) && (ptrMessage->protection == CAN_DB_SEALED) && (dataLength >= 2U)) {
+            CAN_Seal(&stFrame, (uint32_t)(ptrMessage - g_stCanDbMessages));
+        }
+        CAN_TxInsert(&stFrame);
+        CAN_TxRefill();
+        ui32Depth = g_ui32CanTxQueued + g_ui32CanTxLoaded;
+        if (ui32Depth > g_stCanTxStats.maxDepth) {
+            g_stCanTxStats.maxDepth = ui32Depth;
+        }
+        boolQueued = true;
+    } else {
+        g_stCanTxStats.dropped++;
+    }
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
+
+    return boolQueued;
+}
+
+// Function to request a frame from its sender with a remote frame sent from CAN_REMOTE_OBJ. The object stays
+// configured as in CAN_ConfigureReceiveObjects, so the reply is received there and raises an interrupt. The IF1
+// registers are shared with CAN_handler, so interrupts are masked as in CAN_Send.
+void CAN_SendRemote(uint32_t messageID) {
+    tCANMsgObject msgObject;
+    bool boolMasked = false;
+
+    msgObject.ui32MsgID = messageID;
+    msgObject.ui32MsgIDMask = 0x7FF;
+    msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER | MSG_OBJ_REMOTE_FRAME;
+    msgObject.ui32MsgLen = 0; // No data for a remote request
+    msgObject.pui8MsgData = 0;
+
+    boolMasked = IntMasterDisable();
+    CANMessageSet(CAN_BASE, CAN_REMOTE_OBJ, &msgObject, MSG_OBJ_TYPE_TX_REMOTE);
+    OS_voidTraceRecord(OS_TRACE_CAN_TX, CAN_REMOTE_OBJ, (uint16_t)messageID);
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
+}
+
+// Function to retire the mailboxes whose frame has been sent and refill them from the TX queue. Called from
+// CAN_handler on message object interrupts; returns the number of frames confirmed.
+uint32_t CAN_ServiceTransmitObjects(void) {
+    uint32_t ui32Done = 0;
+    uint32_t ui32Latency = 0;
+    uint32_t ui32Count = 0;
+    uint32_t i = 0;
+    uint64_t ui64Now = 0;
+    bool boolMasked = false;
+
+    boolMasked = IntMasterDisable();
+
+    // A mailbox is done once the controller has cleared its transmit request after the TXOK
+    ui32Done = g_ui32CanTxBusy & ~(CANStatusGet(CAN_BASE, CAN_STS_TXREQUEST) >> (CAN_TX_FIRST_OBJ - 1U));
+    if (ui32Done != 0U) {
+        ui64Now = OS_ui64TimeCycles();
+        for (i = 0; i < CAN_TX_MAILBOXES; i++) {
+            if ((ui32Done & (1UL << i)) == 0U) {
+                continue;
+            }
+            ui32Latency = (uint32_t)(ui64Now - g_stCanTxMailbox[i].timestamp);
+            if (ui32Latency > g_stCanTxStats.maxLatencyCycles) {
+                g_stCanTxStats.maxLatencyCycles = ui32Latency;
+            }
+            g_ui64CanTxLatencySum += ui32Latency;
+            ui32Count++;
+        }
+        g_ui32CanTxBusy &= ~ui32Done;
+        g_ui32CanTxLoaded -= ui32Count;
+        g_stCanTxStats.sent += ui32Count;
+        CAN_TxRefill();
+    }
+
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
+
+    return ui32Count;
+}
+
+// Function to read the transmit statistics
+void CAN_GetTxStats(CAN_TxStats_t *stats) {
+    bool boolMasked = IntMasterDisable();
+
+    *stats = g_stCanTxStats;
+    stats->depth = g_ui32CanTxQueued + g_ui32CanTxLoaded;
+    stats->meanLatencyCycles = (g_stCanTxStats.sent != 0U) ? (uint32_t)(g_ui64CanTxLatencySum / g_stCanTxStats.sent)
+                                                            : 0U;
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
 }
 
 // Function to initialize CAN for receiving messages
@@ -74,33 +411,114 @@ void CAN_ReceiveInit(void) {
 
 void CAN_ConfigureReceiveObjects(void) {
     tCANMsgObject msgObject;
+    uint32_t ui32Object = MSG_OBJ_RX_1;
+    uint32_t ui32Group = 0;
+    uint32_t i = 0;
 
-//    // Message Object 1: Keep-alive messages (ID 0x101)
-//    msgObject.ui32MsgID = CAN_KEEP_ALIVE_ID;
-//    msgObject.ui32MsgIDMask = CAN_RX_MESSAGE_MASK; // Match exact ID
-//    msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER;
-//    msgObject.ui32MsgLen = CAN_DATA_LENGTH; // Maximum CAN data length
-//    CANMessageSet(CAN_BASE, CAN_KEEP_ALIVE_OBJ, &msgObject, MSG_OBJ_TYPE_RX);
-
-    // Message Object 2: Temperature data (ID 0x102)
-    msgObject.ui32MsgID = CAN_TEMP_ID;
-    msgObject.ui32MsgIDMask = CAN_RX_MESSAGE_MASK; // Match exact ID
-    msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER;
-    msgObject.ui32MsgLen = CAN_DATA_LENGTH;
-    CANMessageSet(CAN_BASE, CAN_TEMP_OBJ, &msgObject, MSG_OBJ_TYPE_RX);
-
-    // Message Object 3: Diagnostic queries (ID range 0x2000x2FF)
-    msgObject.ui32MsgID = 0x200;
-    msgObject.ui32MsgIDMask = CAN_RX_MESSAGE_MASK; // Match range 0x2000x2FF
-    msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER;
-    msgObject.ui32MsgLen = CAN_DATA_LENGTH;
-    CANMessageSet(CAN_BASE, 3, &msgObject, MSG_OBJ_TYPE_RX);
+    // One FIFO per group: consecutive objects with the same filter, all but the last flagged MSG_OBJ_FIFO. The
+    // controller stores a frame in the lowest object of the FIFO without unread data; once all hold one, the last
+    // object is overwritten and reports MSG_OBJ_DATA_LOST.
+    for (ui32Group = 0; ui32Group < (sizeof(g_stCanRxFifos) / sizeof(g_stCanRxFifos[0])); ui32Group++) {
+        for (i = 0; i < g_stCanRxFifos[ui32Group].depth; i++) {
+            msgObject.ui32MsgID = g_stCanRxFifos[ui32Group].id;
+            msgObject.ui32MsgIDMask = g_stCanRxFifos[ui32Group].mask;
+            msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER;
+            if (i < (g_stCanRxFifos[ui32Group].depth - 1U)) {
+                msgObject.ui32Flags |= MSG_OBJ_FIFO;
+            }
+            msgObject.ui32MsgLen = CAN_DATA_LENGTH;
+            CANMessageSet(CAN_BASE, ui32Object, &msgObject, MSG_OBJ_TYPE_RX);
+            ui32Object++;
+        }
+    }
 
-    // Message Object 4: Diagnostic queries (ID range 0x2000x2FF)
-    msgObject.ui32MsgID = CAN_REMOTE_ID;
-    msgObject.ui32MsgIDMask = CAN_RX_MESSAGE_MASK; // Match range 0x2000x2FF
+    // Message Object 4: Reply to the remote frame of OS_voidECU1SendRemoteFrame (ID 0x104). Exact match: it comes
+    // before the FIFOs and must not take their frames
+    msgObject.ui32MsgID = CAN_ID_VOLTAGE;
+    msgObject.ui32MsgIDMask = 0x7FF;
     msgObject.ui32Flags = MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER | MSG_OBJ_REMOTE_FRAME;
     msgObject.ui32MsgLen = CAN_DATA_LENGTH;
     CANMessageSet(CAN_BASE, CAN_REMOTE_OBJ, &msgObject, MSG_OBJ_TYPE_RX);
 }
 
+// Function to read every message object holding a new frame into the RX ring, until none is left. Called from
+// CAN_handler only (the ring has a single producer); returns the number of frames read.
+// Each pass reads the objects from the lowest, which is the order a FIFO fills in. A frame stored while a pass runs
+// waits for the next pass; under a sustained burst this can put it behind a later frame that reused a lower object.
+// Each frame that passes CAN_CheckFrame is also shown to the hook of CAN_SetReceiveHook.
+uint32_t CAN_DrainReceiveObjects(void) {
+    CAN_Frame_t stFrame;
+    tCANMsgObject messageObject;
+    uint32_t ui32NewData = 0;
+    uint32_t ui32Object = 1;
+    uint32_t ui32Count = 0;
+
+    messageObject.pui8MsgData = stFrame.data;
+    while (1) {
+        // A transmit object also shows NEWDAT until its frame is sent; leave those alone
+        ui32NewData = ~CANStatusGet(CAN_BASE, CAN_STS_TXREQUEST);
+        ui32NewData &= CANStatusGet(CAN_BASE, CAN_STS_NEWDAT);
+        if (ui32NewData == 0U) {
+            break;
+        }
+
+        for (ui32Object = 1; ui32NewData != 0; ui32NewData >>= 1, ui32Object++) {
+            if ((ui32NewData & 1U) == 0U) {
+                continue;
+            }
+
+            // Reading the object also clears its NEWDAT, MSGLST and pending interrupt
+            CANMessageGet(CAN_BASE, ui32Object, &messageObject, true);
+            if ((messageObject.ui32Flags & MSG_OBJ_NEW_DATA) == 0U) {
+                continue;   // A transmit object that finished sending in between
+            }
+            if (messageObject.ui32Flags & MSG_OBJ_DATA_LOST) {
+                g_ui32CanRxOverruns++;
+            }
+
+            stFrame.timestamp = OS_ui64TimeCycles();
+            stFrame.id = messageObject.ui32MsgID;
+            stFrame.length = (uint8_t)((messageObject.ui32MsgLen > 8U) ? 8U : messageObject.ui32MsgLen);
+            stFrame.object = (uint8_t)ui32Object;
+            OS_voidTraceRecord(OS_TRACE_CAN_RX, (uint8_t)ui32Object, (uint16_t)messageObject.ui32MsgID);
+
+            // A full ring refuses the frame and counts it in g_stCanRxRing.dropped
+            (void)OS_boolSpscPush(&g_stCanRxRing, &stFrame);
+            g_ui32CanRxReceived++;
+            ui32Count++;
+
+            if ((g_ptrCanRxHook != 0) && CAN_CheckFrame(&stFrame, CAN_FindMessage(stFrame.id))) {
+                g_ptrCanRxHook(&stFrame);
+            }
+        }
+    }
+
+    return ui32Count;
+}
+
+// Function to install the function CAN_DrainReceiveObjects calls, in CAN_handler, for every frame of the described
+// length and checksum (0 removes it). The alive counter is checked later by CAN_Receive, so the hook may see a
+// repeated frame: it must be short and react the same way to the same frame twice.
+void CAN_SetReceiveHook(void (*hook)(const CAN_Frame_t *frame)) {
+    g_ptrCanRxHook = hook;
+}
+
+// Function to take the oldest received frame that passes CAN_Accept; false if none is waiting. One task consumes
+// the ring.
+bool CAN_Receive(CAN_Frame_t *frame) {
+    while (OS_boolSpscPop(&g_stCanRxRing, frame)) {
+        if (CAN_Accept(frame)) {
+            return true;
+        }
+        g_ui32CanRxRejected++;
+    }
+    return false;
+}
+
+// Function to read the receive counters. Each counter is read atomically, the set is not a single snapshot.
+void CAN_GetRxCounters(CAN_RxCounters_t *counters) {
+    counters->received = g_ui32CanRxReceived;
+    counters->overruns = g_ui32CanRxOverruns;
+    counters->dropped = g_stCanRxRing.dropped;
+    counters->rejected = g_ui32CanRxRejected;
+}
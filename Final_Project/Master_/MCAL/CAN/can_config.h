@@ -81,7 +81,7 @@
  *      CAN_INT_ENABLE               // Enable CAN Interrupts
  *      CAN_INT_DISABLE              // Disable CAN Interrupts
  */
-#define CAN_INTERRUPT_MODE          CAN_INT_DISABLE
+#define CAN_INTERRUPT_MODE          CAN_INT_ENABLE
 
 /**
  * CAN Interrupt Flags:
@@ -89,7 +89,9 @@
  *      CAN_INT_ERROR                // Enable error interrupt
  *      CAN_INT_STATUS               // Enable status interrupt
  */
-#define CAN_INT_FLAGS               (CAN_INT_MASTER | CAN_INT_ERROR | CAN_INT_STATUS)
+// Message object and error (bus-off / error warning change) interrupts only: status interrupts on every frame
+// would make CAN_handler read (and clear) the TXOK/RXOK bits that the heartbeat tasks poll
+#define CAN_INT_FLAGS               (CAN_INT_MASTER | CAN_INT_ERROR)
 
 /**
  * Options for Message Filtering:
@@ -148,4 +150,37 @@
  */
 #define CAN_DATA_LENGTH              CAN_DATA_LEN_8
 
+/**
+ * RX Ring Length:
+ *      Frames CAN_handler can queue for CAN_Receive; a power of two.
+ *      A full ring drops the new frame and counts it in CAN_RxCounters_t.dropped.
+ */
+#define CAN_RX_RING_LEN              16U
+
+/**
+ * RX FIFO Groups:
+ *      X(id, mask, depth)           // One hardware FIFO of depth chained message objects, receiving the data
+ *                                   // frames whose identifier matches id on the bits set in mask
+ *      The FIFOs take consecutive message objects from MSG_OBJ_RX_1 in table order, 16 objects in all. A frame
+ *      matching several groups goes to the first one; a frame matching none is not received.
+ */
+#define CAN_RX_FIFO_TABLE(X) \
+    X(0x100U, 0x700U, 8U)    /* Operational frames 0x100-0x1FF */ \
+    X(0x200U, 0x700U, 4U)    /* Diagnostic queries 0x200-0x2FF */
+
+/**
+ * Transmit Mailboxes:
+ *      CAN_Send loads frames into message objects CAN_TX_FIRST_OBJ .. CAN_TX_FIRST_OBJ + CAN_TX_MAILBOXES - 1.
+ *      They must not overlap the receive FIFOs or CAN_REMOTE_OBJ.
+ */
+#define CAN_TX_FIRST_OBJ             MSG_OBJ_TX_5
+#define CAN_TX_MAILBOXES             12U
+
+/**
+ * TX Queue Length:
+ *      Frames CAN_Send can hold while every mailbox is busy. A full queue refuses the frame and counts it in
+ *      CAN_TxStats_t.dropped.
+ */
+#define CAN_TX_QUEUE_LEN             16U
+
 #endif /* CAN_CONFIG_H_ */
@@ -21,6 +21,8 @@
 #define CMD_TEST_GPIO_ECU2              '4'
 #define CMD_TEST_GPIO_ECU1              '5'
 #define CMD_EXIT_MODE   '6'  // Exit Tester Mode
+#define CMD_TASK_STATS  '7'  // Dump per-task timing statistics
+#define CMD_TRACE_DUMP  '8'  // Export the trace buffer as Chrome trace-event JSON
 
 static uint32_t OS_ui8OverheatDTCCounter;
 static uint32_t g_DTC;
@@ -33,7 +35,10 @@ extern bool OS_boolCommunicationDTCFlag;
 #define EEPROM_BUTTON_COUNTER_ADDR  0x300  // EEPROM address for the button counter
 #define EEPROM_COMM_COUNTER_ADDR    0x400  // EEPROM address for the button counter
 #define EEPROM_COMM_DTC_ADDR        0x500  // Offset for DTC
+#define EEPROM_WDGM_RECORD_ADDR     0x600  // Watchdog manager supervision failure record (4 words)
+
 #define MOTOR_OVERHEAT_TIME            3   // Overheat time in seconds
+#define NVM_FAULT_LED_US               2000000U   // Blue LED fault indication of checkFaultFlag, in us
 
 // Threshold for entering fail-safe state
 #define ERROR_THRESHOLD 3
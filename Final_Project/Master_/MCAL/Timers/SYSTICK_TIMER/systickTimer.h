@@ -30,7 +30,7 @@
 /***********************************************
  * Type Declarations (enums, structs and unions)
  ***********************************************/
-volatile uint32_t g_ui32SysTickCount ;
+extern volatile uint32_t g_ui32SysTickCount;    // System tick, written by SYSTICK_handler only
 
 // Define SysTick time interval options in milliseconds
 #define SYSTICK_INTERVAL_1MS     1       // 1 ms interval
@@ -45,11 +45,17 @@ volatile uint32_t g_ui32SysTickCount ;
 #define SYSTICK_INTERRUPT_ENABLE  1  // Enable SysTick interrupts
 #define SYSTICK_INTERRUPT_DISABLE 0  // Disable SysTick interrupts
 
+// SysTick counter range (24-bit), bounds the tickless sleep length
+#define SYSTICK_MAX_RELOAD        0x01000000U
+
 /***********************************************
  * Functions Prototypes
  ***********************************************/
 void SYSTICK_init(void);
 void SYSTICK_handler(void);
+uint32_t SYSTICK_ui32TickCycles(void);
+uint32_t SYSTICK_ui32ElapsedTicks(void);
+uint32_t SYSTICK_ui32Sleep(uint32_t a_ui32Ticks);
 
 
 #endif /* SYSTICKTIMER_H_ */
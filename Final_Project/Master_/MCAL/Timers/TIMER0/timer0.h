@@ -3,9 +3,10 @@
  *
  *  Created on: 22 Nov 2024
  *      Author: Team: 4
- *      purpose: 1) Provide function prototypes for initializing Timer0 and creating delays in milliseconds.
+ *      purpose: 1) Provide function prototypes for initializing Timer0 and starting asynchronous one-shot delays.
  *               2) Abstract hardware-specific details, offering a clean, modular interface.
- *               3) Enable reuse of Timer0 functionality in other parts of the program without needing to deal with low-level register manipulations.
+ *               3) Multiplex up to TIMER_ONE_SHOT_SLOTS outstanding delays onto the single Timer0A
+ *                  counter, so a delay never holds up the scheduler loop.
  */
 
 #ifndef TIMER0_H_
@@ -21,6 +22,13 @@
 #include "inc/hw_types.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/timer.h"
+#include "driverlib/interrupt.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TIMER_ONE_SHOT_SLOTS        8U      // One-shot delays that can be outstanding at the same time
 
 
 /***********************************************
@@ -33,7 +41,8 @@ volatile uint32_t g_ui32timer1Count;
  * Functions Prototypes
  ***********************************************/
 void TIMER0_init(void);
-void TIMER0_delayMs(uint32_t a_uint32delayMs);
+bool TIMER0_startOneShot(uint32_t a_ui32DelayUs, void (*a_ptrCallback)(void *), void *a_ptrContext);
+void TIMER0_handler(void);
 
 
 #endif
@@ -14,8 +14,16 @@
  ***********************************************/
 #include <MCAL/UART/uart.h>
 #include "MCAL/UART/uart_config.h"
+#include "MCAL/Timers/TIMER0/timer0.h"
+#include "OS/spsc.h"
 
 
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static uint8_t g_ui8UartTxBuffer[UART_TX_RING_LEN];
+static SpscRing g_stUartTxRing;         // Characters written by the tasks, sent by the transmit interrupt
+
 
 /***********************************************
  * Functions Definitions
@@ -34,6 +42,9 @@
  ***********************************************/
 void UART_Init(void) {
 
+    // The TX ring must be empty before the first message
+    OS_voidSpscInit(&g_stUartTxRing, g_ui8UartTxBuffer, sizeof(g_ui8UartTxBuffer[0]), UART_TX_RING_LEN);
+
     SysCtlClockSet(SYSCTL_SYSDIV_4 | SYSCTL_USE_PLL | SYSCTL_XTAL_16MHZ | SYSCTL_OSC_MAIN);
     // Enable the UART module and associated GPIO port
     SysCtlPeripheralEnable(UART_SYSCTL_PERIPH);
@@ -92,6 +103,30 @@ void UART_Init(void) {
 
 }
 
+/***********************************************
+ * Function Name: UART0_voidSendStart
+ * Inputs: void *a_ptrContext - Unused
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Timer0 one-shot callback started by UART0_init. Sends the initial message ("start") once; its seven
+ *              characters fit in the empty TX FIFO, so the interrupt handler does not wait on the line.
+ ***********************************************/
+static void UART0_voidSendStart(void *a_ptrContext)
+{
+    (void)a_ptrContext;
+
+    // Send an initial message only once
+    if (!initialMessageSent)
+    {
+        // Send a message to PuTTY
+        UART0_sendMessage("start\r\n");
+
+        // Set initialMessageSent to true to avoid sending the message repeatedly
+        initialMessageSent = true;
+    }
+}
+
 void UART0_init(void) {
 
     // Set the clock for the system (50MHz)
@@ -119,21 +154,33 @@ void UART0_init(void) {
     // Turn off the Red LED initially
     GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_1, 0);
 
-    // Delay to allow UART initialization
-    SysCtlDelay(SysCtlClockGet() / 3);
-
     // Set a flag to indicate whether the initial message has been sent
     initialMessageSent = false;
-    // Send an initial message only once
-    if (!initialMessageSent)
-    {
-        // Send a message to PuTTY
-        UART0_sendMessage("start\r\n");
 
-        // Set initialMessageSent to true to avoid sending the message repeatedly
-        initialMessageSent = true;
-    }
+    // Send the initial message after UART_START_DELAY_US without waiting here (needs TIMER0_init)
+    (void)TIMER0_startOneShot(UART_START_DELAY_US, UART0_voidSendStart, 0);
+
+}
+
+/***********************************************
+ * Function Name: UART_PrimeTransmit
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Fills the TX FIFO from the TX ring with interrupts masked, so the writer and UART_handler do not
+ *              take characters from the ring at the same time. The transmit interrupt only fires when the FIFO
+ *              drains past its trigger level, so the first characters of a message have to be loaded here.
+ ***********************************************/
+static void UART_PrimeTransmit(void)
+{
+    bool boolMasked = IntMasterDisable();
+
+    UART_ServiceTransmit();
 
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
 }
 
 /***********************************************
@@ -141,16 +188,22 @@ void UART0_init(void) {
  * Inputs: const char *array_ptr - A pointer to a null-terminated string to be transmitted over UART.
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
- * Synchronous: Synch
- * Description: Sends each character of the input string (`array_ptr`) one by one over the UART0 interface. The function transmits the
- *              string by iterating through each character and using the `UARTCharPut` function to transmit each character to the UART0
- *              base until the null-terminator is reached.
+ * Synchronous: Asynch
+ * Description: Queues each character of the input string (`array_ptr`) in the TX ring and starts the transmission;
+ *              the transmit interrupt sends the rest at the line rate. The function only waits while the ring is
+ *              full, so a task that checks UART_ui32TxFree before writing never waits. Call from task context
+ *              only: the tasks are the single producer of the ring.
  ***********************************************/
 void UART_SendMessage(const char *message) {
     while (*message) {
-        UARTCharPut(UART_BASE, *message);  // Send character
+        // A full ring waits for the transmit interrupt (or the FIFO, before it is enabled) to make room
+        while (UART_ui32TxFree() == 0U) {
+            UART_PrimeTransmit();
+        }
+        (void)OS_boolSpscPush(&g_stUartTxRing, message);  // Queue character
         message++;
     }
+    UART_PrimeTransmit();
 }
 
 void UART0_sendMessage(const char *array_ptr)
@@ -162,7 +215,7 @@ void UART0_sendMessage(const char *array_ptr)
     }
 }
 
-void UART_SendNumber(uint8_t number) {
+void UART_SendNumber(uint32_t number) {
     char buffer[12];  // Buffer to hold the string representation of the number (max 10 digits + sign + null terminator)
     int index = 0;
     int i = 0;
@@ -190,3 +243,70 @@ void UART_SendNumber(uint8_t number) {
     UART_SendMessage(buffer);  // Assuming UART_SendMessage is your function to send strings
 }
 
+
+/***********************************************
+ * Function Name: UART_EnableRxInterrupt
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Registers `UART_handler` and enables the receive and receive-timeout interrupts, so a single
+ *              received character raises an interrupt (after 32 bit periods of line idle) even though the FIFO
+ *              trigger level is not reached. The handler moves the characters from the FIFO into the receive ring
+ *              of the tester task, so the FIFO cannot overflow while the task waits for its next release.
+ ***********************************************/
+void UART_EnableRxInterrupt(void)
+{
+    UARTIntRegister(UART_BASE, UART_handler);   // Register UART interrupt handler
+    UARTIntClear(UART_BASE, UART_INT_RX | UART_INT_RT);
+    UARTIntEnable(UART_BASE, UART_INT_RX | UART_INT_RT);
+}
+
+/***********************************************
+ * Function Name: UART_EnableTxInterrupt
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Enables the transmit interrupt, raised when the TX FIFO drains to half full, and loads the
+ *              characters queued so far. Call after UART_EnableRxInterrupt, which registers `UART_handler`.
+ ***********************************************/
+void UART_EnableTxInterrupt(void)
+{
+    UARTFIFOLevelSet(UART_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTTxIntModeSet(UART_BASE, UART_TXINT_MODE_FIFO);
+    UARTIntClear(UART_BASE, UART_INT_TX);
+    UARTIntEnable(UART_BASE, UART_INT_TX);
+    UART_PrimeTransmit();
+}
+
+/***********************************************
+ * Function Name: UART_ServiceTransmit
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Moves characters from the TX ring into the TX FIFO until the FIFO is full or the ring is empty.
+ *              Called from `UART_handler` on the transmit interrupt; the writers call it with interrupts masked.
+ ***********************************************/
+void UART_ServiceTransmit(void)
+{
+    uint8_t ui8Char = 0;
+
+    while (UARTSpaceAvail(UART_BASE) && OS_boolSpscPop(&g_stUartTxRing, &ui8Char)) {
+        UARTCharPutNonBlocking(UART_BASE, ui8Char);
+    }
+}
+
+/***********************************************
+ * Function Name: UART_ui32TxFree
+ * Inputs: N/A
+ * Outputs: uint32_t - Characters UART_SendMessage can queue without waiting
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Only grows until the caller writes, since the transmit interrupt only removes characters.
+ ***********************************************/
+uint32_t UART_ui32TxFree(void)
+{
+    return UART_TX_RING_LEN - OS_ui32SpscCount(&g_stUartTxRing);
+}
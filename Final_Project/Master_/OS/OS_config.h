@@ -7,6 +7,7 @@
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
 #include "OS/scheduler.h"
+#include "OS/dispatcher.h"
 
 
 #define configUSE_LEDS                       1
@@ -18,23 +19,54 @@
 #define configUSE_SYSTICK_TIMER              1
 #define configUSE_UART                       1
 #define configUSE_EEPROM                     1
+#define configUSE_TICKLESS_IDLE              1       // Sleep in WFI until the next task release
+#define configUSE_WATCHDOG                   1       // Alive supervision of the tasks, serviced by the watchdog manager
+#define configUSE_TRACE                      1       // Record the trace buffer from start-up (tester command 8 dumps it)
 
-typedef enum {
-    TASK_READY,
-    TASK_WAITING,
-    TASK_RUNNING
-} TaskState;
-
-typedef struct {
-    void (*taskFunction)(void);
-    uint32_t periodTicks;
-    uint32_t lastRunTick;
-    uint8_t priority;
-    TaskState state;
-    uint8_t isEnabled;           // Task enabled/disabled
-} TaskControlBlock;
+#define OS_WDGM_WINDOW_TICKS                 2000U   // Supervision window (ticks)
+
+#define OS_LOAD_SAMPLE_TICKS                 100U    // CPU load sample window (ticks), period of OS_voidReportCpuLoad
+#define OS_LOAD_SAMPLES_PER_REPORT           10U     // Samples per report: the peak covers one second
+#define OS_LOAD_SMOOTHING_SHIFT              3U      // Smoothed load averages about 2^shift samples
+#define OS_LOAD_CALIBRATION_RUNS             8U      // Idle scheduler passes timed at start-up
 
 #define MAX_TASKS 10
-TaskControlBlock taskList[MAX_TASKS];
+#if MAX_TASKS > OS_MAX_TASK_SLOTS
+#error "MAX_TASKS exceeds the capacity of the dispatcher ready bitmap"
+#endif
+
+/**
+ * Task table: X(function, periodTicks, offsetTicks, priority, eventMask, aliveMin)
+ *      periodTicks  // Raster class (1-2-5 series, 1 ms .. 1000 ms)
+ *      offsetTicks  // Phase within the period; chosen so that no two releases share a tick
+ *                   // (tester on 0 mod 20, tester output on 3 mod 20, COM on 5 mod 10, the others on distinct odd
+ *                   // ticks mod 200 that are not 5 mod 10 or 3 mod 20)
+ *      priority     // Dispatch rank, 1 = highest, unique and contiguous from 1
+ *      eventMask    // Events that also release the task (tester input and CAN reception run on their interrupt)
+ *      aliveMin     // Runs required per OS_WDGM_WINDOW_TICKS window: half of the periodic releases, so a task is
+ *                   // only reported when it hangs or is starved, not when a few releases were missed. No task writes
+ *                   // more than a line of UART output per run: the long tester reports are printed by the lowest
+ *                   // priority OS_voidTesterOutput, one line at a time and only into free space of the TX ring
+ */
+#define OS_TASK_TABLE(X) \
+    X(OS_voidTesterMode,                  20,   0,  1, OS_EVENT_UART_RX | OS_EVENT_BUTTON, 50) \
+    X(OS_voidCheckDTC,                    200,  7,  2, 0,                                  5) \
+    X(OS_voidComMainFunction,             OS_COM_PERIOD_TICKS, 5, 3, 0,                    100) \
+    X(OS_voidCANHandleReceivedMessages,   200,  11, 4, OS_EVENT_CAN_RX,                    5) \
+    X(OS_voidCheckOverheat,               200,  13, 5, 0,                                  5) \
+    X(OS_voidHeartbeatError,              200,  17, 6, 0,                                  5) \
+    X(APP_voidUartControl,                1000, 31, 7, 0,                                  1) \
+    X(OS_voidReportCpuLoad,               OS_LOAD_SAMPLE_TICKS, 37, 8, 0,                  10) \
+    X(OS_voidTesterOutput,                20,   3,  9, 0,                                  50)
+
+#define OS_TASK_COUNT                       OS_TASK_TABLE_COUNT(OS_TASK_TABLE)
+
+/**
+ * Blocking term of the schedulability check: the longest section the scheduler loop runs outside the dispatched
+ * tasks, annotated because it is not measured. The timer callbacks only update LEDs, flags and timers; EEPROMProgram
+ * and UART_SendMessage are only called from tasks and are part of their measured execution time (the one exception,
+ * the watchdog failure record, is written by a deferred job on the way to a reset).
+ */
+#define OS_RTA_BLOCKING_US                  10U     // Longest timer callback (LED and flag updates), in microseconds
 
-#endif /* CAN_CONFIG_H_ */
+#endif /* OS_CONFIG_H_ */
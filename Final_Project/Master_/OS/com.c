@@ -0,0 +1,270 @@
+/*
+ * com.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the transmission manager. Each message of the CAN database
+ *      keeps its latest payload and a deadline on the system tick; a write compares the payload with the previous one
+ *      and sends at once when the mode and the gap allow, and the periodic main function sends what has fallen due
+ *      (cycles, burst frames and changes held back by the gap).
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/com.h"
+#include "OS/periodic.h"
+#include "MCAL/Timers/SYSTICK_TIMER/systickTimer.h"
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint8_t data[8];        // Latest payload written, sealed bytes cleared
+    uint32_t deadline;      // Next cyclic or burst frame (CYCLIC, MIXED)
+    uint32_t lastSent;      // Tick of the last frame
+    uint32_t changeTick;    // Tick of the change not yet sent
+    uint8_t burstLeft;      // Burst frames still to send (MIXED)
+    bool isWritten;         // A payload has been written; the message is active
+    bool hasSent;           // lastSent is valid
+    bool isPending;         // A change waits for its first frame
+    ComStats stats;
+} ComMessage;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static ComMessage OS_stComMessages[CAN_DB_MESSAGE_COUNT];
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidComTransmit
+ * Inputs: uint32_t a_ui32Index - Message (CAN_DB_INDEX_<message>)
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Queues the latest payload and accounts for it: the frame carries any pending change, and it uses up
+ *              one frame of a burst. The deadline is left to the caller.
+ ***********************************************/
+static void OS_voidComTransmit(uint32_t a_ui32Index, uint32_t a_ui32Now)
+{
+    const CAN_DbMessage_t *ptrMessage = &g_stCanDbMessages[a_ui32Index];
+    ComMessage *ptrCom = &OS_stComMessages[a_ui32Index];
+
+    (void)CAN_Send(ptrMessage->id, ptrCom->data, ptrMessage->dlc);
+    ptrCom->stats.sent++;
+    ptrCom->lastSent = a_ui32Now;
+    ptrCom->hasSent = true;
+    if (ptrCom->isPending) {
+        if ((a_ui32Now - ptrCom->changeTick) > ptrCom->stats.maxDelayTicks) {
+            ptrCom->stats.maxDelayTicks = a_ui32Now - ptrCom->changeTick;
+        }
+        ptrCom->isPending = false;
+    }
+    if (ptrCom->burstLeft != 0U) {
+        ptrCom->burstLeft--;
+    }
+}
+
+/***********************************************
+ * Function Name: OS_boolComGapOver
+ * Inputs: uint32_t a_ui32Index - Message (CAN_DB_INDEX_<message>)
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: bool - true if gapMs has passed since the last frame, or none was sent yet
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static bool OS_boolComGapOver(uint32_t a_ui32Index, uint32_t a_ui32Now)
+{
+    const ComMessage *ptrCom = &OS_stComMessages[a_ui32Index];
+
+    return (!ptrCom->hasSent || ((a_ui32Now - ptrCom->lastSent) >= g_stCanDbMessages[a_ui32Index].gapMs));
+}
+
+/***********************************************
+ * Function Name: OS_voidComInit
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Makes every message inactive until its first write.
+ ***********************************************/
+void OS_voidComInit(void)
+{
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    for (i = 0; i < CAN_DB_MESSAGE_COUNT; i++) {
+        for (j = 0; j < 8U; j++) {
+            OS_stComMessages[i].data[j] = 0;
+        }
+        OS_stComMessages[i].burstLeft = 0;
+        OS_stComMessages[i].isWritten = false;
+        OS_stComMessages[i].hasSent = false;
+        OS_stComMessages[i].isPending = false;
+        OS_stComMessages[i].stats.written = 0;
+        OS_stComMessages[i].stats.sent = 0;
+        OS_stComMessages[i].stats.maxDelayTicks = 0;
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidComWrite
+ * Inputs: uint32_t a_ui32Index - Message (CAN_DB_INDEX_<message>)
+ *         const uint8_t *a_ptrData - Payload of CAN_DLC_<message> bytes
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Stores the payload. The first write and every change are handled by the mode of the message; a
+ *              payload equal to the previous one only refreshes the data of the next cyclic frame.
+ ***********************************************/
+void OS_voidComWrite(uint32_t a_ui32Index, const uint8_t *a_ptrData)
+{
+    const CAN_DbMessage_t *ptrMessage = 0;
+    ComMessage *ptrCom = 0;
+    uint32_t ui32Now = g_ui32SysTickCount;
+    uint8_t aui8Data[8] = {0};
+    bool boolChanged = false;
+    uint32_t i = 0;
+
+    if (a_ui32Index >= CAN_DB_MESSAGE_COUNT) {
+        return;
+    }
+    ptrMessage = &g_stCanDbMessages[a_ui32Index];
+    ptrCom = &OS_stComMessages[a_ui32Index];
+    if (ptrMessage->txMode == CAN_DB_TX_DIRECT) {
+        return;
+    }
+    boolChanged = !ptrCom->isWritten;
+
+    for (i = 0; i < ptrMessage->dlc; i++) {
+        aui8Data[i] = a_ptrData[i];
+    }
+    if ((ptrMessage->protection == CAN_DB_SEALED) && (ptrMessage->dlc >= 2U)) {
+        aui8Data[ptrMessage->dlc - 2U] &= 0x0FU;     // Alive counter
+        aui8Data[ptrMessage->dlc - 1U] = 0;          // Checksum
+    }
+    for (i = 0; i < ptrMessage->dlc; i++) {
+        if (aui8Data[i] != ptrCom->data[i]) {
+            boolChanged = true;
+        }
+        ptrCom->data[i] = aui8Data[i];
+    }
+    ptrCom->stats.written++;
+    if (!boolChanged) {
+        return;
+    }
+
+    if (!ptrCom->isPending) {
+        ptrCom->changeTick = ui32Now;
+    }
+    ptrCom->isPending = true;
+
+    switch (ptrMessage->txMode) {
+    case CAN_DB_TX_CYCLIC:
+        // Only the first write sends; later changes ride on the cycle
+        if (!ptrCom->isWritten) {
+            OS_voidComTransmit(a_ui32Index, ui32Now);
+            OS_voidPeriodicStart(&ptrCom->deadline, ptrMessage->cycleMs, ui32Now);
+        }
+        break;
+    case CAN_DB_TX_ON_CHANGE:
+        OS_voidComTransmit(a_ui32Index, ui32Now);
+        break;
+    case CAN_DB_TX_ON_CHANGE_GAP:
+        if (OS_boolComGapOver(a_ui32Index, ui32Now)) {
+            OS_voidComTransmit(a_ui32Index, ui32Now);
+        }
+        break;
+    case CAN_DB_TX_MIXED:
+        ptrCom->burstLeft = ptrMessage->burst;
+        if (OS_boolComGapOver(a_ui32Index, ui32Now)) {
+            OS_voidComTransmit(a_ui32Index, ui32Now);
+            OS_voidPeriodicStart(&ptrCom->deadline,
+                                 (ptrCom->burstLeft != 0U) ? ptrMessage->gapMs : ptrMessage->cycleMs, ui32Now);
+        } else {
+            ptrCom->deadline = ptrCom->lastSent + ptrMessage->gapMs;
+        }
+        break;
+    default:
+        break;
+    }
+    ptrCom->isWritten = true;
+}
+
+/***********************************************
+ * Function Name: OS_voidComMainFunction
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Task released every OS_COM_PERIOD_TICKS. Sends the cyclic frames that have fallen due (a late run
+ *              sends one frame, not one per missed cycle), the next frame of a burst, and the changes held back by
+ *              the gap.
+ ***********************************************/
+void OS_voidComMainFunction(void)
+{
+    const CAN_DbMessage_t *ptrMessage = 0;
+    ComMessage *ptrCom = 0;
+    uint32_t ui32Now = g_ui32SysTickCount;
+    uint32_t i = 0;
+
+    for (i = 0; i < CAN_DB_MESSAGE_COUNT; i++) {
+        ptrMessage = &g_stCanDbMessages[i];
+        ptrCom = &OS_stComMessages[i];
+        if (!ptrCom->isWritten) {
+            continue;
+        }
+
+        switch (ptrMessage->txMode) {
+        case CAN_DB_TX_CYCLIC:
+            if (OS_ui32PeriodicSkip(&ptrCom->deadline, ptrMessage->cycleMs, ui32Now) != 0U) {
+                OS_voidComTransmit(i, ui32Now);
+            }
+            break;
+        case CAN_DB_TX_ON_CHANGE_GAP:
+            if (ptrCom->isPending && OS_boolComGapOver(i, ui32Now)) {
+                OS_voidComTransmit(i, ui32Now);
+            }
+            break;
+        case CAN_DB_TX_MIXED:
+            if (!OS_boolPeriodicIsDue(ptrCom->deadline, ui32Now)) {
+                break;
+            }
+            if (ptrCom->burstLeft != 0U) {
+                OS_voidComTransmit(i, ui32Now);
+                OS_voidPeriodicStart(&ptrCom->deadline,
+                                     (ptrCom->burstLeft != 0U) ? ptrMessage->gapMs : ptrMessage->cycleMs, ui32Now);
+            } else {
+                (void)OS_ui32PeriodicSkip(&ptrCom->deadline, ptrMessage->cycleMs, ui32Now);
+                OS_voidComTransmit(i, ui32Now);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidComGetStats
+ * Inputs: uint32_t a_ui32Index - Message (CAN_DB_INDEX_<message>)
+ *         ComStats *a_ptrStats - Receives the counters
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+void OS_voidComGetStats(uint32_t a_ui32Index, ComStats *a_ptrStats)
+{
+    *a_ptrStats = OS_stComMessages[a_ui32Index].stats;
+}
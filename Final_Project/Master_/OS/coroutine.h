@@ -0,0 +1,73 @@
+/*
+ * coroutine.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Provide stackless (protothread-style) coroutines so long-running task logic can give the CPU back
+ *                  to the dispatcher instead of busy-waiting.
+ *               2) Offer yield, wait-until, sleep-for and spawn primitives built on a switch over the resume line.
+ *
+ *      Usage rules:
+ *               - A coroutine is a function returning uint8_t (OS_CR_WAITING / OS_CR_ENDED) whose body sits between
+ *                 OS_CR_BEGIN and OS_CR_END. A scheduler task resumes it on every release.
+ *               - Local variables are not preserved across a yield; keep state in static variables.
+ *               - Only one OS_CR_* primitive per source line, and no switch statement spanning a primitive.
+ *               - Sleep resolution is the period of the task that resumes the coroutine.
+ */
+
+#ifndef COROUTINE_H_
+#define COROUTINE_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_CR_WAITING               0U      // Coroutine is blocked and must be resumed again
+#define OS_CR_ENDED                 1U      // Coroutine ran to OS_CR_END and restarts on the next resume
+
+#define OS_CR_INITIALIZER           {0U, 0U}
+
+// Time base used by OS_CR_SLEEP_FOR (system ticks)
+#ifndef OS_CR_NOW
+    #define OS_CR_NOW()             (g_ui32SysTickCount)
+#endif
+
+#define OS_CR_RESET(cr)             ((cr)->line = 0U)
+
+#define OS_CR_BEGIN(cr)             switch ((cr)->line) { case 0U:
+
+#define OS_CR_END(cr)               } (cr)->line = 0U; return OS_CR_ENDED
+
+// Give the CPU back; execution continues after this line on the next resume
+#define OS_CR_YIELD(cr)             do { (cr)->line = __LINE__; return OS_CR_WAITING; case __LINE__:; } while (0)
+
+// Re-evaluate cond on every resume and continue once it holds
+#define OS_CR_WAIT_UNTIL(cr, cond)  do { (cr)->line = __LINE__; case __LINE__: \
+                                         if (!(cond)) { return OS_CR_WAITING; } } while (0)
+
+// Continue on the first resume at least ticks after this point
+#define OS_CR_SLEEP_FOR(cr, ticks)  do { (cr)->wakeTick = OS_CR_NOW() + (uint32_t)(ticks); \
+                                         OS_CR_WAIT_UNTIL((cr), (int32_t)(OS_CR_NOW() - (cr)->wakeTick) >= 0); } while (0)
+
+// Start child from its beginning and resume it from this coroutine until it ends
+#define OS_CR_SPAWN(cr, child, call) do { OS_CR_RESET(child); \
+                                         OS_CR_WAIT_UNTIL((cr), (call) == OS_CR_ENDED); } while (0)
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint16_t line;               // Resume point (__LINE__ of the last primitive), 0 = start
+    uint32_t wakeTick;           // Deadline of OS_CR_SLEEP_FOR
+} OS_Coroutine;
+
+extern volatile uint32_t g_ui32SysTickCount;
+
+#endif /* COROUTINE_H_ */
@@ -0,0 +1,558 @@
+/*
+ * dispatcher.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the OS dispatcher. Tasks are identified by their slot in the
+ *      priority-sorted const task table (slot 0 = highest priority); the matching entry of the task list holds the
+ *      run-time state. The SysTick service sets a slot's bit in a two-level ready
+ *      bitmap when the task is released, and the dispatcher runs ready tasks highest priority first, locating each one
+ *      with two count-leading-zeros operations regardless of how many tasks are registered. Interrupt handlers release
+ *      tasks between ticks by setting event flags; each event maps to a precomputed set of slots that is merged into
+ *      the ready bitmap, so the release latency is one interrupt and one dispatch rather than one task period.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/dispatcher.h"
+#include "OS/timebase.h"
+#include "OS/periodic.h"
+#include "OS/atomic.h"
+#include "OS/trace.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static const TaskConfig *OS_ptrTaskTable = 0;
+static TaskControlBlock *OS_ptrTaskList = 0;
+static uint8_t OS_ui8DispatcherTaskCount = 0;
+static volatile uint32_t OS_ui32DispatcherNow = 0;   // Last tick seen by the tick service
+
+// Bit (31 - w) of the group word is set while OS_ui32ReadyTable[w] is non-zero.
+// Bit (31 - s % 32) of OS_ui32ReadyTable[s / 32] is set while slot s is ready.
+static volatile uint32_t OS_ui32ReadyGroup = 0;
+static volatile uint32_t OS_ui32ReadyTable[OS_READY_WORDS] = {0};
+
+// Slots released by each event, in the bit layout of OS_ui32ReadyTable (built once from the task event masks)
+static uint32_t OS_ui32EventSlots[OS_MAX_EVENTS][OS_READY_WORDS] = {{0}};
+static volatile uint32_t OS_ui32PendingEvents = 0;  // Events set and not yet taken by a task
+
+// Statistics of a task that has not run yet (minimum starts at the largest value)
+static const TaskStats OS_stClearedStats = {0, 0, 0, 0xFFFFFFFFUL, 0, 0, 0, 0, 0, 0, 0};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidUpdateTaskStats
+ * Inputs: TaskControlBlock *a_ptrTask - Task that just returned
+ *         uint32_t a_ui32Jitter - Cycles from its release to the start of the run
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Folds the run that just completed into the task statistics.
+ ***********************************************/
+static void OS_voidUpdateTaskStats(TaskControlBlock *a_ptrTask, uint32_t a_ui32Jitter)
+{
+    TaskStats *ptrStats = &a_ptrTask->stats;
+    uint32_t ui32Cycles = ptrStats->endCycles - ptrStats->startCycles;
+
+    if (ui32Cycles < ptrStats->minCycles) {
+        ptrStats->minCycles = ui32Cycles;
+    }
+    if (ui32Cycles > ptrStats->maxCycles) {
+        ptrStats->maxCycles = ui32Cycles;
+    }
+    if (a_ui32Jitter > ptrStats->maxJitterCycles) {
+        ptrStats->maxJitterCycles = a_ui32Jitter;
+    }
+    ptrStats->totalCycles += ui32Cycles;
+    ptrStats->runCount++;
+}
+
+/***********************************************
+ * Function Name: OS_voidDispatcherInit
+ * Inputs: const TaskConfig *a_ptrTaskTable - Task table sorted by priority (index 0 = highest priority)
+ *         TaskControlBlock *a_ptrTaskList - Run-time state, one entry per table entry
+ *         uint8_t a_ui8TaskCount - Number of entries in both arrays
+ *         uint32_t a_ui32Now - Current system tick
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Attaches the dispatcher to the task table, clears the ready bitmap, enables every task and schedules
+ *              its first release one period plus its phase offset from now. All rasters are counted from this tick,
+ *              so the offsets keep tasks of the same class on different ticks for good. Builds the event-to-slot table from the task event masks, starts the
+ *              cycle counter and clears the task statistics. Tasks beyond OS_MAX_TASK_SLOTS are ignored.
+ ***********************************************/
+void OS_voidDispatcherInit(const TaskConfig *a_ptrTaskTable, TaskControlBlock *a_ptrTaskList, uint8_t a_ui8TaskCount,
+                           uint32_t a_ui32Now)
+{
+    uint8_t i = 0;
+    uint32_t ui32Event = 0;
+    bool boolMasked = false;
+
+    if (a_ui8TaskCount > OS_MAX_TASK_SLOTS) {
+        a_ui8TaskCount = OS_MAX_TASK_SLOTS;
+    }
+
+    OS_CYCLE_COUNTER_INIT();
+
+    OS_ENTER_CRITICAL(boolMasked);
+    OS_ptrTaskTable = a_ptrTaskTable;
+    OS_ptrTaskList = a_ptrTaskList;
+    OS_ui8DispatcherTaskCount = a_ui8TaskCount;
+    OS_ui32DispatcherNow = a_ui32Now;
+    OS_ui32ReadyGroup = 0;
+    OS_ui32PendingEvents = 0;
+    for (i = 0; i < OS_READY_WORDS; i++) {
+        OS_ui32ReadyTable[i] = 0;
+        for (ui32Event = 0; ui32Event < OS_MAX_EVENTS; ui32Event++) {
+            OS_ui32EventSlots[ui32Event][i] = 0;
+        }
+    }
+    for (i = 0; i < a_ui8TaskCount; i++) {
+        a_ptrTaskList[i].lastRunTick = a_ui32Now;
+        a_ptrTaskList[i].nextReleaseTick = a_ui32Now + a_ptrTaskTable[i].periodTicks + a_ptrTaskTable[i].offsetTicks;
+        a_ptrTaskList[i].state = TASK_READY;
+        a_ptrTaskList[i].isEnabled = 1U;
+        a_ptrTaskList[i].stats = OS_stClearedStats;
+        a_ptrTaskList[i].aliveCount = 0;
+        a_ptrTaskList[i].aliveChecked = 0;
+        for (ui32Event = 0; ui32Event < OS_MAX_EVENTS; ui32Event++) {
+            if (a_ptrTaskTable[i].eventMask & OS_EVENT(ui32Event)) {
+                OS_ui32EventSlots[ui32Event][i / OS_READY_WORD_BITS] |= (0x80000000UL >> (i % OS_READY_WORD_BITS));
+            }
+        }
+    }
+    OS_EXIT_CRITICAL(boolMasked);
+}
+
+/***********************************************
+ * Function Name: OS_voidSetTaskReady
+ * Inputs: uint8_t a_ui8Slot - Slot of the task in the priority-sorted list
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Marks a task as ready in both bitmap levels with atomic ORs, so it is safe from any context without
+ *              masking interrupts: a handler that preempts the update cannot lose its own bit or this one. Clearing
+ *              stays in the critical section of OS_voidDispatch, which keeps the group bit in step with its word.
+ ***********************************************/
+void OS_voidSetTaskReady(uint8_t a_ui8Slot)
+{
+    uint32_t ui32Word = (uint32_t)a_ui8Slot / OS_READY_WORD_BITS;
+    uint32_t ui32Bit = (uint32_t)a_ui8Slot % OS_READY_WORD_BITS;
+
+    (void)OS_ui32AtomicFetchOr(&OS_ui32ReadyTable[ui32Word], 0x80000000UL >> ui32Bit);
+    (void)OS_ui32AtomicFetchOr(&OS_ui32ReadyGroup, 0x80000000UL >> ui32Word);
+}
+
+/***********************************************
+ * Function Name: OS_ui8HighestReadyTask
+ * Inputs: N/A
+ * Outputs: uint8_t - Slot of the highest priority ready task, or OS_NO_TASK
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Locates the highest priority ready task with one CLZ on the group word and one CLZ on the selected
+ *              table word. The cost does not depend on the number of registered tasks.
+ ***********************************************/
+uint8_t OS_ui8HighestReadyTask(void)
+{
+    uint32_t ui32Group = OS_ui32ReadyGroup;
+    uint32_t ui32Word = 0;
+
+    if (ui32Group == 0U) {
+        return OS_NO_TASK;
+    }
+
+    ui32Word = OS_CLZ(ui32Group);
+    return (uint8_t)((ui32Word * OS_READY_WORD_BITS) + OS_CLZ(OS_ui32ReadyTable[ui32Word]));
+}
+
+/***********************************************
+ * Function Name: OS_ui32TicksToNextRelease
+ * Inputs: N/A
+ * Outputs: uint32_t - Ticks until the earliest periodic release of an enabled task, 0 if a task is already ready
+ *                     or overdue, 0xFFFFFFFF if no periodic task is enabled
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Used by the idle path to decide how long the core may sleep. Callers must hold the critical section so
+ *              that a release cannot occur between this query and entering sleep. Event releases are not predicted;
+ *              the interrupt that sets the event ends the sleep.
+ ***********************************************/
+uint32_t OS_ui32TicksToNextRelease(void)
+{
+    uint8_t i = 0;
+    int32_t i32Delta = 0;
+    uint32_t ui32Ticks = 0xFFFFFFFFUL;
+    TaskControlBlock *ptrTask = OS_ptrTaskList;
+    const TaskConfig *ptrConfig = OS_ptrTaskTable;
+
+    if (OS_ui32ReadyGroup != 0U) {
+        return 0;
+    }
+
+    for (i = 0; i < OS_ui8DispatcherTaskCount; i++, ptrTask++, ptrConfig++) {
+        if (ptrTask->isEnabled && (ptrConfig->periodTicks != OS_PERIOD_NONE)) {
+            i32Delta = (int32_t)(ptrTask->nextReleaseTick - OS_ui32DispatcherNow);
+            if (i32Delta <= 0) {
+                return 0;
+            }
+            if ((uint32_t)i32Delta < ui32Ticks) {
+                ui32Ticks = (uint32_t)i32Delta;
+            }
+        }
+    }
+
+    return ui32Ticks;
+}
+
+/***********************************************
+ * Function Name: OS_voidDispatcherTick
+ * Inputs: uint32_t a_ui32Now - Current system tick
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Tick service, called from the SysTick interrupt. Every enabled task whose release tick has been reached
+ *              is marked ready and its next release is advanced by whole periods onto the first raster point after
+ *              now, so releases keep their phase and do not drift with dispatch latency. No period is skipped
+ *              silently: if the tick jumped over several release points, or the task is still ready or running from
+ *              its previous release, it keeps a single pending activation and every release point it did not get is
+ *              counted as a missed deadline. Event-only tasks are skipped.
+ ***********************************************/
+void OS_voidDispatcherTick(uint32_t a_ui32Now)
+{
+    uint8_t i = 0;
+    uint32_t ui32Releases = 0;
+    TaskControlBlock *ptrTask = OS_ptrTaskList;
+    const TaskConfig *ptrConfig = OS_ptrTaskTable;
+
+    OS_ui32DispatcherNow = a_ui32Now;
+    for (i = 0; i < OS_ui8DispatcherTaskCount; i++, ptrTask++, ptrConfig++) {
+        if (ptrTask->isEnabled && (ptrConfig->periodTicks != OS_PERIOD_NONE) &&
+            OS_boolPeriodicIsDue(ptrTask->nextReleaseTick, a_ui32Now)) {
+            // Release points reached since the last service, normally exactly one
+            ui32Releases = OS_ui32PeriodicSkip(&ptrTask->nextReleaseTick, ptrConfig->periodTicks, a_ui32Now);
+            if ((ptrTask->state != TASK_RUNNING) &&
+                !(OS_ui32ReadyTable[i / OS_READY_WORD_BITS] & (0x80000000UL >> (i % OS_READY_WORD_BITS)))) {
+                ui32Releases--;
+            }
+            ptrTask->stats.missedDeadlines += ui32Releases;
+            ptrTask->stats.releaseCycles = OS_CYCLE_COUNT();
+            OS_voidSetTaskReady(i);
+        }
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidDispatch
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Runs every ready task, highest priority first. The bitmap is re-read after each task so that a higher
+ *              priority task released while a lower one was running is dispatched next. Returns when no task is
+ *              ready. The stack is repainted before and measured after each run, outside the timed section; an
+ *              idle pass (nothing ready) costs one read of the group word.
+ ***********************************************/
+void OS_voidDispatch(void)
+{
+    uint8_t ui8Slot = 0;
+    uint32_t ui32Word = 0;
+    uint32_t ui32Jitter = 0;
+    uint32_t ui32Stack = 0;
+    TaskControlBlock *ptrTask = 0;
+    bool boolMasked = false;
+
+    for (;;) {
+        // Releases only add bits, so a pass that finds the group empty returns without painting or masking
+        if (OS_ui32ReadyGroup == 0U) {
+            break;
+        }
+        OS_STACK_PAINT();
+        OS_ENTER_CRITICAL(boolMasked);
+        ui8Slot = OS_ui8HighestReadyTask();
+        if (ui8Slot == OS_NO_TASK) {
+            OS_EXIT_CRITICAL(boolMasked);
+            break;
+        }
+
+        // Consume the activation before running the task
+        ui32Word = (uint32_t)ui8Slot / OS_READY_WORD_BITS;
+        OS_ui32ReadyTable[ui32Word] &= ~(0x80000000UL >> ((uint32_t)ui8Slot % OS_READY_WORD_BITS));
+        if (OS_ui32ReadyTable[ui32Word] == 0U) {
+            OS_ui32ReadyGroup &= ~(0x80000000UL >> ui32Word);
+        }
+        ptrTask = &OS_ptrTaskList[ui8Slot];
+        ptrTask->state = TASK_RUNNING;
+        ptrTask->stats.startCycles = OS_CYCLE_COUNT();
+        ui32Jitter = ptrTask->stats.startCycles - ptrTask->stats.releaseCycles;
+        OS_EXIT_CRITICAL(boolMasked);
+
+        ptrTask->lastRunTick = OS_ui32DispatcherNow;
+        ptrTask->stats.startTimeCycles = OS_ui64TimeCycles();
+        OS_voidTraceRecord(OS_TRACE_TASK_START, ui8Slot, 0U);
+        OS_ptrTaskTable[ui8Slot].taskFunction();
+        OS_voidTraceRecord(OS_TRACE_TASK_END, ui8Slot, 0U);
+        ptrTask->stats.endCycles = OS_CYCLE_COUNT();
+        ptrTask->state = TASK_READY;
+        ptrTask->aliveCount++;
+        ui32Stack = OS_STACK_USED();
+        if (ui32Stack > ptrTask->stats.maxStackBytes) {
+            ptrTask->stats.maxStackBytes = ui32Stack;
+        }
+        OS_voidUpdateTaskStats(ptrTask, ui32Jitter);
+    }
+}
+
+/***********************************************
+ * Function Name: OS_ui32TaskMeanCycles
+ * Inputs: const TaskControlBlock *a_ptrTask - Task to query
+ * Outputs: uint32_t - Mean execution time in cycles, 0 if the task never ran
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Mean execution time over all completed runs.
+ ***********************************************/
+uint32_t OS_ui32TaskMeanCycles(const TaskControlBlock *a_ptrTask)
+{
+    if (a_ptrTask->stats.runCount == 0U) {
+        return 0;
+    }
+    return (uint32_t)(a_ptrTask->stats.totalCycles / a_ptrTask->stats.runCount);
+}
+
+/***********************************************
+ * Function Name: OS_ui32UtilizationPermille
+ * Inputs: uint32_t a_ui32TickCycles - CPU cycles in one system tick
+ * Outputs: uint32_t - Sum of WCET / period over the periodic tasks, in 1/1000 of the CPU
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: The WCET of a task is the largest execution time recorded in its statistics. Event-only tasks have no
+ *              minimum inter-arrival time and are not counted; event-released periodic tasks are counted at their
+ *              period. Above 1000 the task set cannot keep up whatever the priorities.
+ ***********************************************/
+uint32_t OS_ui32UtilizationPermille(uint32_t a_ui32TickCycles)
+{
+    uint8_t i = 0;
+    uint64_t ui64Permille = 0;
+
+    for (i = 0; i < OS_ui8DispatcherTaskCount; i++) {
+        if (OS_ptrTaskTable[i].periodTicks != OS_PERIOD_NONE) {
+            ui64Permille += ((uint64_t)OS_ptrTaskList[i].stats.maxCycles * 1000U) /
+                            ((uint64_t)OS_ptrTaskTable[i].periodTicks * a_ui32TickCycles);
+        }
+    }
+    return (ui64Permille > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32_t)ui64Permille;
+}
+
+/***********************************************
+ * Function Name: OS_ui32TaskResponseCycles
+ * Inputs: uint8_t a_ui8Slot - Task slot (0 = highest priority)
+ *         uint32_t a_ui32TickCycles - CPU cycles in one system tick
+ *         uint32_t a_ui32BlockingCycles - Longest section the scheduler loop runs outside the tasks (the software
+ *                                         timer callbacks)
+ * Outputs: uint32_t - Worst-case cycles from the release of the task to the end of its run, OS_RESPONSE_UNBOUNDED if
+ *                     that exceeds its period, 0 for an event-only task
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Response-time analysis for non-preemptive fixed-priority dispatch (tasks run to completion):
+ *                  B = max(blocking, C of every task of lower priority)
+ *                  t = B + sum over j of priority i or higher of ceil(t / T_j) * C_j       (level-i busy period)
+ *                  w_q = B + q * C + sum over higher priorities j of (floor(w_q / T_j) + 1) * C_j
+ *                  R = max over the jobs q = 0 .. ceil(t / T) - 1 of w_q + C - q * T
+ *              A task cannot be preempted once started, so a later job of the same busy period can wait longer
+ *              than the first one; every job of the busy period is checked. The busy period is only finite when
+ *              the tasks of priority i and higher need less than the whole CPU. Interrupt and dispatcher overhead
+ *              is not modelled; it is part of the measured C of the task that was interrupted.
+ ***********************************************/
+uint32_t OS_ui32TaskResponseCycles(uint8_t a_ui8Slot, uint32_t a_ui32TickCycles, uint32_t a_ui32BlockingCycles)
+{
+    uint8_t i = 0;
+    uint64_t ui64Period = 0;
+    uint64_t ui64Cost = 0;
+    uint64_t ui64Blocking = a_ui32BlockingCycles;
+    uint64_t ui64Load = 0;
+    uint64_t ui64Busy = 0;
+    uint64_t ui64Wait = 0;
+    uint64_t ui64Next = 0;
+    uint64_t ui64Response = 0;
+    uint64_t ui64Jobs = 0;
+    uint64_t q = 0;
+
+    if ((a_ui8Slot >= OS_ui8DispatcherTaskCount) || (OS_ptrTaskTable[a_ui8Slot].periodTicks == OS_PERIOD_NONE)) {
+        return 0;
+    }
+    ui64Period = (uint64_t)OS_ptrTaskTable[a_ui8Slot].periodTicks * a_ui32TickCycles;
+    ui64Cost = OS_ptrTaskList[a_ui8Slot].stats.maxCycles;
+
+    for (i = a_ui8Slot + 1U; i < OS_ui8DispatcherTaskCount; i++) {
+        if (OS_ptrTaskList[i].stats.maxCycles > ui64Blocking) {
+            ui64Blocking = OS_ptrTaskList[i].stats.maxCycles;
+        }
+    }
+
+    // Demand of priority i and higher over one hyperperiod, which must stay below its length
+    for (i = 0; i <= a_ui8Slot; i++) {
+        if (OS_ptrTaskTable[i].periodTicks != OS_PERIOD_NONE) {
+            ui64Load += (uint64_t)OS_ptrTaskList[i].stats.maxCycles *
+                        (OS_RASTER_HYPERPERIOD / OS_ptrTaskTable[i].periodTicks);
+        }
+    }
+    if (ui64Load >= ((uint64_t)OS_RASTER_HYPERPERIOD * a_ui32TickCycles)) {
+        return OS_RESPONSE_UNBOUNDED;
+    }
+
+    ui64Next = ui64Blocking + ui64Cost;
+    do {
+        ui64Busy = ui64Next;
+        ui64Next = ui64Blocking;
+        for (i = 0; i <= a_ui8Slot; i++) {
+            if (OS_ptrTaskTable[i].periodTicks != OS_PERIOD_NONE) {
+                ui64Next += ((ui64Busy + ((uint64_t)OS_ptrTaskTable[i].periodTicks * a_ui32TickCycles) - 1U) /
+                             ((uint64_t)OS_ptrTaskTable[i].periodTicks * a_ui32TickCycles)) *
+                            OS_ptrTaskList[i].stats.maxCycles;
+            }
+        }
+    } while (ui64Next != ui64Busy);
+    ui64Jobs = (ui64Busy + ui64Period - 1U) / ui64Period;
+
+    for (q = 0; (q < ui64Jobs) || (q == 0U); q++) {
+        // w grows monotonically; stop as soon as the deadline of job q is out of reach
+        ui64Next = ui64Blocking + (q * ui64Cost);
+        do {
+            ui64Wait = ui64Next;
+            ui64Next = ui64Blocking + (q * ui64Cost);
+            for (i = 0; i < a_ui8Slot; i++) {
+                if (OS_ptrTaskTable[i].periodTicks != OS_PERIOD_NONE) {
+                    ui64Next += ((ui64Wait / ((uint64_t)OS_ptrTaskTable[i].periodTicks * a_ui32TickCycles)) + 1U) *
+                                OS_ptrTaskList[i].stats.maxCycles;
+                }
+            }
+            if ((ui64Next + ui64Cost) > ((q + 1U) * ui64Period)) {
+                return OS_RESPONSE_UNBOUNDED;
+            }
+        } while (ui64Next != ui64Wait);
+
+        if (((ui64Wait + ui64Cost) > (q * ui64Period)) && ((ui64Wait + ui64Cost - (q * ui64Period)) > ui64Response)) {
+            ui64Response = ui64Wait + ui64Cost - (q * ui64Period);
+        }
+    }
+
+    return (uint32_t)ui64Response;
+}
+
+/***********************************************
+ * Function Name: OS_boolIsSchedulable
+ * Inputs: uint32_t a_ui32TickCycles - CPU cycles in one system tick
+ *         uint32_t a_ui32BlockingCycles - See OS_ui32TaskResponseCycles
+ * Outputs: bool - true if utilisation is at most 100 % and every periodic task completes within its period
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Verdict over the whole table. Only as good as the execution times it is given: on target they are
+ *              the maxima observed so far, so run it after the slow paths (EEPROM writes, UART dumps) were exercised.
+ ***********************************************/
+bool OS_boolIsSchedulable(uint32_t a_ui32TickCycles, uint32_t a_ui32BlockingCycles)
+{
+    uint8_t i = 0;
+
+    if (OS_ui32UtilizationPermille(a_ui32TickCycles) > 1000U) {
+        return false;
+    }
+    for (i = 0; i < OS_ui8DispatcherTaskCount; i++) {
+        if (OS_ui32TaskResponseCycles(i, a_ui32TickCycles, a_ui32BlockingCycles) == OS_RESPONSE_UNBOUNDED) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_ui8CheckAlive
+ * Inputs: N/A
+ * Outputs: uint8_t - Slot of the highest priority task that completed fewer runs than its aliveMin since the
+ *                    previous call, OS_NO_TASK if every supervised task did
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Closes a supervision window; call once per window, from the SysTick interrupt so that it also runs
+ *              while a task hangs. The run counter is only written by the dispatcher and the snapshot only here, so
+ *              no critical section is needed. A disabled task is not supervised.
+ ***********************************************/
+uint8_t OS_ui8CheckAlive(void)
+{
+    uint8_t i = 0;
+    uint8_t ui8Failed = OS_NO_TASK;
+    uint32_t ui32Count = 0;
+
+    for (i = 0; i < OS_ui8DispatcherTaskCount; i++) {
+        ui32Count = OS_ptrTaskList[i].aliveCount;
+        if ((ui8Failed == OS_NO_TASK) && OS_ptrTaskList[i].isEnabled &&
+            ((ui32Count - OS_ptrTaskList[i].aliveChecked) < OS_ptrTaskTable[i].aliveMin)) {
+            ui8Failed = i;
+        }
+        OS_ptrTaskList[i].aliveChecked = ui32Count;
+    }
+    return ui8Failed;
+}
+
+/***********************************************
+ * Function Name: OS_voidSetEvent
+ * Inputs: uint32_t a_ui32Events - Event bits to set (OS_EVENT(n))
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Records the events and releases every enabled task whose event mask contains one of them. Safe from
+ *              interrupt handlers, deferred jobs and tasks alike: the pending events and the ready bitmap are updated
+ *              atomically, and a preempting call at worst overwrites a release time. A task that is already
+ *              ready keeps a single activation and its original release time, so several events arriving before it
+ *              runs are coalesced and not counted as missed deadlines. A task that is running is released again so it
+ *              also sees data that arrived after it sampled its inputs. The release time feeds the jitter statistic,
+ *              which therefore measures the event-to-activation latency of event-driven runs.
+ ***********************************************/
+void OS_voidSetEvent(uint32_t a_ui32Events)
+{
+    uint32_t ui32Event = 0;
+    uint32_t ui32Word = 0;
+    uint32_t ui32Slots = 0;
+    uint32_t ui32Bit = 0;
+    uint32_t ui32Cycles = OS_CYCLE_COUNT();
+    TaskControlBlock *ptrTask = 0;
+
+    (void)OS_ui32AtomicFetchOr(&OS_ui32PendingEvents, a_ui32Events);
+
+    while (a_ui32Events != 0U) {
+        ui32Event = 31U - OS_CLZ(a_ui32Events);
+        a_ui32Events &= ~OS_EVENT(ui32Event);
+
+        for (ui32Word = 0; ui32Word < OS_READY_WORDS; ui32Word++) {
+            // Only slots that are not ready yet get a new release time
+            ui32Slots = OS_ui32EventSlots[ui32Event][ui32Word] & ~OS_ui32ReadyTable[ui32Word];
+            while (ui32Slots != 0U) {
+                ui32Bit = OS_CLZ(ui32Slots);
+                ui32Slots &= ~(0x80000000UL >> ui32Bit);
+                ptrTask = &OS_ptrTaskList[(ui32Word * OS_READY_WORD_BITS) + ui32Bit];
+                if (ptrTask->isEnabled) {
+                    ptrTask->stats.releaseCycles = ui32Cycles;
+                    OS_voidSetTaskReady((uint8_t)((ui32Word * OS_READY_WORD_BITS) + ui32Bit));
+                }
+            }
+        }
+    }
+}
+
+/***********************************************
+ * Function Name: OS_ui32TakeEvents
+ * Inputs: uint32_t a_ui32Mask - Events the caller is interested in
+ * Outputs: uint32_t - The events of a_ui32Mask that were set since they were last taken
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Reads and clears pending events, so a task released by several events can tell which of them
+ *              occurred. Lock-free: an event set during the call is either returned or left pending, never lost.
+ ***********************************************/
+uint32_t OS_ui32TakeEvents(uint32_t a_ui32Mask)
+{
+    return OS_ui32AtomicFetchAnd(&OS_ui32PendingEvents, ~a_ui32Mask) & a_ui32Mask;
+}
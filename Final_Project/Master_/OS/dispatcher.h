@@ -0,0 +1,179 @@
+/*
+ * dispatcher.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the task control block and the priority-indexed ready bitmap used by the OS dispatcher.
+ *               2) Provide a constant-time dispatch path: the tick service marks released tasks in the bitmap and the
+ *                  dispatcher selects the highest ready priority with a single count-leading-zeros per bitmap level.
+ *               3) Keep the TivaWare dependencies of the module in the port macros below.
+ *               4) Record per-task timing statistics (execution time, release jitter, missed deadlines) from the DWT
+ *                  cycle counter, and the stack depth reached by each task.
+ *               5) Provide the macros that turn the application's task list (an X-macro) into a const task table,
+ *                  sorted by priority at compile time and placed in flash, with only the run-time state in RAM.
+ *               6) Provide event flags: an interrupt handler sets event bits with OS_voidSetEvent() and every task whose
+ *                  event mask contains one of them is released at once, in addition to (or instead of) its period.
+ *               7) Provide a schedulability check over the task table: CPU utilisation and the worst-case response time
+ *                  of every periodic task under non-preemptive fixed-priority dispatch, from the measured execution
+ *                  times plus a blocking term.
+ *               8) Count the completed runs of every task as alive indications and check them against the minimum
+ *                  the task table declares per supervision window, for the watchdog manager.
+ *               9) Timestamp the start of every run on the 64-bit time base, which does not wrap.
+ */
+
+#ifndef DISPATCHER_H_
+#define DISPATCHER_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/interrupt.h"
+#include "OS/stackmon.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_READY_WORD_BITS          32U     // Priority slots held by one bitmap word
+#define OS_READY_WORDS              2U      // Bitmap words (one group bit each)
+#define OS_MAX_TASK_SLOTS           (OS_READY_WORD_BITS * OS_READY_WORDS)
+#define OS_NO_TASK                  0xFFU   // Returned when no task is ready
+#define OS_MAX_EVENTS               32U     // Event flags, one bit each in an event mask
+#define OS_EVENT(n)                 (1UL << (n))
+#define OS_PERIOD_NONE              0U      // periodTicks of a task released by events only
+#define OS_MAX_TABLE_TASKS          32U     // Tasks a generated task table can hold (one priority bit each)
+#define OS_RESPONSE_UNBOUNDED       0xFFFFFFFFUL    // Response time exceeds the deadline (period) of the task
+
+/**
+ * Raster (cycle) classes a periodic task may use, in ticks: the 1-2-5 series from 1 ms to 1 s. Tasks of the same
+ * class are spread over different ticks with their phase offset instead of all becoming due on the same tick.
+ */
+#define OS_IS_RASTER(period)        (((period) == 1U) || ((period) == 2U) || ((period) == 5U) || \
+                                     ((period) == 10U) || ((period) == 20U) || ((period) == 50U) || \
+                                     ((period) == 100U) || ((period) == 200U) || ((period) == 500U) || \
+                                     ((period) == 1000U))
+#define OS_RASTER_HYPERPERIOD       1000U   // Ticks; every raster class divides it
+
+// Compile-time check, usable at file scope
+#define OS_STATIC_ASSERT(cond, name)        typedef char name[(cond) ? 1 : -1]
+
+/**
+ * Task table generation:
+ *      The application lists its tasks once as  X(function, periodTicks, offsetTicks, priority, eventMask, aliveMin)
+ *      entries of an X-macro.
+ *      - periodTicks is a raster class (OS_IS_RASTER) or OS_PERIOD_NONE.
+ *      - offsetTicks is the phase within the period (0 .. periodTicks - 1, 0 for an event-only task): the task is
+ *        released offsetTicks after every period boundary counted from dispatcher start.
+ *      - priority is the dispatch rank (1 = highest) and must be unique and contiguous from 1; each entry is placed
+ *        at index priority - 1 by a designated initializer, so the table is sorted by the compiler whatever the
+ *        listing order.
+ *      - aliveMin is the least number of completed runs (alive indications) the task must show in every supervision
+ *        window, 0 to leave the task unsupervised.
+ *      OS_TASK_TABLE_PRIOS yields one bit per used priority and OS_TASK_TABLE_TIMING_OK checks period and offset of
+ *      every entry, for the static asserts in the application.
+ */
+#define OS_TASK_ENTRY(fn, period, offset, prio, events, alive)      [(prio) - 1U] = {(fn), (period), (offset), (events), \
+                                                                                     (prio), (alive)},
+#define OS_TASK_COUNT_ONE(fn, period, offset, prio, events, alive)  + 1U
+#define OS_TASK_PRIO_BIT(fn, period, offset, prio, events, alive)   | (1UL << ((prio) - 1U))
+#define OS_TASK_TIMING_OK(fn, period, offset, prio, events, alive)  && ((OS_IS_RASTER(period) && ((offset) < (period))) || \
+                                                                     (((period) == OS_PERIOD_NONE) && ((offset) == 0U)))
+#define OS_TASK_TABLE_COUNT(table)                                  (0U table(OS_TASK_COUNT_ONE))
+#define OS_TASK_TABLE_PRIOS(table)                                  (0UL table(OS_TASK_PRIO_BIT))
+#define OS_TASK_TABLE_TIMING_OK(table)                              (1 table(OS_TASK_TIMING_OK))
+#define OS_TASK_PRIOS_EXPECTED(count)                               (((count) >= 32U) ? 0xFFFFFFFFUL : ((1UL << (count)) - 1UL))
+
+/**
+ * Port layer:
+ *      OS_CLZ(x)                   // Count leading zeros of a non-zero 32-bit word
+ *      OS_ENTER_CRITICAL(masked)   // Mask interrupts around bitmap read-modify-write; masked (a bool of the
+ *                                  // caller) keeps whether they were already masked
+ *      OS_EXIT_CRITICAL(masked)    // Unmask interrupts unless they were masked on entry
+ *      OS_CYCLE_COUNTER_INIT()     // Start the free-running cycle counter
+ *      OS_CYCLE_COUNT()            // Read the cycle counter (wraps every 2^32 cycles)
+ *      OS_STACK_PAINT()            // Repaint the free stack below the caller before a task runs
+ *      OS_STACK_USED()             // Deepest stack use in bytes since the last OS_STACK_PAINT()
+ */
+#define OS_DEMCR                (*((volatile uint32_t *)0xE000EDFCUL))  // Debug Exception and Monitor Control
+#define OS_DEMCR_TRCENA         0x01000000UL
+#define OS_DWT_CTRL             (*((volatile uint32_t *)0xE0001000UL))  // DWT Control
+#define OS_DWT_CTRL_CYCCNTENA   0x00000001UL
+#define OS_DWT_CYCCNT           (*((volatile uint32_t *)0xE0001004UL))  // DWT Cycle Count
+#define OS_CLZ(x)               ((uint32_t)__clz(x))   // CLZ instruction (TI ARM intrinsic)
+#define OS_ENTER_CRITICAL(masked)   ((masked) = IntMasterDisable())
+#define OS_EXIT_CRITICAL(masked)    do { if (!(masked)) { IntMasterEnable(); } } while (0)
+#define OS_CYCLE_COUNTER_INIT() do { OS_DEMCR |= OS_DEMCR_TRCENA; OS_DWT_CYCCNT = 0; \
+                                     OS_DWT_CTRL |= OS_DWT_CTRL_CYCCNTENA; } while (0)
+#define OS_CYCLE_COUNT()        (OS_DWT_CYCCNT)
+#define OS_STACK_PAINT()        OS_voidStackPaint()
+#define OS_STACK_USED()         OS_ui32StackUsed()
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef enum {
+    TASK_READY,
+    TASK_WAITING,
+    TASK_RUNNING
+} TaskState;
+
+// Timing statistics, all in CPU cycles. Execution time and stack depth include interrupts taken while the task runs.
+typedef struct {
+    uint32_t startCycles;        // Cycle count when the last run started
+    uint32_t endCycles;          // Cycle count when the last run returned
+    uint32_t releaseCycles;      // Cycle count when the task was last released
+    uint32_t minCycles;          // Shortest execution time
+    uint32_t maxCycles;          // Longest execution time
+    uint64_t totalCycles;        // Sum of execution times, mean = totalCycles / runCount
+    uint32_t maxJitterCycles;    // Longest delay from release to start
+    uint32_t missedDeadlines;    // Releases that found the previous activation still pending or running
+    uint32_t runCount;           // Number of completed runs
+    uint32_t maxStackBytes;      // Deepest system stack use during a run, in bytes from the top of the stack
+    uint64_t startTimeCycles;    // Time base (OS_ui64TimeCycles) when the last run started, for timestamps
+} TaskStats;
+
+// Static description of a task, generated into a const table (flash)
+typedef struct {
+    void (*taskFunction)(void);
+    uint32_t periodTicks;        // Release period (raster class), OS_PERIOD_NONE for an event-only task
+    uint32_t offsetTicks;        // Phase of the releases within the period
+    uint32_t eventMask;          // Events that also release the task, 0 for a periodic-only task
+    uint8_t priority;            // Dispatch rank, 1 = highest (slot + 1)
+    uint16_t aliveMin;           // Completed runs required per supervision window, 0 = not supervised
+} TaskConfig;
+
+// Run-time state of a task (RAM), same index as its TaskConfig entry
+typedef struct {
+    uint32_t lastRunTick;
+    uint32_t nextReleaseTick;    // Tick at which the tick service marks the task ready
+    TaskState state;
+    uint8_t isEnabled;           // Task enabled/disabled
+    TaskStats stats;             // Filled in by the dispatcher
+    uint32_t aliveCount;         // Completed runs (alive indications), written by the dispatcher only
+    uint32_t aliveChecked;       // aliveCount at the previous supervision check, written by OS_ui8CheckAlive only
+} TaskControlBlock;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidDispatcherInit(const TaskConfig *a_ptrTaskTable, TaskControlBlock *a_ptrTaskList, uint8_t a_ui8TaskCount,
+                           uint32_t a_ui32Now);
+void OS_voidDispatcherTick(uint32_t a_ui32Now);
+void OS_voidDispatch(void);
+void OS_voidSetTaskReady(uint8_t a_ui8Slot);
+uint8_t OS_ui8HighestReadyTask(void);
+uint32_t OS_ui32TicksToNextRelease(void);
+uint32_t OS_ui32TaskMeanCycles(const TaskControlBlock *a_ptrTask);
+uint32_t OS_ui32UtilizationPermille(uint32_t a_ui32TickCycles);
+uint32_t OS_ui32TaskResponseCycles(uint8_t a_ui8Slot, uint32_t a_ui32TickCycles, uint32_t a_ui32BlockingCycles);
+bool OS_boolIsSchedulable(uint32_t a_ui32TickCycles, uint32_t a_ui32BlockingCycles);
+uint8_t OS_ui8CheckAlive(void);
+void OS_voidSetEvent(uint32_t a_ui32Events);
+uint32_t OS_ui32TakeEvents(uint32_t a_ui32Mask);
+
+#endif /* DISPATCHER_H_ */
@@ -18,21 +18,31 @@
  ***********************************************/
 uint32_t APP_ui32UartCurrentState = 0x16;
 uint8_t APP_ui32counter = 0;
-uint8_t ui8taskCount = 0;
 uint32_t APP_ui32idleCounter = 0;
 uint32_t OS_ui32CurrentError = 0;
 uint32_t OS_ui32PrevError = 0x12;
 uint32_t OS_ui32index = 0;
-uint32_t OS_ui32DTCTimer = 0;
-uint32_t OS_ui32BlinkTimer = 0;
-uint32_t OS_ui32TesterTimer = 0;
-uint32_t OS_ui32CommLostTimer = 0;
-uint32_t OS_ui32BlinkBlueTimer = 0;
-uint32_t OS_ui32CommFailure = 0;
+uint32_t OS_ui32IdleCycles = 0;         // SysTick cycles spent in tickless sleep this load sample
+uint32_t OS_ui32IdlePasses = 0;         // Scheduler passes that found nothing to run this load sample
+uint32_t OS_ui32IdlePassCycles = 0;     // Cost of one such pass, calibrated at start-up
+uint32_t OS_ui32LoadWindowStart = 0;    // Tick at which the current load sample started
+uint32_t OS_ui32LoadSamples = 0;        // Samples taken since the last report
+uint32_t OS_ui32CpuLoadSmoothedX16 = 0; // Exponential average of the samples, in 1/16 %
+uint8_t OS_ui8CpuLoad = 0;              // CPU load of the last sample (%)
+uint8_t OS_ui8CpuLoadSmoothed = 0;      // Smoothed CPU load at the last report (%)
+uint8_t OS_ui8CpuLoadPeak = 0;          // Highest sample since the last report (%)
+volatile uint32_t OS_ui32CanErrorStatus = 0;   // CAN controller status latched by CAN_handler for OS_voidCanErrorJob
+uint32_t OS_ui32BusOffCount = 0;       // Bus-off events since reset
 
 static uint32_t APP_ui32CurrentState =0; //CHECK PLACE
 static uint32_t APP_ui32PrevState = 0;   //CHECK PLACE
 static uint8_t g_ui8ReceivedData[CAN_DATA_LENGTH] = {0};
+static uint8_t OS_ui8UartRxBuffer[UART_RX_RING_LEN];   // Storage of OS_stUartRxRing
+static SpscRing OS_stUartRxRing;                     // Tester input, UART_handler to OS_voidTesterMode
+static uint8_t OS_ui8LastTempValue = 0;              // Last TEMPERATURE average (whole degC), read by the tester session
+static bool OS_boolStatsDumpActive = false;          // CMD_TASK_STATS requested, OS_voidTesterOutput prints it
+static bool OS_boolTraceDumpRequested = false;       // CMD_TRACE_DUMP requested, OS_voidTesterOutput starts the export
+static uint8_t OS_ui8TempState = NORMAL_STATE;       // NORMAL_STATE or OVERHEAT from the last temperature decision
 //static uint8_t OS_ui8OverheatDTCCounter = 0;
 
 bool APP_boolStateInit = false;
@@ -41,6 +51,27 @@ bool OS_boolBlinkWhiteFlag = false;
 bool OS_boolBlinkBlueFlag = false;
 bool OS_boolIncrementCommFlag = false;
 bool OS_boolReadSensorFlag = false;
+bool OS_boolTesterModeFlag = false;     // Tester session open, it owns the white LED
+bool OS_boolCommFailureFlag = false;
+bool OS_boolOverheatConfirmed = false;
+
+SoftTimer OS_stCommLostTimer;           // No temperature frame for COMM_LOST_TIMEOUT_MS
+SoftTimer OS_stCommFailureTimer;        // No temperature frame for COMM_FAILURE_TIMEOUT_MS
+SoftTimer OS_stBlinkBlueTimer;          // Length of the communication-lost indication
+SoftTimer OS_stBlinkWhiteTimer;         // Length of the overheat indication
+SoftTimer OS_stDTCTimer;                // Overheat confirmation before requesting the voltage
+
+// Task table generated from OS_TASK_TABLE: const (flash) and sorted by priority, run-time state in taskList
+OS_STATIC_ASSERT(OS_TASK_COUNT <= MAX_TASKS, OS_assertTaskCountFitsMaxTasks);
+OS_STATIC_ASSERT(OS_TASK_COUNT <= OS_MAX_TABLE_TASKS, OS_assertTaskCountFitsTable);
+OS_STATIC_ASSERT(OS_TASK_TABLE_PRIOS(OS_TASK_TABLE) == OS_TASK_PRIOS_EXPECTED(OS_TASK_COUNT),
+                 OS_assertTaskPrioritiesUniqueFromOne);
+OS_STATIC_ASSERT(OS_TASK_TABLE_TIMING_OK(OS_TASK_TABLE), OS_assertTaskPeriodsAreRastersWithValidOffsets);
+
+const TaskConfig OS_stTaskTable[OS_TASK_COUNT] = {
+    OS_TASK_TABLE(OS_TASK_ENTRY)
+};
+TaskControlBlock taskList[OS_TASK_COUNT];
 //bool OS_boolDTCFlag = false;
 /***********************************************
  * Functions Definitions
@@ -54,21 +85,190 @@ bool OS_boolReadSensorFlag = false;
  * Synchronous: Synch
  * Description: This is the SysTick interrupt handler. It is triggered at regular
  *              intervals based on the configured SysTick timer settings. The
- *              function increments global counters used for timekeeping, idle
- *              state monitoring, and tracking the duration for which specific
- *              buttons are held down. These counters are critical for state
- *              management and timing operations across the system.
+ *              function advances the global tick counter by the number of
+ *              ticks the interrupt stands for (more than one after a tickless
+ *              sleep), then publishes it to the software timers and releases
+ *              the due tasks. Both services cost the same regardless of how
+ *              many timers or tasks exist.
  ***********************************************/
 void SYSTICK_handler(void) {
-    // Increment the global system tick counter (used for timekeeping)
-    g_ui32SysTickCount++;
-    OS_ui32DTCTimer++;
-    OS_ui32BlinkTimer++;
-    OS_ui32TesterTimer++;
-    OS_ui32CommLostTimer++;
-    OS_ui32BlinkBlueTimer++;
-    OS_ui32CommFailure++;
+    // Ticks covered by this interrupt (more than one after a tickless sleep)
+    uint32_t ui32Ticks = SYSTICK_ui32ElapsedTicks();
 
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_SYSTICK, 0U);
+
+    // Advance the global system tick counter (used for timekeeping)
+    g_ui32SysTickCount += ui32Ticks;
+
+    // Timeouts are handled by the software timers in the scheduler loop
+    OS_voidTimerTick(g_ui32SysTickCount);
+
+    // Release the tasks whose period elapsed on this tick
+    OS_voidDispatcherTick(g_ui32SysTickCount);
+
+#if configUSE_WATCHDOG
+    // Alive supervision runs here so that it also sees a task that never returns
+    OS_voidWdgMTick(g_ui32SysTickCount);
+#endif
+
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_SYSTICK, 0U);
+}
+
+/***********************************************
+ * Function Name: CAN_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: CAN interrupt handler. Clears the pending message object
+ *              interrupt, reads every object holding a new received frame
+ *              into the CAN RX ring and, if there was one, releases the tasks
+ *              waiting on OS_EVENT_CAN_RX; they take the frames with
+ *              CAN_Receive. Reading the objects here frees them for the next
+ *              frame at once. A transmit complete interrupt frees the mailbox
+ *              of the confirmed frame and loads the next queued frame.
+ *              A status interrupt (bus-off or error warning change) latches
+ *              the controller status, which also clears the interrupt, and
+ *              posts OS_voidCanErrorJob to the deferred level so the reaction
+ *              does not wait for the running task. The frames read also
+ *              pass through OS_voidCanReceiveHook, which posts the safe-state
+ *              job the same way.
+ ***********************************************/
+void CAN_handler(void) {
+    uint32_t ui32Cause = CANIntStatus(CAN_BASE, CAN_INT_STS_CAUSE);
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_CAN, 0U);
+
+    if ((ui32Cause >= 1U) && (ui32Cause <= 32U)) {
+        CANIntClear(CAN_BASE, ui32Cause);
+        if (CAN_DrainReceiveObjects() != 0U) {
+            OS_voidSetEvent(OS_EVENT_CAN_RX);
+        }
+        (void)CAN_ServiceTransmitObjects();
+    } else if (ui32Cause == CAN_INT_INTID_STATUS) {
+        OS_ui32CanErrorStatus = CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
+        (void)OS_boolDeferredPost(OS_voidCanErrorJob);
+    }
+
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_CAN, 0U);
+}
+
+/***********************************************
+ * Function Name: OS_voidCanErrorJob
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Deferred job posted by CAN_handler. On bus-off the controller
+ *              stops and sets INIT: the job turns the red LED on as the
+ *              safe-state indication and clears INIT, which rejoins the bus
+ *              after 128 occurrences of 11 recessive bits. When the status no
+ *              longer reports bus-off the indication is removed; the DTC task
+ *              drives the red LED again if a fault is still pending.
+ ***********************************************/
+void OS_voidCanErrorJob(void)
+{
+    static bool boolBusOff = false;
+
+    if (OS_ui32CanErrorStatus & CAN_STATUS_BUS_OFF) {
+        if (!boolBusOff) {
+            OS_ui32BusOffCount++;
+        }
+        boolBusOff = true;
+        OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_CAN_BUS, 1U);
+        HAL_voidLedOn(RED);
+        CANEnable(CAN_BASE);
+    } else if (boolBusOff) {
+        boolBusOff = false;
+        OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_CAN_BUS, 0U);
+        HAL_voidLedOff(RED);
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidCanReceiveHook
+ * Inputs: const CAN_Frame_t *frame - Frame CAN_handler just queued
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Receive hook of CAN_handler. A TEMPERATURE frame above the
+ *              threshold, once OS_voidTempData has confirmed the overheat and
+ *              while no overheat indication runs, posts OS_voidOverheatJob.
+ *              The confirmation timer stays in OS_voidTempData.
+ ***********************************************/
+void OS_voidCanReceiveHook(const CAN_Frame_t *frame)
+{
+    // Whole degrees above the threshold, as OS_voidTempData compares them
+    if ((frame->id == CAN_ID_TEMPERATURE) && OS_boolOverheatConfirmed && !OS_boolBlinkWhiteFlag &&
+        (CAN_Unpack_TEMPERATURE_AVERAGE(frame->data) >= (float)(OVERHEAT_THRESHOLD_DEGC + 1))) {
+        (void)OS_boolDeferredPost(OS_voidOverheatJob);
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidOverheatJob
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Deferred job posted by OS_voidCanReceiveHook. Requests the
+ *              ECU2 voltage with a remote frame, the CAN part of the overheat
+ *              reaction; the reply goes to OS_voidCheckKnownVoltage, which
+ *              starts the indication and counts the DTC in the task.
+ ***********************************************/
+void OS_voidOverheatJob(void)
+{
+    OS_voidECU1SendRemoteFrame();
+}
+
+/***********************************************
+ * Function Name: UART_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: UART0 interrupt handler. On a receive interrupt, moves the
+ *              received characters from the FIFO into the receive ring
+ *              (the handler is its only producer, the tester task its only
+ *              consumer) and releases the tasks waiting on OS_EVENT_UART_RX.
+ *              Emptying the FIFO here also stops the receive timeout from
+ *              firing again while a character waits for the task. On a
+ *              transmit interrupt, refills the TX FIFO from the TX ring.
+ ***********************************************/
+void UART_handler(void) {
+    uint8_t ui8Char = 0;
+    uint32_t ui32Status = 0;
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_UART, 0U);
+    ui32Status = UARTIntStatus(UART_BASE, true);
+    UARTIntClear(UART_BASE, ui32Status);
+    if ((ui32Status & (UART_INT_RX | UART_INT_RT)) != 0U) {
+        while (UARTCharsAvail(UART_BASE)) {
+            ui8Char = (uint8_t)UARTCharGetNonBlocking(UART_BASE);
+            (void)OS_boolSpscPush(&OS_stUartRxRing, &ui8Char);
+        }
+        OS_voidSetEvent(OS_EVENT_UART_RX);
+    }
+    if ((ui32Status & UART_INT_TX) != 0U) {
+        UART_ServiceTransmit();
+    }
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_UART, 0U);
+}
+
+/***********************************************
+ * Function Name: BUTTONS_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Port F interrupt handler. Clears the button interrupts and
+ *              releases the tasks waiting on OS_EVENT_BUTTON.
+ ***********************************************/
+void BUTTONS_handler(void) {
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_BUTTONS, 0U);
+    GPIOIntClear(GPIO_PORTF_BASE, GPIOIntStatus(GPIO_PORTF_BASE, true));
+    OS_voidSetEvent(OS_EVENT_BUTTON);
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_BUTTONS, 0U);
 }
 
 /***********************************************
@@ -79,9 +279,8 @@ void SYSTICK_handler(void) {
  * Synchronous: Synch
  * Description: This function acts as the operating system (OS) task manager.
  *              It ensures that the initialization of the OS occurs only once
- *              and periodically calls the `APP_voidScheduler` function based
- *              on the system tick count. The scheduler is executed every 50
- *              milliseconds.
+ *              and then calls the `APP_voidScheduler` function, which runs
+ *              every task released by the SysTick tick service.
  ***********************************************/
 void APP_voidOS(void) {
 
@@ -91,60 +290,68 @@ void APP_voidOS(void) {
     if (!initFlag) {
         OS_voidInit();  // Initialize the OS
         OS_voidInitTasks();
+        OS_voidInitTimers();
 
         initFlag = true; // Mark initialization as complete
     } else {
         // No action required after initialization
     }
 
-    // Check if 50 milliseconds have passed based on the system tick
-//    if (g_ui32SysTickCount % 50 == 0) {
-        //APP_voidScheduler(); // Call the scheduler function
-        scheduler();
-//    } else {
-//
-//    }
+    APP_voidScheduler(); // Run the tasks released since the last call
 }
 
-void scheduler(void)
+/***********************************************
+ * Function Name: OS_voidTesterMode
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Scheduler task that resumes the tester mode coroutine. Every
+ *              call returns as soon as the coroutine blocks, so the other
+ *              tasks (keep-alive, DTC, CAN reception) keep running while the
+ *              tester session is open.
+ ***********************************************/
+void OS_voidTesterMode(void)
 {
-    OS_voidTesterMode();
-    OS_voidCheckDTC();
-    OS_voidECU1SendKeepAlive();
-    OS_voidCANHandleReceivedMessages();
-    OS_voidCheckOverheat();
-    OS_voidHeartbeatError();
-    APP_voidUartControl();
-
+    static OS_Coroutine stTesterCr = OS_CR_INITIALIZER;
 
-
-
-//    HAL_voidLedBlink(WHITE);
-
-
-//    OS_voidECU1ReceiveVoltageResponse();
+    (void)OS_ui8EnterTesterMode(&stTesterCr);
 }
 
-void OS_voidTesterMode(void)
+/***********************************************
+ * Function Name: OS_voidTesterOutput
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Lowest-priority task that prints the long tester reports:
+ *              the task statistics, then the trace export. A report writes
+ *              a line only when the UART TX ring has room for it, so the
+ *              task never waits for the UART, and one run formats at most a
+ *              ring of text before it returns; the rest goes out on later
+ *              releases at the line rate.
+ ***********************************************/
+void OS_voidTesterOutput(void)
 {
-    if (BUTTONS_rightButton() && BUTTONS_leftButton()) {
-        // If sw1 is pressed, increment the counter and reset idle counter
-        UART_SendMessage("Entering Tester Mode...\r\n");
-        OS_voidEnterTesterMode();  // Enter Tester Mode
+    static OS_Coroutine stStatsCr = OS_CR_INITIALIZER;
+
+    if (OS_boolStatsDumpActive) {
+        if (OS_ui8DumpTaskStats(&stStatsCr) == OS_CR_ENDED) {
+            OS_boolStatsDumpActive = false;
         }
-    else{}
+        return;
+    }
+
+    if (OS_boolTraceDumpRequested && (UART_ui32TxFree() >= OS_TRACE_HEADER_LEN)) {
+        OS_boolTraceDumpRequested = false;
+        OS_voidTraceExportBegin(UART_SendMessage);
+    }
+    // One JSON line per event; returns false at once when no export is in progress
+    while ((UART_ui32TxFree() >= OS_TRACE_LINE_LEN) && OS_boolTraceExportStep()) {}
 }
 void OS_voidECU1SendRemoteFrame(void) {
-    tCANMsgObject msgObject;
-
-    // Configure the message object for remote frame
-    msgObject.ui32MsgID = CAN_REMOTE_ID;              // ID for the known voltage request
-    msgObject.ui32MsgIDMask = 0;             // No mask for transmission
-    msgObject.ui32Flags = MSG_OBJ_REMOTE_FRAME; // Remote frame flag
-    msgObject.ui32MsgLen = 0;                // No data for a remote request
-
-    // Send the remote frame
-    CANMessageSet(CAN_BASE, CAN_REMOTE_OBJ, &msgObject, MSG_OBJ_TYPE_TX_REMOTE);
+    // Request the known voltage; ECU2 answers with a VOLTAGE frame
+    CAN_SendRemote(CAN_ID_VOLTAGE);
 
 //    // Check transmission status
 //    uint32_t status = CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
@@ -155,44 +362,42 @@ void OS_voidECU1SendRemoteFrame(void) {
 }
 
 void OS_voidCANHandleReceivedMessages(void) {
-    uint8_t receivedData[8];
-    tCANMsgObject msgObject;
-
-    // Temporary storage for message data
-    msgObject.pui8MsgData = receivedData;
+    CAN_Frame_t stFrame;
+    uint8_t ui8Voltage = 0;
+    float fTemperature = 0;
 
-    // Check Message Object 2 (Temperature data)
-    CANMessageGet(CAN_BASE, CAN_TEMP_OBJ, &msgObject, true);
+    // Every frame CAN_handler queued since the last release, oldest first
+    while (CAN_Receive(&stFrame)) {
 
-
-    if (msgObject.ui32Flags & MSG_OBJ_NEW_DATA) {
-
-        if(msgObject.ui32MsgID == CAN_REMOTE_ID)
+        if(stFrame.id == CAN_ID_VOLTAGE)
         {
 //            HAL_voidLedOn(GREEN);
 //            UART_SendNumber(receivedData[0]);
 
-            OS_voidCheckKnownVoltage(receivedData[0]);
+            // The checks are made on whole volts
+            ui8Voltage = (uint8_t)CAN_Unpack_VOLTAGE_SENSOR(stFrame.data);
+            OS_voidCheckKnownVoltage(ui8Voltage);
 
             UART_SendMessage("Voltage ECU1: ");
-            UART_SendNumber(receivedData[0]);
+            UART_SendNumber(ui8Voltage);
             UART_SendMessage("v\r\n");
         }
 
-         if(msgObject.ui32MsgID == CAN_KEEP_ALIVE_ID){
+         if(stFrame.id == CAN_ID_KEEP_ALIVE){
 //             UART_SendNumber(receivedData[0]);
 //             OS_ui32CommLostTimer = 0;
 
         }
-         if (msgObject.ui32MsgID == CAN_TEMP_ID)
+         if (stFrame.id == CAN_ID_TEMPERATURE)
         {
-            static uint8_t OS_ui8TempValue;
-            OS_ui8TempValue = receivedData[0];
-            OS_voidTempData(OS_ui8TempValue);
-            OS_ui32CommLostTimer = 0;
+            fTemperature = CAN_Unpack_TEMPERATURE_AVERAGE(stFrame.data);
+            OS_ui8LastTempValue = (fTemperature > 0.0f) ? (uint8_t)fTemperature : 0U;
+            OS_voidTempData(OS_ui8LastTempValue);
+            OS_voidTimerStart(&OS_stCommLostTimer, COMM_LOST_TIMEOUT_MS);
+            OS_voidTimerStart(&OS_stCommFailureTimer, COMM_FAILURE_TIMEOUT_MS);
             OS_boolBlinkBlueFlag = false;
             OS_boolIncrementCommFlag = false;
-            OS_ui32CommFailure = 0;
+            OS_boolCommFailureFlag = false;
             //OS_voidCheckNormalCondition(OS_ui8TempValue);
 
             //HAL_voidLedOn(RED);
@@ -237,11 +442,39 @@ void OS_voidCANHandleReceivedMessages(void) {
 //    }
 
 }
+// Function to publish the state code: the STATE message goes out when the code changes (with a short burst) and
+// once a second otherwise, however often the tasks report the same state
+static void OS_voidSendState(uint8_t a_ui8State)
+{
+    uint8_t aui8Data[CAN_DLC_STATE] = {0};
+
+    CAN_PackRaw_STATE_CODE(aui8Data, a_ui8State);
+    OS_voidComWrite(CAN_DB_INDEX_STATE, aui8Data);
+}
+
+// Function to decide the state code, the only caller of OS_voidSendState: a stored DTC wins over the temperature
+// state, so a normal TEMPERATURE frame cannot flip STATE back to NORMAL_STATE while a fault is latched
+static void OS_voidUpdateState(void)
+{
+    if(OS_boolDTCFlag){
+        OS_voidSendState(FAULT_STATE);
+    }
+    else if(OS_boolVoltageDTCFlag){
+        OS_voidSendState(UNEXPECTED_VOLTAGE_STATE);
+    }
+    else if(OS_boolCommunicationDTCFlag){
+        OS_voidSendState(COMMUNICATION_LOST_STATE);
+    }
+    else{
+        OS_voidSendState(OS_ui8TempState);
+    }
+}
+
 void OS_voidCheckKnownVoltage(uint8_t Voltage)
 {
-    static uint8_t Overheat[] = {OVERHEAT};
     if(Voltage == 3){
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, Overheat, CAN_DATA_LENGTH);
+        OS_ui8TempState = OVERHEAT;
+        OS_voidUpdateState();
         NVM_voidIncrementDTCCounter();
         OS_boolBlinkWhiteFlag = true;
         //UART_send("OVERHEAT!!\r\n");
@@ -254,21 +487,20 @@ void OS_voidCheckKnownVoltage(uint8_t Voltage)
         g_DTC = 2;  // Set the DTC value
         EEPROMProgram(&g_DTC, EEPROM_DTC_ADDR, sizeof(g_DTC));  // Save DTC to EEPROM
         OS_boolVoltageDTCFlag = true;
+        OS_voidUpdateState();
     }
 }
 void OS_voidCheckNormalCondition(uint8_t TempValue)
 {
-    static uint8_t NormalCondition[] = {0x00};
-    static uint8_t Overheat[] = {0x01};
-
-    if(TempValue <= 25)
+    if(TempValue <= OVERHEAT_THRESHOLD_DEGC)
     {
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, NormalCondition, CAN_DATA_LENGTH);
+        OS_ui8TempState = NORMAL_STATE;
     }
     else
     {
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, Overheat, CAN_DATA_LENGTH);
+        OS_ui8TempState = OVERHEAT;
     }
+    OS_voidUpdateState();
 }
 
 void OS_voidCheckOverheat(void)
@@ -276,16 +508,20 @@ void OS_voidCheckOverheat(void)
 
     if(OS_boolBlinkWhiteFlag)
     {
-        if(OS_ui32BlinkTimer >= 20000 && !OS_boolDTCFlag && !OS_boolVoltageDTCFlag && !OS_boolBlinkBlueFlag)
+        // OS_voidBlinkWhiteTimeout ends the indication
+        if(!OS_boolTimerIsActive(&OS_stBlinkWhiteTimer))
         {
-            OS_boolBlinkWhiteFlag = false;
+            OS_voidTimerStart(&OS_stBlinkWhiteTimer, BLINK_TIMEOUT_MS);
         }
         UartState = OVERHEAT;
         HAL_voidLedBlink(WHITE);
     }
     else if(!OS_boolBlinkWhiteFlag && !OS_boolDTCFlag && !OS_boolVoltageDTCFlag && !OS_boolBlinkBlueFlag){
-        HAL_voidLedOff(WHITE);
-        OS_ui32BlinkTimer = 0;
+        if(!OS_boolTesterModeFlag)
+        {
+            HAL_voidLedOff(WHITE);
+        }
+        OS_voidTimerStop(&OS_stBlinkWhiteTimer);
     }
 
 
@@ -293,35 +529,28 @@ void OS_voidCheckOverheat(void)
 
 void OS_voidTempData(uint8_t TempValue)
 {
-    uint8_t OS_ui8OverheatThreshold = 25;
-    static uint8_t NormalCondition[] = {NORMAL_STATE};
-
-
-
-    if(TempValue > OS_ui8OverheatThreshold)
+    // The remote frame of a confirmed overheat is sent by OS_voidOverheatJob
+    if(TempValue > OVERHEAT_THRESHOLD_DEGC)
     {
         if(OS_boolBlinkWhiteFlag)
         {
-            OS_ui32DTCTimer = 0;
+            // Overheat already indicated: confirm again once the indication ends
+            OS_voidTimerStop(&OS_stDTCTimer);
+            OS_boolOverheatConfirmed = false;
         }
-
-        if(OS_ui32DTCTimer >= 3000)
+        else if(!OS_boolOverheatConfirmed && !OS_boolTimerIsActive(&OS_stDTCTimer))
         {
-            OS_voidECU1SendRemoteFrame();
-            //OS_ui8OverheatDTCCounter++;
-
-//            CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, Overheat, CAN_DATA_LENGTH);
-//            NVM_voidIncrementDTCCounter();
-//            OS_boolBlinkWhiteFlag = true;
-//            UART_send("OVERHEAT!!\r\n");
+            OS_voidTimerStart(&OS_stDTCTimer, DTC_CONFIRM_TIME_MS);
         }
     }
     else
     {
         UartState = NORMAL_STATE;
 
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, NormalCondition, CAN_DATA_LENGTH);
-        OS_ui32DTCTimer = 0;
+        OS_ui8TempState = NORMAL_STATE;
+        OS_voidUpdateState();
+        OS_voidTimerStop(&OS_stDTCTimer);
+        OS_boolOverheatConfirmed = false;
     }
 
 
@@ -336,9 +565,6 @@ void OS_voidTempData(uint8_t TempValue)
 
 void OS_voidCheckDTC(void)
 {
-    static uint8_t FaultState[] = {FAULT_STATE};
-    static uint8_t UnexpectedVoltage[] = {UNEXPECTED_VOLTAGE_STATE};
-    static uint8_t CommunicationLost[] = {COMMUNICATION_LOST_STATE};
     static uint8_t ui8faultcounter = 0;
     static uint8_t ui8voltagecounter = 0;
     static uint8_t ui8communicationcounter = 0;
@@ -347,7 +573,6 @@ void OS_voidCheckDTC(void)
     if(OS_boolDTCFlag){
         UartState = FAULT_STATE;
         //UART_send("Fault State\r\n");
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, FaultState, CAN_DATA_LENGTH);
         HAL_voidLedOff(GREEN);
         HAL_voidLedBlink(RED);
         OS_boolBlinkWhiteFlag = false;
@@ -361,7 +586,6 @@ void OS_voidCheckDTC(void)
     else if(OS_boolVoltageDTCFlag){
         UartState = SENSOR_DAMAGED;
         //UART_send("Unexpected voltage\r\n");
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, UnexpectedVoltage, CAN_DATA_LENGTH);
         HAL_voidLedBlink(RED);
         OS_boolBlinkWhiteFlag = false;
 
@@ -373,7 +597,6 @@ void OS_voidCheckDTC(void)
     else if(OS_boolCommunicationDTCFlag){
         UartState = COMMUNICATION_LOST_STATE;
         //UART_send("Communication lost state\r\n");
-        CAN_SendMessage(CAN_STATE_ID, CAN_STATE_OBJ, CommunicationLost, CAN_DATA_LENGTH);
         HAL_voidLedBlink(RED);
         OS_boolBlinkWhiteFlag = false;
 
@@ -388,6 +611,8 @@ void OS_voidCheckDTC(void)
         ui8communicationcounter = 0;
         CANEnable(CAN_BASE);
     }
+
+    OS_voidUpdateState();
 }
 void processTesterCommand(uint32_t command) {
 
@@ -427,8 +652,9 @@ void processTesterCommand(uint32_t command) {
         UART_SendMessage("Testing GPIO on ECU 2...\r\n");
 
         // Example: Send GPIO toggle command to ECU 2
-        uint8_t gpioCommand[1] = {GPIO_ON};  // Toggle GPIO
-        CAN_SendMessage(CAN_GPIO_CONTROL_ID, CAN_GPIO_CONTROL_OBJ, gpioCommand, CAN_DATA_LENGTH);
+        uint8_t gpioCommand[CAN_DLC_GPIO_CONTROL] = {0};
+        CAN_PackRaw_GPIO_CONTROL_COMMAND(gpioCommand, GPIO_ON);  // Toggle GPIO
+        (void)CAN_Send(CAN_ID_GPIO_CONTROL, gpioCommand, CAN_DLC_GPIO_CONTROL);
         break;
     }
 
@@ -445,15 +671,208 @@ void processTesterCommand(uint32_t command) {
         break;
     }
 
+    case CMD_TASK_STATS:{
+        UART_SendMessage("Task Timing Statistics (cycles):\r\n");
+        OS_boolStatsDumpActive = true;      // Printed by OS_voidTesterOutput
+        break;
+    }
+
+    case CMD_TRACE_DUMP:{
+        // Written by OS_voidTesterOutput; save the output as .json for chrome://tracing
+        OS_boolTraceDumpRequested = true;
+        break;
+    }
+
     default:
         UART_SendMessage("Invalid Command\r\n");
         break;
     }
 }
 
-void OS_voidEnterTesterMode(void) {
+/***********************************************
+ * Function Name: OS_ui8DumpTaskStats
+ * Inputs: OS_Coroutine *a_ptrCr - Coroutine state
+ * Outputs: uint8_t - OS_CR_WAITING while lines are left, OS_CR_ENDED after the last one
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Asynch
+ * Description: Prints one line per registered task with the timing statistics
+ *              recorded by the dispatcher: run count, min/mean/max execution
+ *              time, worst release jitter (all in CPU cycles), the number of
+ *              missed deadlines and the worst-case response time computed from
+ *              the measured maxima, followed by the uptime from the time base,
+ *              the CPU utilisation and the
+ *              schedulability verdict of the task table, and the statistics of
+ *              the deferred-work level (worst post-to-start latency, longest
+ *              job, dropped posts, bus-off count), the CAN receive counters
+ *              (frames, controller overruns, frames dropped on a full RX ring),
+ *              the CAN transmit statistics (frames, current and peak queue
+ *              depth, mean and worst send-to-TXOK latency in cycles, frames
+ *              re-queued and dropped) and the measured cost of one trace event. Each task line also shows the
+ *              deepest stack use of the task, and the last line the RAM budget:
+ *              .data and .bss sizes and the stack high-water mark against the
+ *              stack size, flagged LOW under OS_STACK_WARN_HEADROOM bytes free.
+ *              Each line waits until the UART TX ring has room for
+ *              OS_TESTER_LINE_MAX characters, so no write ever blocks.
+ ***********************************************/
+uint8_t OS_ui8DumpTaskStats(OS_Coroutine *a_ptrCr)
+{
+    static uint8_t i = 0;
+    static uint32_t ui32TickCycles = 0;
+    static uint32_t ui32BlockingCycles = 0;
+    const TaskControlBlock *ptrTask = 0;
+    uint32_t ui32Response = 0;
+    DeferredStats stDeferred;
+    CAN_RxCounters_t stCanRx;
+    CAN_TxStats_t stCanTx;
+    ComStats stComState;
+    RamBudget stRam;
+
+    OS_CR_BEGIN(a_ptrCr);
+
+    ui32TickCycles = SYSTICK_ui32TickCycles();
+    ui32BlockingCycles = OS_RTA_BLOCKING_US * (SysCtlClockGet() / 1000000U);
+
+    for (i = 0; i < OS_TASK_COUNT; i++) {
+        OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+        ptrTask = &taskList[i];
+        UART_SendMessage("P");
+        UART_SendNumber(OS_stTaskTable[i].priority);
+        UART_SendMessage(" runs=");
+        UART_SendNumber(ptrTask->stats.runCount);
+        UART_SendMessage(" min=");
+        UART_SendNumber((ptrTask->stats.runCount != 0U) ? ptrTask->stats.minCycles : 0U);
+        UART_SendMessage(" mean=");
+        UART_SendNumber(OS_ui32TaskMeanCycles(ptrTask));
+        UART_SendMessage(" max=");
+        UART_SendNumber(ptrTask->stats.maxCycles);
+        UART_SendMessage(" jitter=");
+        UART_SendNumber(ptrTask->stats.maxJitterCycles);
+        UART_SendMessage(" missed=");
+        UART_SendNumber(ptrTask->stats.missedDeadlines);
+        UART_SendMessage(" stack=");
+        UART_SendNumber(ptrTask->stats.maxStackBytes);
+        ui32Response = OS_ui32TaskResponseCycles(i, ui32TickCycles, ui32BlockingCycles);
+        if (ui32Response == OS_RESPONSE_UNBOUNDED) {
+            UART_SendMessage(" resp=OVERRUN");
+        } else {
+            UART_SendMessage(" resp=");
+            UART_SendNumber(ui32Response);
+        }
+        UART_SendMessage("\r\n");
+    }
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    UART_SendMessage("Uptime: ");
+    UART_SendNumber(OS_ui32UsToSeconds(OS_ui64TimeUs()));
+    UART_SendMessage(" s\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    UART_SendMessage("Utilization: ");
+    UART_SendNumber(OS_ui32UtilizationPermille(ui32TickCycles));
+    UART_SendMessage(OS_boolIsSchedulable(ui32TickCycles, ui32BlockingCycles) ? " permille, schedulable\r\n"
+                                                                               : " permille, NOT schedulable\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    OS_voidDeferredGetStats(&stDeferred);
+    UART_SendMessage("Deferred jobs=");
+    UART_SendNumber(stDeferred.runCount);
+    UART_SendMessage(" latency=");
+    UART_SendNumber(stDeferred.maxLatencyCycles);
+    UART_SendMessage(" max=");
+    UART_SendNumber(stDeferred.maxRunCycles);
+    UART_SendMessage(" dropped=");
+    UART_SendNumber(stDeferred.overflowCount);
+    UART_SendMessage(" busoff=");
+    UART_SendNumber(OS_ui32BusOffCount);
+    UART_SendMessage("\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    CAN_GetRxCounters(&stCanRx);
+    UART_SendMessage("CAN RX frames=");
+    UART_SendNumber(stCanRx.received);
+    UART_SendMessage(" overruns=");
+    UART_SendNumber(stCanRx.overruns);
+    UART_SendMessage(" dropped=");
+    UART_SendNumber(stCanRx.dropped);
+    UART_SendMessage(" rejected=");
+    UART_SendNumber(stCanRx.rejected);
+    UART_SendMessage("\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    CAN_GetTxStats(&stCanTx);
+    UART_SendMessage("CAN TX frames=");
+    UART_SendNumber(stCanTx.sent);
+    UART_SendMessage(" depth=");
+    UART_SendNumber(stCanTx.depth);
+    UART_SendMessage("/");
+    UART_SendNumber(stCanTx.maxDepth);
+    UART_SendMessage(" latency=");
+    UART_SendNumber(stCanTx.meanLatencyCycles);
+    UART_SendMessage(" max=");
+    UART_SendNumber(stCanTx.maxLatencyCycles);
+    UART_SendMessage(" requeued=");
+    UART_SendNumber(stCanTx.requeued);
+    UART_SendMessage(" dropped=");
+    UART_SendNumber(stCanTx.dropped);
+    UART_SendMessage("\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    OS_voidComGetStats(CAN_DB_INDEX_STATE, &stComState);
+    UART_SendMessage("COM STATE written=");
+    UART_SendNumber(stComState.written);
+    UART_SendMessage(" sent=");
+    UART_SendNumber(stComState.sent);
+    UART_SendMessage(" maxDelay=");
+    UART_SendNumber(stComState.maxDelayTicks);
+    UART_SendMessage(" ms\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    UART_SendMessage("Trace cost=");
+    UART_SendNumber(OS_ui32TraceCostCycles());
+    UART_SendMessage((OS_ui32TraceCostCycles() > OS_TRACE_COST_BUDGET) ? " cycles/event, OVER BUDGET\r\n"
+                                                                       : " cycles/event\r\n");
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, UART_ui32TxFree() >= OS_TESTER_LINE_MAX);
+    OS_voidGetRamBudget(&stRam);
+    UART_SendMessage("RAM data=");
+    UART_SendNumber(stRam.dataBytes);
+    UART_SendMessage(" bss=");
+    UART_SendNumber(stRam.bssBytes);
+    UART_SendMessage(" stack=");
+    UART_SendNumber(stRam.stackPeakBytes);
+    UART_SendMessage("/");
+    UART_SendNumber(stRam.stackBytes);
+    UART_SendMessage(((stRam.stackBytes - stRam.stackPeakBytes) < OS_STACK_WARN_HEADROOM) ? " LOW\r\n" : "\r\n");
+
+    OS_CR_END(a_ptrCr);
+}
+
+/***********************************************
+ * Function Name: OS_ui8EnterTesterMode
+ * Inputs: OS_Coroutine *a_ptrCr - Coroutine state
+ * Outputs: uint8_t - OS_CR_WAITING while the session is open, OS_CR_ENDED on exit
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Asynch
+ * Description: Waits for both buttons, blinks the white LED twice, then
+ *              serves tester commands from UART0 until CMD_EXIT_MODE or both
+ *              buttons are pressed again, and blinks twice on exit. Yields
+ *              after every pass instead of looping, one pass per task release.
+ ***********************************************/
+uint8_t OS_ui8EnterTesterMode(OS_Coroutine *a_ptrCr)
+{
+    static OS_Coroutine stBlinkCr = OS_CR_INITIALIZER;
+    static uint8_t command = 0;
+    static uint8_t OS_ui8count = 0;
+    static uint8_t currentTemp = 0;
+
+    OS_CR_BEGIN(a_ptrCr);
+
+    OS_CR_WAIT_UNTIL(a_ptrCr, BUTTONS_rightButton() && BUTTONS_leftButton());
+    UART_SendMessage("Entering Tester Mode...\r\n");
+    OS_boolTesterModeFlag = true;
+
     // Blink white LED twice to indicate entering Tester Mode
-    OS_voidblinkWhiteLedTwice();
+    OS_CR_SPAWN(a_ptrCr, &stBlinkCr, OS_ui8BlinkWhiteLedTwice(&stBlinkCr));
     CANEnable(CAN_BASE);
 
     UART_SendMessage("Entering Tester Mode. Send commands:\r\n");
@@ -463,19 +882,14 @@ void OS_voidEnterTesterMode(void) {
     UART_SendMessage("4: Test GPIO ECU2\r\n");
     UART_SendMessage("5: Test GPIO ECU1\r\n");
     UART_SendMessage("6: Exit Tester Mode\r\n");
+    UART_SendMessage("7: Task Timing Statistics\r\n");
+    UART_SendMessage("8: Trace Dump (Chrome trace JSON)\r\n");
     UART_SendMessage("Press both buttons to exit Tester Mode.\r\n");
 
-    uint32_t command;
-
     while (1) {
 
-        static uint8_t OS_ui8count = 0;
-        static uint8_t currentTemp = 0;
-
-
         // Check for incoming commands
-        if (UARTCharsAvail(UART0_BASE)) {
-            command = UARTCharGet(UART0_BASE);  // Get the command
+        if (OS_boolSpscPop(&OS_stUartRxRing, &command)) {
             processTesterCommand(command);
 
 
@@ -486,11 +900,9 @@ void OS_voidEnterTesterMode(void) {
             }
         }
 
+        // The keep-alive task keeps ECU2 answering while the session is open
         if(OS_boolReadSensorFlag)
         {
-            static uint8_t keepAliveData[1] = {0xAA}; // Example data
-            CAN_SendMessage(CAN_KEEP_ALIVE_ID, CAN_KEEP_ALIVE_OBJ, keepAliveData, CAN_DATA_LENGTH);
-
             currentTemp = OS_voidReceiveTesterMode();
 
             OS_ui8count++;
@@ -511,61 +923,51 @@ void OS_voidEnterTesterMode(void) {
             break;
         }
 
+        OS_CR_YIELD(a_ptrCr);
     }
 
     // Blink white LED twice to indicate exiting Tester Mode
-    OS_voidblinkWhiteLedTwice();
+    OS_CR_SPAWN(a_ptrCr, &stBlinkCr, OS_ui8BlinkWhiteLedTwice(&stBlinkCr));
+    OS_boolTesterModeFlag = false;
 
     UART_SendMessage("Exited Tester Mode\r\n");
+
+    OS_CR_END(a_ptrCr);
 }
 uint8_t OS_voidReceiveTesterMode(void)
 {
-    uint8_t receivedData[8];
-    tCANMsgObject msgObject;
-    static uint8_t temperature = 0;
-
-    // Temporary storage for message data
-    msgObject.pui8MsgData = receivedData;
-
-    // Check Message Object 2 (Temperature data)
-    CANMessageGet(CAN_BASE, CAN_TEMP_OBJ, &msgObject, true);
-
-
-    if (msgObject.ui32Flags & MSG_OBJ_NEW_DATA) {
+    // OS_voidCANHandleReceivedMessages is the only reader of the CAN RX ring and keeps the last temperature
+    return OS_ui8LastTempValue;
+}
+/***********************************************
+ * Function Name: OS_ui8BlinkWhiteLedTwice
+ * Inputs: OS_Coroutine *a_ptrCr - Coroutine state
+ * Outputs: uint8_t - OS_CR_WAITING while blinking, OS_CR_ENDED after 2 seconds
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Asynch
+ * Description: Blinks the white LED twice over 2 seconds (500 ms on, 500 ms
+ *              off), sleeping between toggles instead of busy-waiting.
+ ***********************************************/
+uint8_t OS_ui8BlinkWhiteLedTwice(OS_Coroutine *a_ptrCr)
+{
+    static uint8_t ui8Toggle = 0;
 
-        if(msgObject.ui32MsgID == CAN_TEMP_ID)
-        {
-            temperature = receivedData[0];
-        }
-    }
+    OS_CR_BEGIN(a_ptrCr);
 
-    return temperature;
-}
-void OS_voidblinkWhiteLedTwice(void) {
-    OS_ui32TesterTimer = 0;  // Reset the timer
-
-    // Local variables to manage blinking
-    uint32_t lastToggleTime = 0;
-    bool ledState = false;  // Track the current LED state (on/off)
-
-    // Blink for 2 seconds
-    while (OS_ui32TesterTimer <= 2000) {
-        // Check if 500ms has elapsed since the last toggle
-        if ((OS_ui32TesterTimer - lastToggleTime) >= 500) {
-            lastToggleTime = OS_ui32TesterTimer;  // Update the last toggle time
-
-            // Toggle the LED state
-            if (ledState) {
-                HAL_voidLedOff(WHITE);  // Turn off the LED
-            } else {
-                HAL_voidLedOn(WHITE);   // Turn on the LED
-            }
-            ledState = !ledState;  // Flip the LED state
+    for (ui8Toggle = 0; ui8Toggle < 4U; ui8Toggle++) {
+        // Toggle the LED state
+        if ((ui8Toggle % 2U) == 0U) {
+            HAL_voidLedOn(WHITE);   // Turn on the LED
+        } else {
+            HAL_voidLedOff(WHITE);  // Turn off the LED
         }
+        OS_CR_SLEEP_FOR(a_ptrCr, 500);
     }
 
     // Ensure the LED is off at the end of blinking
     HAL_voidLedOff(WHITE);
+
+    OS_CR_END(a_ptrCr);
 }
 
 void OS_voidCheckRXOK(void)
@@ -603,6 +1005,8 @@ void OS_voidECU1ReceiveVoltageResponse(void) {
  *              This ensures the system is set up and ready for operation.
  ***********************************************/
 void OS_voidInit(void) {
+    OS_voidDeferredInit(); // Deferred-work level, before the interrupts that post to it
+    OS_voidTimeBaseInit(); // 64-bit time base, before the first timestamp
     OS_voidMCALInit(); // Initialize the Microcontroller Abstraction Layer
     OS_voidHALInit();  // Initialize the Hardware Abstraction Layer
     initializeEEPROM();
@@ -637,10 +1041,14 @@ void OS_voidMCALInit(void)
         CAN_Init();
         //CAN_ReceiveInit();
         CAN_ConfigureReceiveObjects();
+        CAN_SetReceiveHook(OS_voidCanReceiveHook);
     #endif
 
     #if configUSE_UART
         UART_Init();
+        OS_voidSpscInit(&OS_stUartRxRing, OS_ui8UartRxBuffer, sizeof(OS_ui8UartRxBuffer[0]), UART_RX_RING_LEN);
+        UART_EnableRxInterrupt();
+        UART_EnableTxInterrupt();
     #endif
 
 //    #if configUSE_EEPROM
@@ -678,97 +1086,279 @@ void OS_voidHALInit(void)
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
- * Description: The scheduler function manages the overall state transitions
- *              and handles communication between different system components.
- *              It checks buttons, controls system states, handles CAN communication,
- *              UART control, and monitors communication status.
+ * Description: Runs the callbacks of the expired software timers, then the
+ *              tasks that the SysTick tick service marked ready in the
+ *              dispatcher bitmap, highest priority first. Selecting the
+ *              next task costs the same regardless of how many tasks are
+ *              registered, so there is no per-call scan of `taskList`.
  ***********************************************/
 void APP_voidScheduler(void)
 {
-    uint32_t currentTick = g_ui32SysTickCount;
-    uint8_t highestPriorityIndex = MAX_TASKS;
-    uint8_t i = 0;
-    for ( i = 0; i < ui8taskCount; i++) {
-        if (taskList[i].isEnabled && taskList[i].state == TASK_READY) {
-            // Check if the task is ready to run
-            if ((currentTick - taskList[i].lastRunTick) >= taskList[i].periodTicks) {
-
-                if (highestPriorityIndex == MAX_TASKS ||
-                    taskList[i].priority < taskList[highestPriorityIndex].priority) {
-                    highestPriorityIndex = i;
-                }
-            }
-        }
+    OS_voidSchedulerPass();
+
+    // No task is ready: sleep until the next release
+    OS_voidIdleTask();
+}
+
+/***********************************************
+ * Function Name: OS_voidSchedulerPass
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: One pass of the scheduler loop without the idle sleep: the
+ *              expired software timers, then the ready tasks. A pass that
+ *              finds neither is idle time; it is counted here and converted
+ *              to cycles with the cost measured by OS_voidCalibrateIdlePass,
+ *              so the load figure also covers the time the loop spins
+ *              without sleeping. The check is not atomic with the pass; a
+ *              release in between misclassifies one pass, which only moves
+ *              the figure by one pass cost.
+ ***********************************************/
+void OS_voidSchedulerPass(void)
+{
+    if ((OS_ui8HighestReadyTask() == OS_NO_TASK) && (OS_ui32TicksToNextExpiry() != 0U)) {
+        OS_ui32IdlePasses++;
     }
+    OS_voidTimerService();
+    OS_voidDispatch();
+}
 
-    // Execute the highest-priority task, if any
-    if (highestPriorityIndex < MAX_TASKS) {
-        taskList[highestPriorityIndex].state = TASK_RUNNING;
-        taskList[highestPriorityIndex].taskFunction();
-        taskList[highestPriorityIndex].lastRunTick = currentTick;
-        taskList[highestPriorityIndex].state = TASK_READY;
-    } else {
-        // Run idle task if no tasks are ready
-        //OS_IdleTask();
+/***********************************************
+ * Function Name: OS_voidCalibrateIdlePass
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Measures the cost of an idle scheduler pass with the
+ *              dispatcher cycle counter, averaged over
+ *              OS_LOAD_CALIBRATION_RUNS passes with interrupts masked. Call
+ *              after OS_voidDispatcherInit, before the first release, when
+ *              every pass is idle.
+ ***********************************************/
+void OS_voidCalibrateIdlePass(void)
+{
+    uint32_t i = 0;
+    uint32_t ui32Begin = 0;
+    bool boolMasked = IntMasterDisable();
+
+    ui32Begin = OS_CYCLE_COUNT();
+    for (i = 0; i < OS_LOAD_CALIBRATION_RUNS; i++) {
+        OS_voidSchedulerPass();
     }
+    OS_ui32IdlePassCycles = (OS_CYCLE_COUNT() - ui32Begin) / OS_LOAD_CALIBRATION_RUNS;
+    OS_ui32IdlePasses = 0;
 
-    // If no tasks are ready, run the idle task
-    //OS_IdleTask();
-}
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority) {
-    if (ui8taskCount < MAX_TASKS) {
-        taskList[ui8taskCount].taskFunction = taskFunction;
-        taskList[ui8taskCount].periodTicks = periodTicks;
-        taskList[ui8taskCount].lastRunTick = 0;  // Initialize last run to 0
-        taskList[ui8taskCount].priority = priority;
-        taskList[ui8taskCount].isEnabled = 1;    // Enable by default
-        taskList[ui8taskCount].state = TASK_READY; // Set state to READY
-        ui8taskCount++;
+    if (!boolMasked) {
+        IntMasterEnable();
     }
 }
 
-void OS_voidSortTasksByPriority(void) {
-    uint8_t i = 0;
-    uint8_t j = 0;
-    for (i = 0; i < ui8taskCount - 1; i++) {
-        for (j = i + 1; j < ui8taskCount; j++) {
-            if (taskList[i].priority > taskList[j].priority) {
-                TaskControlBlock temp = taskList[i];
-                taskList[i] = taskList[j];
-                taskList[j] = temp;
-            }
-        }
+/***********************************************
+ * Function Name: OS_voidIdleTask
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Runs when the dispatcher has no ready task. With configUSE_TICKLESS_IDLE
+ *              the periodic tick is suppressed and the core sleeps in WFI until the
+ *              earliest task release or software timer expiry. Interrupts are masked while the deadline is
+ *              computed so that a release cannot slip in before the WFI; the masked
+ *              interrupt still wakes the core and is serviced on unmasking. The
+ *              cycles spent asleep feed the CPU load figure.
+ ***********************************************/
+void OS_voidIdleTask(void)
+{
+#if configUSE_TICKLESS_IDLE
+    uint32_t ui32Ticks = 0;
+    uint32_t ui32TimerTicks = 0;
+
+    IntMasterDisable();
+    ui32Ticks = OS_ui32TicksToNextRelease();
+    ui32TimerTicks = OS_ui32TicksToNextExpiry();
+    if (ui32TimerTicks < ui32Ticks) {
+        ui32Ticks = ui32TimerTicks;
     }
+    if (ui32Ticks != 0U) {
+        OS_ui32IdleCycles += SYSTICK_ui32Sleep(ui32Ticks);
+    }
+    IntMasterEnable();
+#endif
 }
 
+/***********************************************
+ * Function Name: OS_voidReportCpuLoad
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Takes one CPU load sample every OS_LOAD_SAMPLE_TICKS: the share of
+ *              SysTick cycles of the window since the previous call not spent idle
+ *              (in the tickless sleep or in idle scheduler passes). The samples
+ *              feed an exponential average and a peak; every
+ *              OS_LOAD_SAMPLES_PER_REPORT samples the last sample, the average
+ *              and the peak are reported on UART (with the calibrated cost of
+ *              an idle pass, to check the calibration on the bench) and in
+ *              the ECU1_CPU_LOAD frame, and the peak restarts.
+ ***********************************************/
+void OS_voidReportCpuLoad(void)
+{
+    uint32_t ui32Now = g_ui32SysTickCount;
+    uint32_t ui32WindowCycles = (ui32Now - OS_ui32LoadWindowStart) * SYSTICK_ui32TickCycles();
+    uint32_t ui32IdlePercent = 0;
+    uint32_t ui32Idle = 0;
+    uint8_t ui8LoadData[CAN_DLC_ECU1_CPU_LOAD] = {0};
+
+    if (ui32WindowCycles == 0U) {
+        return;
+    }
+
+    ui32Idle = OS_ui32IdleCycles + (OS_ui32IdlePasses * OS_ui32IdlePassCycles);
+    ui32IdlePercent = ui32Idle / ((ui32WindowCycles / 100U) + 1U);
+    if (ui32IdlePercent > 100U) {
+        ui32IdlePercent = 100U;
+    }
+    OS_ui8CpuLoad = (uint8_t)(100U - ui32IdlePercent);
+    OS_ui32IdleCycles = 0;
+    OS_ui32IdlePasses = 0;
+    OS_ui32LoadWindowStart = ui32Now;
+
+    // Average over about 2^OS_LOAD_SMOOTHING_SHIFT samples, kept in 1/16 % so that low loads do not round away
+    OS_ui32CpuLoadSmoothedX16 = OS_ui32CpuLoadSmoothedX16 - (OS_ui32CpuLoadSmoothedX16 >> OS_LOAD_SMOOTHING_SHIFT)
+                              + (((uint32_t)OS_ui8CpuLoad << 4U) >> OS_LOAD_SMOOTHING_SHIFT);
+    if (OS_ui8CpuLoad > OS_ui8CpuLoadPeak) {
+        OS_ui8CpuLoadPeak = OS_ui8CpuLoad;
+    }
+    OS_ui32LoadSamples++;
+    if (OS_ui32LoadSamples < OS_LOAD_SAMPLES_PER_REPORT) {
+        return;
+    }
+    OS_ui32LoadSamples = 0;
+    OS_ui8CpuLoadSmoothed = (uint8_t)((OS_ui32CpuLoadSmoothedX16 + 8U) >> 4U);
+
+    UART_SendMessage("CPU load: ");
+    UART_SendNumber(OS_ui8CpuLoad);
+    UART_SendMessage("% avg ");
+    UART_SendNumber(OS_ui8CpuLoadSmoothed);
+    UART_SendMessage("% peak ");
+    UART_SendNumber(OS_ui8CpuLoadPeak);
+    UART_SendMessage("% (idle pass ");
+    UART_SendNumber(OS_ui32IdlePassCycles);
+    UART_SendMessage(" cycles)\r\n");
+
+    CAN_PackRaw_ECU1_CPU_LOAD_LAST(ui8LoadData, OS_ui8CpuLoad);
+    CAN_PackRaw_ECU1_CPU_LOAD_SMOOTHED(ui8LoadData, OS_ui8CpuLoadSmoothed);
+    CAN_PackRaw_ECU1_CPU_LOAD_PEAK(ui8LoadData, OS_ui8CpuLoadPeak);
+    (void)CAN_Send(CAN_ID_ECU1_CPU_LOAD, ui8LoadData, CAN_DLC_ECU1_CPU_LOAD);
+    OS_ui8CpuLoadPeak = 0;
+}
 
+/***********************************************
+ * Function Name: OS_voidInitTasks
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Hands the const task table and the run-time task list to the
+ *              dispatcher. The table is generated from OS_TASK_TABLE and
+ *              already sorted by priority, so slot order is priority order
+ *              and nothing is built or sorted at startup. Then starts the
+ *              transmission manager with the keep-alive cycle, the trace
+ *              recorder (configUSE_TRACE), the watchdog manager, and
+ *              reports on UART a supervision failure that caused the previous
+ *              reset.
+ ***********************************************/
 void OS_voidInitTasks(void) {
+#if configUSE_WATCHDOG
+    WdgMRecord stRecord;
+#endif
 
-    OS_voidAddTask(OS_voidTesterMode , 200 , 1);
-    OS_voidAddTask(OS_voidCheckDTC , 200 , 2);
-    OS_voidAddTask(OS_voidECU1SendKeepAlive , 100 , 3);
-    OS_voidAddTask(OS_voidCANHandleReceivedMessages , 200 , 4);
-    OS_voidAddTask(OS_voidCheckOverheat , 200 , 5);
-    OS_voidAddTask(OS_voidHeartbeatError , 200 , 6);
-    OS_voidAddTask(APP_voidUartControl , 200 , 7);
+    OS_voidDispatcherInit(OS_stTaskTable, taskList, (uint8_t)OS_TASK_COUNT, g_ui32SysTickCount);
+    OS_voidComInit();
+    OS_voidECU1StartKeepAlive();
+    OS_voidCalibrateIdlePass();
 
-    OS_voidSortTasksByPriority();
+#if configUSE_TRACE
+    OS_voidTraceStart();
+#endif
+
+#if configUSE_WATCHDOG
+    OS_voidWdgMInit(taskList, g_ui32SysTickCount);
+    if (OS_boolWdgMLastReset(&stRecord)) {
+        UART_SendMessage("Watchdog reset: task P");
+        UART_SendNumber(stRecord.priority);
+        UART_SendMessage(" not alive for ");
+        UART_SendNumber(stRecord.stuckTicks);
+        UART_SendMessage(" ms, ");
+        UART_SendNumber(OS_ui32UsToSeconds(stRecord.detectedUs));
+        UART_SendMessage(" s after start\r\n");
+    }
+#endif
 }
 
-void OS_voidECU1SendKeepAlive(void) {
+/***********************************************
+ * Function Name: OS_voidInitTimers
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Creates the software timers that replace the free-running
+ *              timeout counters and starts the communication supervision,
+ *              which is restarted by every temperature frame from ECU2.
+ ***********************************************/
+void OS_voidInitTimers(void)
+{
+    OS_voidTimerCreate(&OS_stCommLostTimer, OS_voidCommLostTimeout, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&OS_stCommFailureTimer, OS_voidCommFailureTimeout, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&OS_stBlinkBlueTimer, OS_voidBlinkBlueTimeout, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&OS_stBlinkWhiteTimer, OS_voidBlinkWhiteTimeout, BLINK_RECHECK_MS);
+    OS_voidTimerCreate(&OS_stDTCTimer, OS_voidDTCTimeout, OS_TIMER_ONE_SHOT);
+
+    OS_voidTimerStart(&OS_stCommLostTimer, COMM_LOST_TIMEOUT_MS);
+    OS_voidTimerStart(&OS_stCommFailureTimer, COMM_FAILURE_TIMEOUT_MS);
+}
 
-    if (g_ui32SysTickCount % 100 == 0)
-    {
-        uint8_t keepAliveData[1] = {0xAA}; // Example data
-        CAN_SendMessage(CAN_KEEP_ALIVE_ID, CAN_KEEP_ALIVE_OBJ, keepAliveData, CAN_DATA_LENGTH);
-        //CAN_SendMessage(CAN_KEEP_ALIVE_ID, CAN_KEEP_ALIVE_OBJ, keepAliveData, CAN_DATA_LENGTH);
-    }
+// ECU2 silent for COMM_LOST_TIMEOUT_MS: start the communication-lost indication
+void OS_voidCommLostTimeout(void)
+{
+    OS_boolBlinkBlueFlag = true;
+}
 
-    if(OS_ui32CommLostTimer >= 5000)
+// ECU2 silent for COMM_FAILURE_TIMEOUT_MS: report a communication failure until it answers
+void OS_voidCommFailureTimeout(void)
+{
+    OS_boolCommFailureFlag = true;
+}
+
+// Communication-lost indication shown for BLINK_TIMEOUT_MS: stop it and supervise again
+void OS_voidBlinkBlueTimeout(void)
+{
+    HAL_voidLedOff(BLUE);
+    OS_boolBlinkBlueFlag = false;
+    OS_voidTimerStart(&OS_stCommLostTimer, COMM_LOST_TIMEOUT_MS);
+}
+
+// Overheat indication shown for BLINK_TIMEOUT_MS: stop it once no fault is pending,
+// otherwise check again after BLINK_RECHECK_MS
+void OS_voidBlinkWhiteTimeout(void)
+{
+    if(!OS_boolDTCFlag && !OS_boolVoltageDTCFlag && !OS_boolBlinkBlueFlag)
     {
-        OS_boolBlinkBlueFlag = true;
+        OS_boolBlinkWhiteFlag = false;
+        OS_voidTimerStop(&OS_stBlinkWhiteTimer);
     }
+}
+
+// Temperature above the threshold for DTC_CONFIRM_TIME_MS: request the voltage from ECU2
+void OS_voidDTCTimeout(void)
+{
+    OS_boolOverheatConfirmed = true;
+}
 
+void OS_voidECU1StartKeepAlive(void) {
+    // The first write starts the cycle; OS_voidComMainFunction repeats the frame every 100 ms
+    uint8_t keepAliveData[CAN_DLC_KEEP_ALIVE] = {0}; // Alive counter and checksum only, written by CAN_Send
+    OS_voidComWrite(CAN_DB_INDEX_KEEP_ALIVE, keepAliveData);
 }
 void OS_voidHeartbeatError(void)
 {
@@ -780,11 +1370,10 @@ void OS_voidHeartbeatError(void)
             NVM_voidIncrementCommunicationDTCCounter();
         }
 
-        if(OS_ui32BlinkBlueTimer >= 20000)
+        // OS_voidBlinkBlueTimeout ends the indication
+        if(!OS_boolTimerIsActive(&OS_stBlinkBlueTimer))
         {
-            HAL_voidLedOff(BLUE);
-            OS_boolBlinkBlueFlag = false;
-            OS_ui32CommLostTimer = 0;
+            OS_voidTimerStart(&OS_stBlinkBlueTimer, BLINK_TIMEOUT_MS);
         }
         UartState = COMMUNICATION_LOST_STATE;
         HAL_voidLedBlink(BLUE);
@@ -792,12 +1381,12 @@ void OS_voidHeartbeatError(void)
     else
     {
         HAL_voidLedOff(BLUE);
-        OS_ui32BlinkBlueTimer = 0;
+        OS_voidTimerStop(&OS_stBlinkBlueTimer);
 
     }
 
 
-    if(OS_ui32CommFailure >= 30000)
+    if(OS_boolCommFailureFlag)
     {
         UartState = COMMUNICATION_FAILURE;
     }
@@ -927,13 +1516,17 @@ void APP_voidUartControl(void)
 //        // Update the current UART state
 //        APP_ui32UartCurrentState = UartState;
 //    }
-    if(g_ui32SysTickCount % 1000 == 0)
-    {
-        APP_voidSendToPc(UartState);
-    }else{
+    static uint32_t ui32TracedState = 0xFFFFFFFFUL;
 
+    // Record the reported state on the trace timeline when it changes
+    if (UartState != ui32TracedState) {
+        OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_UART, (uint16_t)UartState);
+        ui32TracedState = UartState;
     }
 
+    // Released every 1000 ms by the dispatcher
+    APP_voidSendToPc(UartState);
+
 
 
 }
@@ -1024,6 +1617,7 @@ void APP_voidCheckCommunication(void)
 void INITIALIZATION_buttons(void)
 {
     BUTTONS_initPortF();
+    BUTTONS_enableInterrupt();
 }
 
 /***********************************************
@@ -36,6 +36,14 @@
 #include "HAL/buttons.h"
 #include "OS/OS_config.h"
 #include "MCAL/NVM/NVM.h"
+#include "OS/swtimer.h"
+#include "OS/deferred.h"
+#include "OS/wdgm.h"
+#include "OS/timebase.h"
+#include "OS/trace.h"
+#include "OS/com.h"
+#include "OS/coroutine.h"
+#include "OS/spsc.h"
 
 
 
@@ -52,13 +60,26 @@
 
 #define GPIO_ON                         0x06
 
+// Software timer intervals (1 ms ticks)
+#define COMM_LOST_TIMEOUT_MS            5000    // No temperature frame before the blue indication
+#define COMM_FAILURE_TIMEOUT_MS         30000   // No temperature frame before COMMUNICATION_FAILURE
+#define BLINK_TIMEOUT_MS                20000   // Length of the white/blue indications
+#define BLINK_RECHECK_MS                200     // Retry interval while a fault keeps the indication on
+#define DTC_CONFIRM_TIME_MS             3000    // Overheat time before the voltage is requested
+
+#define OVERHEAT_THRESHOLD_DEGC         25      // TEMPERATURE average above which ECU2 overheats
+
+// Task activation events, set by the interrupt handlers
+#define OS_EVENT_CAN_RX                 OS_EVENT(0)     // A CAN message object received a frame
+#define OS_EVENT_UART_RX                OS_EVENT(1)     // A character arrived on UART0
+#define OS_EVENT_BUTTON                 OS_EVENT(2)     // SW1 or SW2 was pressed
+
+#define UART_RX_RING_LEN                32U     // Received characters buffered for the tester task; power of two
+#define OS_TESTER_LINE_MAX              160U    // Longest line of a tester report; written only when the TX ring has room
+
 /***********************************************
  * Type Declarations (enums, structs and unions)
  ***********************************************/
-bool recievedFlag;
-bool holdButtonFlag;
-bool sw1; // Right button
-bool sw2; // Left button
 
 extern uint32_t APP_ui32UartCurrentState;
 extern uint8_t APP_ui32counter;
@@ -83,16 +104,18 @@ void APP_voidUartControl(void);
 void APP_voidCheckCommunication(void);
 void APP_voidOS(void);
 void APP_voidScheduler(void);
+void OS_voidSchedulerPass(void);
+void OS_voidCalibrateIdlePass(void);
+void OS_voidIdleTask(void);
+void OS_voidReportCpuLoad(void);
 
 void OS_voidCheckCANCommunication(void);
 void OS_voidInit(void);
 void OS_voidHALInit(void);
 void OS_voidMCALInit(void);
 void OS_voidCanSend(void);
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority);
-void OS_voidSortTasksByPriority(void);
 void OS_voidInitTasks(void);
-void OS_voidECU1SendKeepAlive(void);
+void OS_voidECU1StartKeepAlive(void);
 void OS_voidCANHandleReceivedMessages(void);
 void OS_voidECU1SendRemoteFrame(void);
 void OS_voidECU1ReceiveVoltageResponse(void);
@@ -103,10 +126,21 @@ void OS_voidCheckRXOK(void);
 void OS_voidCheckNormalCondition(uint8_t TempValue);
 void OS_voidCheckDTC(void);
 void OS_voidTesterMode(void);
-void OS_voidEnterTesterMode(void);
+uint8_t OS_ui8EnterTesterMode(OS_Coroutine *a_ptrCr);
+void OS_voidTesterOutput(void);
+uint8_t OS_ui8DumpTaskStats(OS_Coroutine *a_ptrCr);
 void OS_voidCheckKnownVoltage(uint8_t Voltage);
-void OS_voidblinkWhiteLedTwice(void);
+uint8_t OS_ui8BlinkWhiteLedTwice(OS_Coroutine *a_ptrCr);
 void OS_voidHeartbeatError(void);
+void OS_voidInitTimers(void);
+void OS_voidCanErrorJob(void);
+void OS_voidCanReceiveHook(const CAN_Frame_t *frame);
+void OS_voidOverheatJob(void);
+void OS_voidCommLostTimeout(void);
+void OS_voidCommFailureTimeout(void);
+void OS_voidBlinkBlueTimeout(void);
+void OS_voidBlinkWhiteTimeout(void);
+void OS_voidDTCTimeout(void);
 uint8_t OS_voidReceiveTesterMode(void);
 
 void INITIALIZATION_MCAL(void);
@@ -116,8 +150,6 @@ void TIMER1_clearInt(void);
 void SPI_send(uint32_t a_uint32counter);
 void UART_send(const char *array_ptr);
 
-void scheduler(void);
-
 
 
 //void processTesterCommand(uint32_t command);
@@ -0,0 +1,118 @@
+/*
+ * stackmon.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the stack monitor. ResetISR fills .stack with
+ *      OS_STACK_PAINT_PATTERN before the C runtime starts; the stack grows down from __STACK_TOP, so the lowest word
+ *      that no longer holds the pattern marks the deepest use. Around every task run the dispatcher repaints the
+ *      free part below the current frame and measures again, which gives the depth reached by that task (and the
+ *      interrupts taken while it ran) without a separate stack per task.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/stackmon.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+// Linker symbols (tm4c123gh6pm.cmd); only their addresses are meaningful
+extern uint32_t __stack;                    // Lowest word of .stack
+extern uint32_t __STACK_TOP;                // One past the highest word of .stack
+extern uint8_t __DATA_SIZE;                 // Size of .data
+extern uint8_t __BSS_SIZE;                  // Size of .bss
+
+static uint32_t *OS_pui32StackClean = &__stack;     // Every word below this address holds the pattern
+static uint32_t OS_ui32StackPeak = 0;               // Deepest use measured since reset (bytes)
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidStackPaint
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Refills the stack between the last measured depth and the caller's frame with the pattern, keeping
+ *              OS_STACK_PAINT_MARGIN words below the frame untouched. Only the words used since the previous
+ *              measurement are rewritten. An interrupt taken meanwhile uses the area being painted only while it
+ *              runs, so it cannot be overwritten.
+ ***********************************************/
+void OS_voidStackPaint(void)
+{
+    volatile uint32_t ui32Marker = 0;       // Its address approximates the stack pointer
+    uint32_t *pui32Limit = (uint32_t *)&ui32Marker - OS_STACK_PAINT_MARGIN;
+    uint32_t *pui32Word = OS_pui32StackClean;
+
+    while (pui32Word < pui32Limit) {
+        *pui32Word = OS_STACK_PAINT_PATTERN;
+        pui32Word++;
+    }
+    if (OS_pui32StackClean < pui32Limit) {
+        OS_pui32StackClean = pui32Limit;
+    }
+}
+
+/***********************************************
+ * Function Name: OS_ui32StackUsed
+ * Inputs: N/A
+ * Outputs: uint32_t - Deepest stack use since the last OS_voidStackPaint, in bytes from the top of the stack
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Scans up from the bottom of the stack to the first word that lost the pattern and folds the result
+ *              into the high-water mark. A word that happens to be written with the pattern value reads as unused.
+ ***********************************************/
+uint32_t OS_ui32StackUsed(void)
+{
+    uint32_t *pui32Word = &__stack;
+    uint32_t ui32Used = 0;
+
+    while ((pui32Word < &__STACK_TOP) && (*pui32Word == OS_STACK_PAINT_PATTERN)) {
+        pui32Word++;
+    }
+    OS_pui32StackClean = pui32Word;
+
+    ui32Used = (uint32_t)&__STACK_TOP - (uint32_t)pui32Word;
+    if (ui32Used > OS_ui32StackPeak) {
+        OS_ui32StackPeak = ui32Used;
+    }
+    return ui32Used;
+}
+
+/***********************************************
+ * Function Name: OS_ui32StackHighWater
+ * Inputs: N/A
+ * Outputs: uint32_t - Deepest stack use since reset, in bytes
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Measures once more, so use outside the dispatched tasks (the idle path, interrupts between tasks) is
+ *              included, and returns the high-water mark.
+ ***********************************************/
+uint32_t OS_ui32StackHighWater(void)
+{
+    (void)OS_ui32StackUsed();
+    return OS_ui32StackPeak;
+}
+
+/***********************************************
+ * Function Name: OS_voidGetRamBudget
+ * Inputs: RamBudget *a_ptrBudget - Receives the section sizes and the stack high-water mark
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Section sizes come from the linker command file, so they describe the image that is running.
+ ***********************************************/
+void OS_voidGetRamBudget(RamBudget *a_ptrBudget)
+{
+    a_ptrBudget->dataBytes = (uint32_t)&__DATA_SIZE;
+    a_ptrBudget->bssBytes = (uint32_t)&__BSS_SIZE;
+    a_ptrBudget->stackBytes = (uint32_t)&__STACK_TOP - (uint32_t)&__stack;
+    a_ptrBudget->stackPeakBytes = OS_ui32StackHighWater();
+}
@@ -0,0 +1,233 @@
+/*
+ * swtimer.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the OS software timers. Running timers are kept in a list
+ *      sorted by expiry where each entry stores its distance (delta) from the previous one, so only the head has to be
+ *      compared against the elapsed time. The SysTick interrupt just records the current tick; OS_voidTimerService(),
+ *      called from the scheduler loop, removes the expired timers, reloads periodic ones and runs the callbacks in task
+ *      context, where they may use CAN, UART or NVM and start or stop other timers.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/swtimer.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static SoftTimer *OS_ptrTimerHead = 0;             // Earliest expiry first
+static volatile uint32_t OS_ui32TimerNow = 0;      // Last tick published by the tick service
+static uint32_t OS_ui32TimerBase = 0;              // Tick the head delta is counted from
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidTimerInsert
+ * Inputs: SoftTimer *a_ptrTimer - Timer to link (must not be active)
+ *         uint32_t a_ui32Ticks - Ticks from the list base until expiry
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Links the timer behind every timer expiring at or before the same tick, converting its expiry to a
+ *              delta from its predecessor and shortening the successor's delta accordingly.
+ ***********************************************/
+static void OS_voidTimerInsert(SoftTimer *a_ptrTimer, uint32_t a_ui32Ticks)
+{
+    SoftTimer *ptrPrev = 0;
+    SoftTimer *ptrNext = OS_ptrTimerHead;
+
+    while ((ptrNext != 0) && (ptrNext->delta <= a_ui32Ticks)) {
+        a_ui32Ticks -= ptrNext->delta;
+        ptrPrev = ptrNext;
+        ptrNext = ptrNext->next;
+    }
+
+    a_ptrTimer->delta = a_ui32Ticks;
+    a_ptrTimer->prev = ptrPrev;
+    a_ptrTimer->next = ptrNext;
+    a_ptrTimer->isActive = true;
+
+    if (ptrNext != 0) {
+        ptrNext->delta -= a_ui32Ticks;
+        ptrNext->prev = a_ptrTimer;
+    }
+    if (ptrPrev != 0) {
+        ptrPrev->next = a_ptrTimer;
+    } else {
+        OS_ptrTimerHead = a_ptrTimer;
+    }
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerUnlink
+ * Inputs: SoftTimer *a_ptrTimer - Active timer to remove
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Removes the timer from the active list in constant time, handing its delta to the successor so the
+ *              expiry of the remaining timers does not move.
+ ***********************************************/
+static void OS_voidTimerUnlink(SoftTimer *a_ptrTimer)
+{
+    if (a_ptrTimer->next != 0) {
+        a_ptrTimer->next->delta += a_ptrTimer->delta;
+        a_ptrTimer->next->prev = a_ptrTimer->prev;
+    }
+    if (a_ptrTimer->prev != 0) {
+        a_ptrTimer->prev->next = a_ptrTimer->next;
+    } else {
+        OS_ptrTimerHead = a_ptrTimer->next;
+    }
+
+    a_ptrTimer->next = 0;
+    a_ptrTimer->prev = 0;
+    a_ptrTimer->isActive = false;
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerCreate
+ * Inputs: SoftTimer *a_ptrTimer - Timer object (statically allocated by the user)
+ *         void (*a_ptrCallback)(void) - Function called on every expiry
+ *         uint32_t a_ui32ReloadTicks - Interval between expiries once started, or OS_TIMER_ONE_SHOT
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Initialises a stopped timer. The first expiry is set by OS_voidTimerStart.
+ ***********************************************/
+void OS_voidTimerCreate(SoftTimer *a_ptrTimer, void (*a_ptrCallback)(void), uint32_t a_ui32ReloadTicks)
+{
+    a_ptrTimer->next = 0;
+    a_ptrTimer->prev = 0;
+    a_ptrTimer->delta = 0;
+    a_ptrTimer->reloadTicks = a_ui32ReloadTicks;
+    a_ptrTimer->callback = a_ptrCallback;
+    a_ptrTimer->isActive = false;
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerStart
+ * Inputs: SoftTimer *a_ptrTimer - Timer to start
+ *         uint32_t a_ui32Ticks - Ticks from now until the first expiry
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Starts the timer, or restarts it if it is already running. Task context only (including timer
+ *              callbacks); cost grows with the number of running timers that expire earlier.
+ ***********************************************/
+void OS_voidTimerStart(SoftTimer *a_ptrTimer, uint32_t a_ui32Ticks)
+{
+    if (a_ptrTimer->isActive) {
+        OS_voidTimerUnlink(a_ptrTimer);
+    }
+
+    // The list is counted from OS_ui32TimerBase, which may lag the current tick
+    OS_voidTimerInsert(a_ptrTimer, a_ui32Ticks + (OS_ui32TimerNow - OS_ui32TimerBase));
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerStop
+ * Inputs: SoftTimer *a_ptrTimer - Timer to stop
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Stops the timer without calling its callback. Stopping a stopped timer has no effect.
+ ***********************************************/
+void OS_voidTimerStop(SoftTimer *a_ptrTimer)
+{
+    if (a_ptrTimer->isActive) {
+        OS_voidTimerUnlink(a_ptrTimer);
+    }
+}
+
+/***********************************************
+ * Function Name: OS_boolTimerIsActive
+ * Inputs: const SoftTimer *a_ptrTimer - Timer to query
+ * Outputs: bool - true while the timer is running
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: A one-shot timer becomes inactive just before its callback runs.
+ ***********************************************/
+bool OS_boolTimerIsActive(const SoftTimer *a_ptrTimer)
+{
+    return a_ptrTimer->isActive;
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerTick
+ * Inputs: uint32_t a_ui32Now - Current system tick
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Tick service, called from the SysTick interrupt. Only publishes the current tick, so the interrupt
+ *              cost does not depend on the number of running timers.
+ ***********************************************/
+void OS_voidTimerTick(uint32_t a_ui32Now)
+{
+    OS_ui32TimerNow = a_ui32Now;
+}
+
+/***********************************************
+ * Function Name: OS_voidTimerService
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Called from the scheduler loop. Walks the head of the list while it has expired, advancing the list
+ *              base to each expiry tick, reloading periodic timers relative to their expiry (so they do not drift
+ *              when the service runs late) and calling the callbacks. Finally charges the remaining elapsed ticks to
+ *              the new head.
+ ***********************************************/
+void OS_voidTimerService(void)
+{
+    uint32_t ui32Now = OS_ui32TimerNow;
+    SoftTimer *ptrTimer = 0;
+
+    while ((OS_ptrTimerHead != 0) && ((ui32Now - OS_ui32TimerBase) >= OS_ptrTimerHead->delta)) {
+        ptrTimer = OS_ptrTimerHead;
+        OS_ui32TimerBase += ptrTimer->delta;
+        ptrTimer->delta = 0;
+        OS_voidTimerUnlink(ptrTimer);
+
+        if (ptrTimer->reloadTicks != OS_TIMER_ONE_SHOT) {
+            OS_voidTimerInsert(ptrTimer, ptrTimer->reloadTicks);
+        }
+        if (ptrTimer->callback != 0) {
+            ptrTimer->callback();
+        }
+    }
+
+    if (OS_ptrTimerHead != 0) {
+        OS_ptrTimerHead->delta -= (ui32Now - OS_ui32TimerBase);
+    }
+    OS_ui32TimerBase = ui32Now;
+}
+
+/***********************************************
+ * Function Name: OS_ui32TicksToNextExpiry
+ * Inputs: N/A
+ * Outputs: uint32_t - Ticks until the earliest running timer expires, 0 if one is already due,
+ *                     OS_TIMER_NONE_ACTIVE if no timer is running
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Used by the idle path together with the dispatcher release query to bound the sleep length.
+ ***********************************************/
+uint32_t OS_ui32TicksToNextExpiry(void)
+{
+    uint32_t ui32Elapsed = OS_ui32TimerNow - OS_ui32TimerBase;
+
+    if (OS_ptrTimerHead == 0) {
+        return OS_TIMER_NONE_ACTIVE;
+    }
+    if (ui32Elapsed >= OS_ptrTimerHead->delta) {
+        return 0;
+    }
+    return OS_ptrTimerHead->delta - ui32Elapsed;
+}
@@ -0,0 +1,89 @@
+/*
+ * timebase.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the monotonic time base on top of the 64-bit counter of the
+ *      port layer. The counter itself is consistent on every read, so the module keeps no software epoch and no
+ *      state; the microsecond value is the cycle count divided by the cycles per microsecond. The clock rate is read
+ *      on every conversion because the drivers switch the system clock to the PLL during initialisation, after the
+ *      counter has started.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidTimeBaseInit
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Starts the counter from zero. Call once, before the first timestamp is taken; the counter stalls
+ *              while the debugger halts the CPU.
+ ***********************************************/
+void OS_voidTimeBaseInit(void)
+{
+    OS_TIMEBASE_PORT_INIT();
+}
+
+/***********************************************
+ * Function Name: OS_ui64TimeCycles
+ * Inputs: N/A
+ * Outputs: uint64_t - CPU cycles since OS_voidTimeBaseInit
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Lock-free; safe from interrupt handlers.
+ ***********************************************/
+uint64_t OS_ui64TimeCycles(void)
+{
+    return OS_TIMEBASE_COUNT();
+}
+
+/***********************************************
+ * Function Name: OS_ui64TimeUs
+ * Inputs: N/A
+ * Outputs: uint64_t - Microseconds since OS_voidTimeBaseInit
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Lock-free; safe from interrupt handlers. The 64-bit division is a run-time library call of a few
+ *              hundred cycles: keep it out of tight loops and use OS_ui64TimeCycles there.
+ ***********************************************/
+uint64_t OS_ui64TimeUs(void)
+{
+    return OS_TIMEBASE_COUNT() / (OS_TIMEBASE_CLOCK_HZ() / OS_TIMEBASE_US_PER_S);
+}
+
+/***********************************************
+ * Function Name: OS_ui64UsToCycles
+ * Inputs: uint64_t a_ui64Us - Duration in microseconds
+ * Outputs: uint64_t - The same duration in time-base cycles at the current clock rate
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: For deadlines on the cycle count: OS_ui64TimeCycles() + OS_ui64UsToCycles(delay).
+ ***********************************************/
+uint64_t OS_ui64UsToCycles(uint64_t a_ui64Us)
+{
+    return a_ui64Us * (OS_TIMEBASE_CLOCK_HZ() / OS_TIMEBASE_US_PER_S);
+}
+
+/***********************************************
+ * Function Name: OS_ui32UsToSeconds
+ * Inputs: uint64_t a_ui64Us - Time-base value or difference in microseconds
+ * Outputs: uint32_t - Whole seconds
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Fits 32 bits for 136 years, for the UART reports (UART_SendNumber takes 32 bits).
+ ***********************************************/
+uint32_t OS_ui32UsToSeconds(uint64_t a_ui64Us)
+{
+    return (uint32_t)(a_ui64Us / OS_TIMEBASE_US_PER_S);
+}
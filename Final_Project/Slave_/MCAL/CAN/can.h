@@ -7,6 +7,15 @@
  *               2) Abstract hardware-specific CAN details for easier implementation.
  *               3) Facilitate master-slave communication and acknowledge signaling.
  *               4) Define shared global variables and flags for CAN-based communication tasks.
+ *               5) Queue received frames: hardware FIFOs of chained message objects absorb bursts, CAN_handler reads
+ *                  them into a timestamped ring, and tasks take the frames in arrival order with CAN_Receive instead
+ *                  of reading the objects.
+ *               6) Queue frames to send: CAN_Send sorts them by identifier into a TX queue that feeds a pool of
+ *                  transmit mailboxes, so back-to-back frames are not overwritten and the highest-priority frame is
+ *                  always the next one offered to the bus.
+ *               7) Take the message identifiers, lengths and signal layouts from the network description in
+ *                  can_db.h. CAN_Send seals the frames it describes as protected, and CAN_Receive passes on only
+ *                  frames with the described length, a matching checksum and a fresh alive counter.
  */
 
 #ifndef CAN_H_
@@ -26,6 +35,7 @@
 #include "inc/hw_ints.h"
 #include "driverlib/interrupt.h"
 #include "can_config.h"
+#include "can_db.h"
 #include <string.h>
 
 
@@ -43,25 +53,22 @@
 #define NO_FILTERING                0x0
 #define USE_ID_FILTER               0x700
 
-#define CAN_KEEP_ALIVE_ID           0x101
 #define CAN_KEEP_ALIVE_OBJ          0x001
 
 
-#define CAN_TEMP_ID                 0x102
 #define CAN_TEMP_OBJ                0x002
 
-#define CAN_REMOTE_ID               0x104
 #define CAN_REMOTE_OBJ              0x004
 
 #define CAN_REMOTE_RECEIVE_ID       0x105
 #define CAN_REMOTE_RECEIVE_OBJ      0x005
 
-#define CAN_STATE_ID                0x106
 #define CAN_STATE_OBJ               0x006
 
-#define CAN_GPIO_CONTROL_ID         0x107
 #define CAN_GPIO_CONTROL_OBJ        0x007
 
+#define CAN_CPU_LOAD_OBJ            0x008
+
 typedef enum {
     MSG_OBJ_TX_1 = 1,   // Use Message Object 1 for TX
     MSG_OBJ_TX_2,       // Use Message Object 2 for TX
@@ -82,7 +89,7 @@ typedef enum {
 } CAN_TX_MessageObject_t;
 
 typedef enum {
-    MSG_OBJ_RX_1 = 0x17U,   // Use Message Object 17 for RX
+    MSG_OBJ_RX_1 = 17U,  // Use Message Object 17 for RX
     MSG_OBJ_RX_2,        // Use Message Object 18 for RX
     MSG_OBJ_RX_3,        // Use Message Object 19 for RX
     MSG_OBJ_RX_4,        // Use Message Object 20 for RX
@@ -118,18 +125,55 @@ typedef enum {
 /***********************************************
  * Type Declarations (enums, structs and unions)
  ***********************************************/
-
+typedef struct {
+    uint64_t timestamp;     // OS_ui64TimeCycles() when CAN_handler read the frame out of its message object,
+                            // or when CAN_Send queued it
+    uint32_t id;            // Message identifier
+    uint8_t length;         // Data length code, 0..8
+    uint8_t object;         // Message object that received (or is sending) the frame, 1..32
+    uint8_t data[8];
+} CAN_Frame_t;
+
+typedef struct {
+    uint32_t id;            // Identifier bits the FIFO accepts
+    uint32_t mask;          // Identifier bits compared
+    uint32_t depth;         // Chained message objects
+} CAN_RxFifoConfig_t;
+
+typedef struct {
+    uint32_t received;      // Frames read out of the message objects
+    uint32_t overruns;      // Reads that found MSGLST: a full FIFO overwrote its last frame at least once
+    uint32_t dropped;       // Frames read but lost because the RX ring was full
+    uint32_t rejected;      // Frames CAN_Receive discarded: wrong length, bad checksum or repeated alive counter
+} CAN_RxCounters_t;
+
+typedef struct {
+    uint32_t sent;              // Frames confirmed by a TXOK interrupt
+    uint32_t dropped;           // Frames refused by CAN_Send because the TX queue was full
+    uint32_t requeued;          // Frames taken back from a mailbox so that a higher-priority frame goes first
+    uint32_t depth;             // Frames queued or in a mailbox now
+    uint32_t maxDepth;          // Highest depth since reset
+    uint32_t meanLatencyCycles; // Mean time from CAN_Send to the TXOK interrupt, in CPU cycles
+    uint32_t maxLatencyCycles;  // Longest such time
+} CAN_TxStats_t;
 
 
 /***********************************************
  * Functions Prototypes
  ***********************************************/
 void CAN_Init(void);
-void CAN_Send(uint32_t messageID, uint8_t *data, uint8_t dataLength);
+bool CAN_Send(uint32_t messageID, const uint8_t *data, uint8_t dataLength);
 void CAN_ReceiveInit(void);
 void CAN_ReceiveMessage(void);
 void CAN_ConfigureReceiveObjects(void);
-void CAN_SendMessage(uint32_t messageID , uint32_t msgObjectID , uint8_t *data, uint8_t dataLength);
+uint32_t CAN_DrainReceiveObjects(void);
+void CAN_SetReceiveHook(void (*hook)(const CAN_Frame_t *frame));
+bool CAN_Receive(CAN_Frame_t *frame);
+void CAN_GetRxCounters(CAN_RxCounters_t *counters);
+uint32_t CAN_ServiceTransmitObjects(void);
+void CAN_GetTxStats(CAN_TxStats_t *stats);
+const CAN_DbMessage_t *CAN_FindMessage(uint32_t messageID);
+void CAN_handler(void);
 void CAN_ConfigureRemoteFrameHandler(uint32_t msgObjID, uint8_t *data);
 
 
@@ -0,0 +1,235 @@
+/*
+ * can_db.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Describe the network of the two ECUs in one place, as a DBC file would: every message with its
+ *                  identifier, length, sender and transmission mode, and every signal with its position, width, scale
+ *                  and offset.
+ *               2) Generate the code from that description at compile time, so no task packs bytes by hand:
+ *                  - CAN_ID_<message>, CAN_DLC_<message> and CAN_DB_INDEX_<message> constants;
+ *                  - the const message table g_stCanDbMessages (defined in can.c), in table order;
+ *                  - static inline codecs for every signal:
+ *                      CAN_Pack_<message>_<signal>(data, value) / CAN_Unpack_<message>_<signal>(data)     // float
+ *                      CAN_PackRaw_<message>_<signal>(data, raw) / CAN_UnpackRaw_<message>_<signal>(data) // raw
+ *               3) Pack the signals of one sender into the bytes they need instead of one value per 8-byte frame,
+ *                  and protect the frames that carry a state with an alive counter and a CRC-8 that CAN_Send fills
+ *                  in and CAN_Receive checks.
+ *
+ *      Usage rules:
+ *               - The file is the same in both ECUs; a change to the network is made in both copies.
+ *               - Signals are little-endian (Intel): start is the bit number of the least significant bit, counting
+ *                 from bit 0 of byte 0. Signals of a message must not overlap; the compiler checks that each one
+ *                 ends within the message length.
+ *               - physical = raw * scale + offset. CAN_Pack_ rounds to the nearest raw value and saturates at the
+ *                 ends of the range; CAN_PackRaw_ keeps the low length bits, so counters wrap.
+ *               - A CAN_DB_SEALED message ends with ALIVE_COUNTER in the high nibble of its second-to-last byte and
+ *                 CHECKSUM in its last byte. The sender only packs the other signals: CAN_Send writes both.
+ */
+
+#ifndef CAN_DB_H_
+#define CAN_DB_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define CAN_DB_ECU1                 1U      // Master_
+#define CAN_DB_ECU2                 2U      // Slave_
+
+#define CAN_DB_PLAIN                0U      // No protection
+#define CAN_DB_SEALED               1U      // Alive counter and CRC-8 (SAE J1850) over the identifier and the data
+
+#define CAN_DB_TX_DIRECT            0U      // Sent by the sender with CAN_Send, not managed by OS/com.c
+#define CAN_DB_TX_CYCLIC            1U      // Every cycleMs
+#define CAN_DB_TX_ON_CHANGE         2U      // When the payload changes
+#define CAN_DB_TX_ON_CHANGE_GAP     3U      // When the payload changes, at least gapMs apart
+#define CAN_DB_TX_MIXED             4U      // Every cycleMs, and on change a burst of burst frames gapMs apart
+
+/**
+ * Messages: X(name, id, dlc, sender, protection, txMode, cycleMs, gapMs, burst)
+ *      sender       // ECU that sends the message (CAN_DB_ECU1 or CAN_DB_ECU2)
+ *      protection   // CAN_DB_PLAIN or CAN_DB_SEALED
+ *      txMode       // CAN_DB_TX_...; cycleMs, gapMs and burst are used by the modes that name them (0 otherwise).
+ *                   // For a CAN_DB_TX_DIRECT message cycleMs is the rate the sender keeps, for reference.
+ *      The STATE burst repeats a change twice, gapMs apart, for a receiver that missed the first frame; the
+ *      one-second cycle resynchronises a receiver that restarted. TEMPERATURE doubles as the heartbeat of ECU2, so its cycle
+ *      stays well below COMM_LOST_TIMEOUT_MS of ECU1.
+ */
+#define CAN_DB_MESSAGE_TABLE(X) \
+    X(KEEP_ALIVE,     0x101U, 2U, CAN_DB_ECU1, CAN_DB_SEALED, CAN_DB_TX_CYCLIC, 100U,  0U,   0U) \
+    X(TEMPERATURE,    0x102U, 3U, CAN_DB_ECU2, CAN_DB_SEALED, CAN_DB_TX_MIXED,  1000U, 100U, 1U) \
+    X(VOLTAGE,        0x104U, 3U, CAN_DB_ECU2, CAN_DB_SEALED, CAN_DB_TX_DIRECT, 0U,    0U,   0U) /* Remote reply */ \
+    X(STATE,          0x106U, 3U, CAN_DB_ECU1, CAN_DB_SEALED, CAN_DB_TX_MIXED,  1000U, 20U,  3U) \
+    X(GPIO_CONTROL,   0x107U, 1U, CAN_DB_ECU1, CAN_DB_PLAIN,  CAN_DB_TX_DIRECT, 0U,    0U,   0U) \
+    X(ECU1_CPU_LOAD,  0x108U, 3U, CAN_DB_ECU1, CAN_DB_PLAIN,  CAN_DB_TX_DIRECT, 1000U, 0U,   0U) \
+    X(ECU2_CPU_LOAD,  0x109U, 3U, CAN_DB_ECU2, CAN_DB_PLAIN,  CAN_DB_TX_DIRECT, 1000U, 0U,   0U)
+
+/**
+ * Signals: X(message, name, start, length, scale, offset)
+ */
+#define CAN_DB_SIGNAL_TABLE(X) \
+    X(KEEP_ALIVE,       ALIVE_COUNTER,  4U,  4U,  1.0f, 0.0f) \
+    X(KEEP_ALIVE,       CHECKSUM,       8U,  8U,  1.0f, 0.0f) \
+    X(TEMPERATURE,      AVERAGE,        0U,  11U, 0.1f, -50.0f)    /* degC, -50.0 .. 154.7 */ \
+    X(TEMPERATURE,      ALIVE_COUNTER,  12U, 4U,  1.0f, 0.0f) \
+    X(TEMPERATURE,      CHECKSUM,       16U, 8U,  1.0f, 0.0f) \
+    X(VOLTAGE,          SENSOR,         0U,  8U,  0.1f, 0.0f)      /* V, 0.0 .. 25.5 */ \
+    X(VOLTAGE,          ALIVE_COUNTER,  12U, 4U,  1.0f, 0.0f) \
+    X(VOLTAGE,          CHECKSUM,       16U, 8U,  1.0f, 0.0f) \
+    X(STATE,            CODE,           0U,  8U,  1.0f, 0.0f)      /* NORMAL_STATE, OVERHEAT, ... */ \
+    X(STATE,            ALIVE_COUNTER,  12U, 4U,  1.0f, 0.0f) \
+    X(STATE,            CHECKSUM,       16U, 8U,  1.0f, 0.0f) \
+    X(GPIO_CONTROL,     COMMAND,        0U,  8U,  1.0f, 0.0f)      /* GPIO_ON, ... */ \
+    X(ECU1_CPU_LOAD,    LAST,           0U,  8U,  1.0f, 0.0f)      /* %, last sample */ \
+    X(ECU1_CPU_LOAD,    SMOOTHED,       8U,  8U,  1.0f, 0.0f)      /* %, exponential average */ \
+    X(ECU1_CPU_LOAD,    PEAK,           16U, 8U,  1.0f, 0.0f)      /* %, peak of the report period */ \
+    X(ECU2_CPU_LOAD,    LAST,           0U,  8U,  1.0f, 0.0f) \
+    X(ECU2_CPU_LOAD,    SMOOTHED,       8U,  8U,  1.0f, 0.0f) \
+    X(ECU2_CPU_LOAD,    PEAK,           16U, 8U,  1.0f, 0.0f)
+
+// Identifiers, lengths and table indexes
+#define CAN_DB_ID(name, id, dlc, sender, protection, txMode, cycleMs, gapMs, burst)       CAN_ID_##name = (id),
+#define CAN_DB_DLC(name, id, dlc, sender, protection, txMode, cycleMs, gapMs, burst)      CAN_DLC_##name = (dlc),
+#define CAN_DB_INDEX(name, id, dlc, sender, protection, txMode, cycleMs, gapMs, burst)    CAN_DB_INDEX_##name,
+enum { CAN_DB_MESSAGE_TABLE(CAN_DB_ID) };
+enum { CAN_DB_MESSAGE_TABLE(CAN_DB_DLC) };
+enum { CAN_DB_MESSAGE_TABLE(CAN_DB_INDEX) CAN_DB_MESSAGE_COUNT };
+
+// Entry of g_stCanDbMessages
+#define CAN_DB_MESSAGE_ENTRY(name, id, dlc, sender, protection, txMode, cycleMs, gapMs, burst) \
+    {(id), (dlc), (sender), (protection), (txMode), (burst), (cycleMs), (gapMs)},
+
+// Compile-time check: a negative array size if the signal ends past the message length
+#define CAN_DB_SIGNAL_CHECK(message, name, start, length, scale, offset) \
+    typedef char CAN_DbFits_##message##_##name[(((start) + (length)) <= (8U * CAN_DLC_##message)) ? 1 : -1];
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t id;            // Message identifier
+    uint8_t dlc;            // Data length code
+    uint8_t sender;         // CAN_DB_ECU1 or CAN_DB_ECU2
+    uint8_t protection;     // CAN_DB_PLAIN or CAN_DB_SEALED
+    uint8_t txMode;         // CAN_DB_TX_...
+    uint8_t burst;          // Frames of the fast-start burst (CAN_DB_TX_MIXED)
+    uint16_t cycleMs;       // Period of the cyclic frames
+    uint16_t gapMs;         // Least time between frames sent on change
+} CAN_DbMessage_t;
+
+
+/***********************************************
+ * Global Variables
+ ***********************************************/
+extern const CAN_DbMessage_t g_stCanDbMessages[CAN_DB_MESSAGE_COUNT];
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: CAN_PackBits
+ * Inputs: uint8_t *data - Frame payload
+ *         uint32_t start - Bit number of the least significant bit
+ *         uint32_t length - Width in bits, 1..32
+ *         uint32_t raw - Value; bits above length are ignored
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Writes a little-endian bit field, one byte at a time, leaving the other bits of the bytes unchanged.
+ *              With constant start and length (as in the generated codecs) the loop unrolls into a few masks.
+ ***********************************************/
+static inline void CAN_PackBits(uint8_t *data, uint32_t start, uint32_t length, uint32_t raw)
+{
+    uint32_t ui32Shift = 0;
+    uint32_t ui32Bits = 0;
+    uint8_t ui8Mask = 0;
+
+    while (length != 0U) {
+        ui32Shift = start & 7U;
+        ui32Bits = ((8U - ui32Shift) < length) ? (8U - ui32Shift) : length;
+        ui8Mask = (uint8_t)(((1U << ui32Bits) - 1U) << ui32Shift);
+        data[start >> 3U] = (uint8_t)((data[start >> 3U] & (uint8_t)~ui8Mask) | ((raw << ui32Shift) & ui8Mask));
+        raw >>= ui32Bits;
+        start += ui32Bits;
+        length -= ui32Bits;
+    }
+}
+
+/***********************************************
+ * Function Name: CAN_UnpackBits
+ * Inputs: const uint8_t *data - Frame payload
+ *         uint32_t start - Bit number of the least significant bit
+ *         uint32_t length - Width in bits, 1..32
+ * Outputs: uint32_t - Value of the field
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Reads a little-endian bit field written by CAN_PackBits.
+ ***********************************************/
+static inline uint32_t CAN_UnpackBits(const uint8_t *data, uint32_t start, uint32_t length)
+{
+    uint32_t ui32Raw = 0;
+    uint32_t ui32Done = 0;
+    uint32_t ui32Shift = 0;
+    uint32_t ui32Bits = 0;
+
+    while (ui32Done < length) {
+        ui32Shift = start & 7U;
+        ui32Bits = ((8U - ui32Shift) < (length - ui32Done)) ? (8U - ui32Shift) : (length - ui32Done);
+        ui32Raw |= ((uint32_t)(data[start >> 3U] >> ui32Shift) & ((1U << ui32Bits) - 1U)) << ui32Done;
+        start += ui32Bits;
+        ui32Done += ui32Bits;
+    }
+    return ui32Raw;
+}
+
+/***********************************************
+ * Function Name: CAN_PhysToRaw
+ * Inputs: float value - Physical value
+ *         float scale - Signal scale
+ *         float offset - Signal offset
+ *         uint32_t length - Width in bits, 1..32
+ * Outputs: uint32_t - Nearest raw value, saturated to 0 .. 2^length - 1
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: A value below the range (or not a number) gives 0, one above it the largest raw value.
+ ***********************************************/
+static inline uint32_t CAN_PhysToRaw(float value, float scale, float offset, uint32_t length)
+{
+    float fRaw = ((value - offset) / scale) + 0.5f;
+    uint32_t ui32Max = (length >= 32U) ? 0xFFFFFFFFU : ((1U << length) - 1U);
+
+    if (!(fRaw > 0.0f)) {
+        return 0;
+    }
+    if (fRaw >= (float)ui32Max) {
+        return ui32Max;
+    }
+    return (uint32_t)fRaw;
+}
+
+// Codecs of every signal
+#define CAN_DB_SIGNAL_CODECS(message, name, start, length, scale, offset) \
+    static inline void CAN_PackRaw_##message##_##name(uint8_t *data, uint32_t raw) \
+    { CAN_PackBits(data, (start), (length), raw); } \
+    static inline uint32_t CAN_UnpackRaw_##message##_##name(const uint8_t *data) \
+    { return CAN_UnpackBits(data, (start), (length)); } \
+    static inline void CAN_Pack_##message##_##name(uint8_t *data, float value) \
+    { CAN_PackBits(data, (start), (length), CAN_PhysToRaw(value, (scale), (offset), (length))); } \
+    static inline float CAN_Unpack_##message##_##name(const uint8_t *data) \
+    { return ((float)CAN_UnpackBits(data, (start), (length)) * (scale)) + (offset); }
+
+CAN_DB_SIGNAL_TABLE(CAN_DB_SIGNAL_CODECS)
+CAN_DB_SIGNAL_TABLE(CAN_DB_SIGNAL_CHECK)
+
+#endif /* CAN_DB_H_ */
@@ -1,4 +1,5 @@
 #include "NVM.h"
+#include "MCAL/Timers/TIMER0/timer0.h"
 
 static uint32_t OS_ui8OverheatDTCCounter = 0;
 static uint32_t g_DTC = 0;
@@ -145,12 +146,19 @@ void NVM_StateReminder(void){
     }
 }
 
+// Timer0 one-shot callback: ends the fault indication started by checkFaultFlag
+static void NVM_voidFaultLedOff(void *a_ptrContext) {
+    (void)a_ptrContext;
+    HAL_voidLedOff(BLUE);
+}
+
 void checkFaultFlag(void) {
     if (g_Fault_Flag) {
-        // Indicate fault with blue LED for 2 seconds
+        // Indicate fault with blue LED for 2 seconds, switched off by a Timer0 one-shot instead of waiting here
         HAL_voidLedOn(BLUE);
-        SysCtlDelay(SysCtlClockGet() * 2);
-        HAL_voidLedOff(BLUE);
+        if (!TIMER0_startOneShot(NVM_FAULT_LED_US, NVM_voidFaultLedOff, 0)) {
+            HAL_voidLedOff(BLUE);
+        }
 
         // Clear the fault flag after handling
         g_Fault_Flag = false;
@@ -29,7 +29,9 @@ extern bool OS_boolCommunicationDTCFlag;
 #define EEPROM_BUTTON_COUNTER_ADDR  0x300  // EEPROM address for the button counter
 #define EEPROM_FAULT_REMINDER_ADDR  0x400
 #define EEPROM_COMM_COUNTER_ADDR    0x500  // EEPROM address for the button counter
+#define EEPROM_WDGM_RECORD_ADDR     0x600  // Watchdog manager supervision failure record (4 words)
 #define MOTOR_OVERHEAT_TIME            3   // Overheat time in seconds
+#define NVM_FAULT_LED_US               2000000U   // Blue LED fault indication of checkFaultFlag, in us
 
 // Threshold for entering fail-safe state
 #define ERROR_THRESHOLD 3
@@ -12,7 +12,15 @@
  * Includes
  ***********************************************/
 #include "systickTimer.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/cpu.h"
 
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static uint32_t SYSTICK_ui32CyclesPerTick = 1;              // Reload value of one regular tick
+static volatile uint32_t SYSTICK_ui32PendingTicks = 1;      // Ticks accounted by the next SysTick interrupt
+volatile uint32_t g_ui32SysTickCount = 0;
 
 
 /***********************************************
@@ -33,7 +41,126 @@
 void SYSTICK_init(void) {
     // Set the clock source for SysTick to the system clock (default)
     SysTickPeriodSet(SysCtlClockGet() / 1000);  // Set SysTick to trigger every 1 milliseconds
+    SYSTICK_ui32CyclesPerTick = SysTickPeriodGet();
     SysTickIntRegister(SYSTICK_handler);        // Register SysTick interrupt handler
     SysTickIntEnable();                         // Enable SysTick interrupt
     SysTickEnable();                            // Enable SysTick timer
 }
+
+/***********************************************
+ * Function Name: SYSTICK_ui32TickCycles
+ * Inputs: N/A
+ * Outputs: uint32_t - Number of SysTick clock cycles in one tick
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Returns the reload captured in SYSTICK_init, independent of any temporary reload programmed by
+ *              SYSTICK_ui32Sleep.
+ ***********************************************/
+uint32_t SYSTICK_ui32TickCycles(void)
+{
+    return SYSTICK_ui32CyclesPerTick;
+}
+
+/***********************************************
+ * Function Name: SYSTICK_ui32ElapsedTicks
+ * Inputs: N/A
+ * Outputs: uint32_t - Number of ticks the current SysTick interrupt stands for
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Called once by the SysTick interrupt handler. Returns 1 for a regular tick, or the number of ticks that
+ *              passed while SYSTICK_ui32Sleep had the periodic interrupt suppressed.
+ ***********************************************/
+uint32_t SYSTICK_ui32ElapsedTicks(void)
+{
+    uint32_t ui32Ticks = SYSTICK_ui32PendingTicks;
+
+    SYSTICK_ui32PendingTicks = 1;
+    return ui32Ticks;
+}
+
+/***********************************************
+ * Function Name: SYSTICK_ui32Sleep
+ * Inputs: uint32_t a_ui32Ticks - Number of tick boundaries the core may sleep through
+ * Outputs: uint32_t - SysTick cycles spent sleeping (used for the CPU load figure)
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Tickless idle. Must be called with interrupts masked. The periodic tick is replaced by a single SysTick
+ *              expiry on the a_ui32Ticks-th tick boundary (clamped to the 24-bit counter range) and the core executes
+ *              WFI. A masked interrupt still wakes the core; the interrupt is then taken when the caller unmasks.
+ *              - If SysTick expired, its pending interrupt accounts for all a_ui32Ticks ticks.
+ *              - If another interrupt woke the core first, the counter is reloaded to finish the current tick and the
+ *                next SysTick interrupt accounts for every tick that passed, so tick boundaries do not drift.
+ *              The regular one-tick reload is restored in both cases.
+ ***********************************************/
+uint32_t SYSTICK_ui32Sleep(uint32_t a_ui32Ticks)
+{
+    uint32_t ui32TickCycles = SYSTICK_ui32CyclesPerTick;
+    uint32_t ui32MaxTicks = (SYSTICK_MAX_RELOAD / ui32TickCycles) - 1U;   // Leave room for the partial tick
+    uint32_t ui32Remaining = 0;
+    uint32_t ui32Reload = 0;
+    uint32_t ui32Elapsed = 0;
+    uint32_t ui32Whole = 0;
+
+    // A tick that is already pending has to be accounted for before the counter is touched
+    if ((a_ui32Ticks == 0U) || (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET)) {
+        return 0;
+    }
+
+    if (a_ui32Ticks > ui32MaxTicks) {
+        a_ui32Ticks = ui32MaxTicks;
+    }
+
+    // Next boundary is the deadline: sleep on the regular tick
+    if (a_ui32Ticks == 1U) {
+        ui32Remaining = SysTickValueGet();
+        CPUwfi();
+        if (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET) {
+            return ui32Remaining;
+        }
+        return ui32Remaining - SysTickValueGet();
+    }
+
+    SysTickDisable();
+    if (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET) {
+        // The tick expired while the counter was being stopped
+        SysTickEnable();
+        return 0;
+    }
+
+    // Stretch the current tick over the whole sleep
+    ui32Remaining = SysTickValueGet();
+    ui32Reload = ui32Remaining + ((a_ui32Ticks - 1U) * ui32TickCycles);
+    HWREG(NVIC_ST_RELOAD) = ui32Reload - 1U;
+    HWREG(NVIC_ST_CURRENT) = 0;
+    SYSTICK_ui32PendingTicks = a_ui32Ticks;
+    SysTickEnable();
+
+    CPUwfi();
+
+    SysTickDisable();
+    if (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET) {
+        // Slept up to the deadline
+        ui32Elapsed = ui32Reload;
+        HWREG(NVIC_ST_RELOAD) = ui32TickCycles - 1U;
+        HWREG(NVIC_ST_CURRENT) = 0;
+        SysTickEnable();
+        return ui32Elapsed;
+    }
+
+    // Woken early: count the tick boundaries already crossed and finish the current tick
+    ui32Elapsed = ui32Reload - SysTickValueGet();
+    if (ui32Elapsed < ui32Remaining) {
+        ui32Whole = 0;
+        ui32Remaining -= ui32Elapsed;
+    } else {
+        ui32Whole = 1U + ((ui32Elapsed - ui32Remaining) / ui32TickCycles);
+        ui32Remaining = ui32TickCycles - ((ui32Elapsed - ui32Remaining) % ui32TickCycles);
+    }
+    SYSTICK_ui32PendingTicks = ui32Whole + 1U;
+    HWREG(NVIC_ST_RELOAD) = ui32Remaining - 1U;
+    HWREG(NVIC_ST_CURRENT) = 0;
+    SysTickEnable();
+    HWREG(NVIC_ST_RELOAD) = ui32TickCycles - 1U;   // Taken on the next reload
+
+    return ui32Elapsed;
+}
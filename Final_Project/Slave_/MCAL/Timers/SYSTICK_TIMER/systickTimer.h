@@ -26,11 +26,15 @@
 #include "driverlib/systick.h"
 #include "driverlib/interrupt.h"
 
+/***********************************************
+ * Definitions and Macros                      *
+ ***********************************************/
+#define SYSTICK_MAX_RELOAD        0x01000000U   // SysTick counter range (24-bit), bounds the tickless sleep length
 
 /***********************************************
  * Shared Global Variables                     *
  ***********************************************/
-volatile uint32_t g_ui32SysTickCount ;
+extern volatile uint32_t g_ui32SysTickCount;    // System tick, written by SYSTICK_handler only
 
 
 /***********************************************
@@ -38,6 +42,9 @@ volatile uint32_t g_ui32SysTickCount ;
  ***********************************************/
 void SYSTICK_init(void);
 void SYSTICK_handler(void);
+uint32_t SYSTICK_ui32TickCycles(void);
+uint32_t SYSTICK_ui32ElapsedTicks(void);
+uint32_t SYSTICK_ui32Sleep(uint32_t a_ui32Ticks);
 
 
 #endif /* SYSTICKTIMER_H_ */
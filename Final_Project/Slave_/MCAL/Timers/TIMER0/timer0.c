@@ -3,8 +3,16 @@
  *
  *  Created on: 22 Nov 2024
  *      Author: Team: 4
- *      purpose: The purpose of this file is to configure and use Timer0 to provide a delay function based on a specified time in milliseconds.
- *      It enables the use of Timer0 for timing purposes, specifically to create a delay in the program execution.
+ *      purpose: The purpose of this file is to provide asynchronous one-shot delays on Timer0. Each started delay is
+ *      kept in a slot with its absolute deadline on the 64-bit time base (OS/timebase.h); Timer0A counts down to the
+ *      nearest deadline only, and its interrupt runs every callback that is due and re-arms for the next one. The
+ *      caller returns at once, so the scheduler keeps ticking and dispatching while the delay runs.
+ *
+ *      Usage rules:
+ *               - Callbacks run in the Timer0A interrupt handler. They must be short and must not block: no busy-waits,
+ *                 no UART strings longer than the TX FIFO, no EEPROM writes. Post a deferred job or set an event for
+ *                 longer work.
+ *               - A callback may start a new delay, including its own next one.
  */
 
 
@@ -12,7 +20,30 @@
  * Includes
  ***********************************************/
 #include "timer0.h"
+#include "OS/timebase.h"
+#include "OS/trace.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TIMER_MAX_LOAD              0xFFFFFFFFUL    // Longest Timer0A count; later deadlines re-arm on expiry
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint64_t deadline;           // Time-base cycles (OS_ui64TimeCycles) at which the callback is due
+    void (*callback)(void *);    // 0 while the slot is free
+    void *context;               // Handed to the callback
+} OneShotSlot;
+
 
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static OneShotSlot TIMER_stOneShots[TIMER_ONE_SHOT_SLOTS];
 
 
 /***********************************************
@@ -25,51 +56,125 @@
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
- * Description: Initializes Timer0 as a 32-bit one-shot timer. It enables the Timer0 peripheral, waits for it to be ready,
- *              and configures it in one-shot mode where the timer counts up once until it reaches the load value. This setup
- *              allows the timer to be used for a single event or one-time delay.
+ * Description: Initializes Timer0A as a 32-bit one-shot down counter with its timeout interrupt, and frees all
+ *              delay slots. The timer stays stopped until the first delay is started. Call after
+ *              OS_voidTimeBaseInit and before the first TIMER0_startOneShot.
  ***********************************************/
 void TIMER0_init(void) {
+    uint8_t i = 0;
+
     // Enable the Timer0 peripheral
     SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
 
     // Wait for the peripheral to be ready
     while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0)) {}
 
-    // Configure Timer0 as a 32-bit timer in periodic mode
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_ONE_SHOT_UP);
-}
+    for (i = 0; i < TIMER_ONE_SHOT_SLOTS; i++) {
+        TIMER_stOneShots[i].callback = 0;
+    }
 
+    // Configure Timer0 as a 32-bit one-shot timer, re-armed for every deadline
+    TimerConfigure(TIMER0_BASE, TIMER_CFG_ONE_SHOT);
 
+    // Register the Timer0A interrupt handler and enable its timeout interrupt
+    TimerIntRegister(TIMER0_BASE, TIMER_A, TIMER0_handler);
+    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+}
 
 /***********************************************
- * Function Name: TIMER0_delayMs
- * Inputs: uint32_t a_uint32delayMs - The delay in milliseconds for which the timer should count.
+ * Function Name: TIMER0_voidArm
+ * Inputs: N/A
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
- * Description: This function creates a delay by using Timer0. It calculates the required number of timer ticks based on
- *              the system clock frequency and the desired delay in milliseconds. It loads the timer with the calculated
- *              ticks, clears any previous timeout flag, and starts the timer. The function then waits for the timer to
- *              timeout (i.e., the specified delay duration), and once the delay is completed, it disables Timer0.
- *              This is typically used for generating precise time delays in a program.
+ * Description: Restarts Timer0A for the nearest deadline among the busy slots, or stops it if there is none. A
+ *              deadline already passed loads the shortest count, so its interrupt follows at once. Called with
+ *              interrupts masked or from the Timer0A handler.
  ***********************************************/
-void TIMER0_delayMs(uint32_t a_uint32delayMs) {
-    uint32_t clockFrequency = SysCtlClockGet();
-    uint32_t timerTicks = (clockFrequency / 1000) * a_uint32delayMs;
+static void TIMER0_voidArm(void) {
+    uint8_t i = 0;
+    bool boolAny = false;
+    uint64_t ui64Nearest = 0;
+    uint64_t ui64Now = 0;
+    uint64_t ui64Remaining = 1U;
+
+    for (i = 0; i < TIMER_ONE_SHOT_SLOTS; i++) {
+        if ((TIMER_stOneShots[i].callback != 0) && (!boolAny || (TIMER_stOneShots[i].deadline < ui64Nearest))) {
+            ui64Nearest = TIMER_stOneShots[i].deadline;
+            boolAny = true;
+        }
+    }
 
-    // Load the timer with the required number of ticks
-    TimerLoadSet(TIMER0_BASE, TIMER_A, timerTicks - 1);
+    TimerDisable(TIMER0_BASE, TIMER_A);
+    if (!boolAny) {
+        return;
+    }
+
+    ui64Now = OS_ui64TimeCycles();
+    if (ui64Nearest > ui64Now) {
+        ui64Remaining = ui64Nearest - ui64Now;
+    }
+    TimerLoadSet(TIMER0_BASE, TIMER_A, (ui64Remaining > TIMER_MAX_LOAD) ? TIMER_MAX_LOAD : (uint32_t)ui64Remaining);
+    TimerEnable(TIMER0_BASE, TIMER_A);
+}
 
-    // Clear the Timer0 timeout flag
-    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+/***********************************************
+ * Function Name: TIMER0_startOneShot
+ * Inputs: uint32_t a_ui32DelayUs - Delay in microseconds
+ *         void (*a_ptrCallback)(void *) - Called from the Timer0A interrupt when the delay has elapsed
+ *         void *a_ptrContext - Handed to the callback
+ * Outputs: bool - false if all TIMER_ONE_SHOT_SLOTS delays are outstanding (nothing is started)
+ * Reentrancy: Reentrant
+ * Synchronous: Asynch
+ * Description: Returns at once; the callback runs once, a_ui32DelayUs after the call. Interrupts are masked only
+ *              while the slots are updated, so the function may be called from tasks and interrupt handlers.
+ ***********************************************/
+bool TIMER0_startOneShot(uint32_t a_ui32DelayUs, void (*a_ptrCallback)(void *), void *a_ptrContext) {
+    uint8_t i = 0;
+    bool boolStarted = false;
+    bool boolMasked = IntMasterDisable();
+
+    for (i = 0; i < TIMER_ONE_SHOT_SLOTS; i++) {
+        if (TIMER_stOneShots[i].callback == 0) {
+            TIMER_stOneShots[i].deadline = OS_ui64TimeCycles() + OS_ui64UsToCycles(a_ui32DelayUs);
+            TIMER_stOneShots[i].context = a_ptrContext;
+            TIMER_stOneShots[i].callback = a_ptrCallback;
+            TIMER0_voidArm();
+            boolStarted = true;
+            break;
+        }
+    }
+
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
+    return boolStarted;
+}
 
-    // Enable Timer0
-    TimerEnable(TIMER0_BASE, TIMER_A);
+/***********************************************
+ * Function Name: TIMER0_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Timer0A timeout interrupt. Frees and runs every slot whose deadline has passed, in slot order, then
+ *              re-arms for the nearest remaining deadline. A time-out that only ended a partial count of a long
+ *              delay runs nothing and re-arms.
+ ***********************************************/
+void TIMER0_handler(void) {
+    uint8_t i = 0;
+    void (*ptrCallback)(void *) = 0;
 
-    // Wait until the timer counts down
-    while ((TimerIntStatus(TIMER0_BASE, false) & TIMER_TIMA_TIMEOUT) == 0) {}
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_TIMER0, 0U);
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
 
-    // Disable Timer0
-    TimerDisable(TIMER0_BASE, TIMER_A);
+    for (i = 0; i < TIMER_ONE_SHOT_SLOTS; i++) {
+        ptrCallback = TIMER_stOneShots[i].callback;
+        if ((ptrCallback != 0) && (TIMER_stOneShots[i].deadline <= OS_ui64TimeCycles())) {
+            TIMER_stOneShots[i].callback = 0;
+            ptrCallback(TIMER_stOneShots[i].context);
+        }
+    }
+    TIMER0_voidArm();
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_TIMER0, 0U);
 }
@@ -65,6 +65,10 @@ void UART_Init(void);
 void UART_SendMessage(const char *message);
 void UART0_sendMessage(const char *array_ptr);
 void UART0_init(void);
-void UART_SendNumber(uint8_t number);
+void UART_SendNumber(uint32_t number);
+void UART_EnableTxInterrupt(void);
+void UART_ServiceTransmit(void);
+uint32_t UART_ui32TxFree(void);
+void UART_handler(void);
 
 #endif /* UART_H_ */
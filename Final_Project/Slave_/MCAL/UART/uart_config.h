@@ -67,6 +67,20 @@
  */
 #define UART_BAUD_RATE            9600
 
+// **UART0 Start Banner**
+/**
+ * Delay from UART0_init to the "start" message, in microseconds. The message is sent from a Timer0 one-shot
+ * callback, so the delay does not hold up the initialisation.
+ */
+#define UART_START_DELAY_US       1000000U
+
+// **UART TX Ring**
+/**
+ * Characters buffered for transmission; power of two. UART_SendMessage only waits when the ring is full, the
+ * transmit interrupt empties it into the TX FIFO at the line rate.
+ */
+#define UART_TX_RING_LEN          512U
+
 // **UART Word Length**
 /**
  * Options for Word Length:
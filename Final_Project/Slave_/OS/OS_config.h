@@ -8,6 +8,7 @@
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
 #include "OS/scheduler.h"
+#include "OS/dispatcher.h"
 
 
 
@@ -19,6 +20,15 @@
 #define configUSE_TIMER1                     0
 #define configUSE_SYSTICK_TIMER              1
 #define configUSE_UART                       1
+#define configUSE_TICKLESS_IDLE              1       // Sleep in WFI until the next task release
+#define configUSE_WATCHDOG                   1       // Alive supervision of the tasks, serviced by the watchdog manager
+
+#define OS_WDGM_WINDOW_TICKS                 2000U   // Supervision window (ticks)
+
+#define OS_LOAD_SAMPLE_TICKS                 100U    // CPU load sample window (ticks), period of OS_voidReportCpuLoad
+#define OS_LOAD_SAMPLES_PER_REPORT           10U     // Samples per report: the peak covers one second
+#define OS_LOAD_SMOOTHING_SHIFT              3U      // Smoothed load averages about 2^shift samples
+#define OS_LOAD_CALIBRATION_RUNS             8U      // Idle scheduler passes timed at start-up
 
 //// =============================================
 //// Scheduler Configuration
@@ -45,25 +55,39 @@
 // Task Configuration (Define Task Functions)
 // =============================================
 
-// Task list (to be initialized in OS_Config.c)
-//extern TaskConfig taskList[];
+#define MAX_TASKS 0x10U
+#if MAX_TASKS > OS_MAX_TASK_SLOTS
+#error "MAX_TASKS exceeds the capacity of the dispatcher ready bitmap"
+#endif
 
-typedef enum {
-    TASK_READY,
-    TASK_WAITING,
-    TASK_RUNNING
-} TaskState;
+/**
+ * Task table: X(function, periodTicks, offsetTicks, priority, eventMask, aliveMin)
+ *      periodTicks  // Raster class (1-2-5 series, 1 ms .. 1000 ms)
+ *      offsetTicks  // Phase within the period; chosen so that no two releases share a tick
+ *                   // (temperature on 0 mod 10, COM on 2 mod 10, the others on distinct odd ticks mod 100)
+ *      priority     // Dispatch rank, 1 = highest, unique and contiguous from 1
+ *      eventMask    // Events that also release the task (CAN reception runs on every received frame,
+ *                   // the 100 ms period is a fallback poll)
+ *      aliveMin     // Runs required per OS_WDGM_WINDOW_TICKS window: half of the periodic releases, so a task is
+ *                   // only reported when it hangs or is starved, not when a few releases were missed
+ */
+#define OS_TASK_TABLE(X) \
+    X(OS_voidCANHandleReceivedMessages,   100U,  1U,  1U, OS_EVENT_CAN_RX, 10U) \
+    X(OS_ui16SendTemperature,             10U,   0U,  2U, 0x00U,           100U) \
+    X(OS_voidCheckCANCommunication,       100U,  3U,  3U, 0x00U,           10U) \
+    X(OS_voidCheckOverheat,               100U,  5U,  4U, 0x00U,           10U) \
+    X(OS_voidHeartbeatError,              100U,  7U,  5U, 0x00U,           10U) \
+    X(OS_voidCheckDTC,                    100U,  9U,  6U, 0x00U,           10U) \
+    X(OS_voidReportCpuLoad,               OS_LOAD_SAMPLE_TICKS, 13U, 7U, 0x00U, 10U) \
+    X(OS_voidComMainFunction,             OS_COM_PERIOD_TICKS,  2U,  8U, 0x00U, 100U)
 
-typedef struct {
-    void (*taskFunction)(void);
-    uint32_t periodTicks;
-    uint32_t lastRunTick;
-    uint8_t priority;
-    TaskState state;
-    uint8_t isEnabled;           // Task enabled/disabled
-} TaskControlBlock;
+#define OS_TASK_COUNT                       OS_TASK_TABLE_COUNT(OS_TASK_TABLE)
 
-#define MAX_TASKS 0x10U
-TaskControlBlock taskList[MAX_TASKS];
+/**
+ * Blocking term of the schedulability check: the longest section the scheduler loop runs outside the dispatched
+ * tasks, annotated because it is not measured. The timer callbacks only update LEDs and flags; EEPROMProgram and
+ * UARTCharPut are only called from tasks and are part of their measured execution time.
+ */
+#define OS_RTA_BLOCKING_US                  10U     // Longest timer callback (LED and flag updates), in microseconds
 
-#endif /* CAN_CONFIG_H_ */
+#endif /* OS_CONFIG_H_ */
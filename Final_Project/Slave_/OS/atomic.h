@@ -0,0 +1,240 @@
+/*
+ * atomic.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Provide lock-free read-modify-write operations on 32-bit words (fetch-or, fetch-and, fetch-add,
+ *                  exchange, compare-exchange) built on LDREX/STREX, for data shared between interrupt handlers of
+ *                  different priorities and tasks without masking interrupts.
+ *               2) Provide a sequence lock for state of more than one word written by a single interrupt handler or
+ *                  task and read elsewhere: the reader retries instead of blocking the writer.
+ *               3) Keep the exclusive-access instructions in the port macros.
+ *
+ *      Usage rules:
+ *               - A plain aligned 32-bit read or write is already atomic; use these operations only where the new
+ *                 value depends on the old one and another context may write in between.
+ *               - An atomic flag is a word set with OS_ui32AtomicExchange(&flag, 1U) (test-and-set, returns the
+ *                 previous value) and cleared with OS_ui32AtomicExchange(&flag, 0U).
+ *               - A sequence lock has one writer at a time. Readers copy the state between OS_ui32SeqlockReadBegin
+ *                 and OS_boolSeqlockReadRetry and discard the copy when the latter returns true. A reader must not
+ *                 interrupt the writer in a loop that waits for it (the writer would never finish): a task may read
+ *                 state written by an interrupt handler, but not the other way round.
+ */
+
+#ifndef ATOMIC_H_
+#define ATOMIC_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+/**
+ * Port layer:
+ *      OS_ATOMIC_LDREX(p)          // Load the word at p and mark it for exclusive access
+ *      OS_ATOMIC_STREX(v, p)       // Store v at p if the access is still exclusive; 0 on success
+ *      OS_ATOMIC_FENCE()           // Order the memory accesses before it against those after it
+ *
+ * The exclusive monitor is cleared on every exception entry and return, so a store-exclusive interrupted by a
+ * handler that touched the word fails and the loop retries. The core is single and in order, so the fence mainly
+ * has to stop the compiler from moving the plain (non-volatile) accesses of a seqlock or ring element across it.
+ * Volatile accesses keep their order only among themselves, so an empty fence would not do. armcl has no
+ * memory-clobber asm, so its fence is a call to OS_voidAtomicFence in atomic.c: the compiler must assume the call
+ * reads and writes every global. Host builds with GCC use an empty asm with a memory clobber.
+ */
+#define OS_ATOMIC_LDREX(p)          ((uint32_t)__ldrex((void *)(p)))       // TI ARM intrinsic
+#define OS_ATOMIC_STREX(v, p)       (__strex((v), (void *)(p)))            // TI ARM intrinsic, 0 = stored
+#if defined(__TI_ARM__)
+#define OS_ATOMIC_FENCE()           OS_voidAtomicFence()
+#else
+#define OS_ATOMIC_FENCE()           __asm__ __volatile__ ("" : : : "memory")
+#endif
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    volatile uint32_t sequence;  // Odd while a write is in progress
+} Seqlock;
+
+#define OS_SEQLOCK_INITIALIZER      {0U}
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidAtomicFence(void);
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_ui32AtomicFetchOr
+ * Inputs: volatile uint32_t *a_ptrWord - Shared word
+ *         uint32_t a_ui32Bits - Bits to set
+ * Outputs: uint32_t - Value of the word before the operation
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: *a_ptrWord |= a_ui32Bits as one atomic operation.
+ ***********************************************/
+static inline uint32_t OS_ui32AtomicFetchOr(volatile uint32_t *a_ptrWord, uint32_t a_ui32Bits)
+{
+    uint32_t ui32Old = 0;
+
+    do {
+        ui32Old = OS_ATOMIC_LDREX(a_ptrWord);
+    } while (OS_ATOMIC_STREX(ui32Old | a_ui32Bits, a_ptrWord) != 0);
+    return ui32Old;
+}
+
+/***********************************************
+ * Function Name: OS_ui32AtomicFetchAnd
+ * Inputs: volatile uint32_t *a_ptrWord - Shared word
+ *         uint32_t a_ui32Bits - Bits to keep
+ * Outputs: uint32_t - Value of the word before the operation
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: *a_ptrWord &= a_ui32Bits as one atomic operation.
+ ***********************************************/
+static inline uint32_t OS_ui32AtomicFetchAnd(volatile uint32_t *a_ptrWord, uint32_t a_ui32Bits)
+{
+    uint32_t ui32Old = 0;
+
+    do {
+        ui32Old = OS_ATOMIC_LDREX(a_ptrWord);
+    } while (OS_ATOMIC_STREX(ui32Old & a_ui32Bits, a_ptrWord) != 0);
+    return ui32Old;
+}
+
+/***********************************************
+ * Function Name: OS_ui32AtomicFetchAdd
+ * Inputs: volatile uint32_t *a_ptrWord - Shared word
+ *         uint32_t a_ui32Value - Value to add (modulo 2^32)
+ * Outputs: uint32_t - Value of the word before the operation
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: *a_ptrWord += a_ui32Value as one atomic operation.
+ ***********************************************/
+static inline uint32_t OS_ui32AtomicFetchAdd(volatile uint32_t *a_ptrWord, uint32_t a_ui32Value)
+{
+    uint32_t ui32Old = 0;
+
+    do {
+        ui32Old = OS_ATOMIC_LDREX(a_ptrWord);
+    } while (OS_ATOMIC_STREX(ui32Old + a_ui32Value, a_ptrWord) != 0);
+    return ui32Old;
+}
+
+/***********************************************
+ * Function Name: OS_ui32AtomicExchange
+ * Inputs: volatile uint32_t *a_ptrWord - Shared word
+ *         uint32_t a_ui32Value - New value
+ * Outputs: uint32_t - Value of the word before the operation
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Stores a_ui32Value and returns the value it replaced, as one atomic operation.
+ ***********************************************/
+static inline uint32_t OS_ui32AtomicExchange(volatile uint32_t *a_ptrWord, uint32_t a_ui32Value)
+{
+    uint32_t ui32Old = 0;
+
+    do {
+        ui32Old = OS_ATOMIC_LDREX(a_ptrWord);
+    } while (OS_ATOMIC_STREX(a_ui32Value, a_ptrWord) != 0);
+    return ui32Old;
+}
+
+/***********************************************
+ * Function Name: OS_boolAtomicCompareExchange
+ * Inputs: volatile uint32_t *a_ptrWord - Shared word
+ *         uint32_t a_ui32Expected - Value the word must hold
+ *         uint32_t a_ui32Desired - Value to store
+ * Outputs: bool - true if the word held a_ui32Expected and now holds a_ui32Desired
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Stores a_ui32Desired only if the word still holds a_ui32Expected, as one atomic operation.
+ ***********************************************/
+static inline bool OS_boolAtomicCompareExchange(volatile uint32_t *a_ptrWord, uint32_t a_ui32Expected,
+                                                uint32_t a_ui32Desired)
+{
+    do {
+        // The reservation left open on failure is harmless: every exclusive store here follows its own load
+        if (OS_ATOMIC_LDREX(a_ptrWord) != a_ui32Expected) {
+            return false;
+        }
+    } while (OS_ATOMIC_STREX(a_ui32Desired, a_ptrWord) != 0);
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_voidSeqlockWriteBegin
+ * Inputs: Seqlock *a_ptrLock - Lock of the shared state
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Marks the state as being written. Single writer only.
+ ***********************************************/
+static inline void OS_voidSeqlockWriteBegin(Seqlock *a_ptrLock)
+{
+    a_ptrLock->sequence++;
+    OS_ATOMIC_FENCE();
+}
+
+/***********************************************
+ * Function Name: OS_voidSeqlockWriteEnd
+ * Inputs: Seqlock *a_ptrLock - Lock of the shared state
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Publishes the state written since OS_voidSeqlockWriteBegin.
+ ***********************************************/
+static inline void OS_voidSeqlockWriteEnd(Seqlock *a_ptrLock)
+{
+    OS_ATOMIC_FENCE();
+    a_ptrLock->sequence++;
+}
+
+/***********************************************
+ * Function Name: OS_ui32SeqlockReadBegin
+ * Inputs: const Seqlock *a_ptrLock - Lock of the shared state
+ * Outputs: uint32_t - Sequence to pass to OS_boolSeqlockReadRetry
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Waits until no write is in progress, then starts a read.
+ ***********************************************/
+static inline uint32_t OS_ui32SeqlockReadBegin(const Seqlock *a_ptrLock)
+{
+    uint32_t ui32Sequence = 0;
+
+    do {
+        ui32Sequence = a_ptrLock->sequence;
+    } while ((ui32Sequence & 1U) != 0U);
+    OS_ATOMIC_FENCE();
+    return ui32Sequence;
+}
+
+/***********************************************
+ * Function Name: OS_boolSeqlockReadRetry
+ * Inputs: const Seqlock *a_ptrLock - Lock of the shared state
+ *         uint32_t a_ui32Sequence - Value returned by OS_ui32SeqlockReadBegin
+ * Outputs: bool - true if a write overlapped the read and the copy must be discarded
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Ends a read started with OS_ui32SeqlockReadBegin.
+ ***********************************************/
+static inline bool OS_boolSeqlockReadRetry(const Seqlock *a_ptrLock, uint32_t a_ui32Sequence)
+{
+    OS_ATOMIC_FENCE();
+    return (a_ptrLock->sequence != a_ui32Sequence);
+}
+
+#endif /* ATOMIC_H_ */
@@ -0,0 +1,64 @@
+/*
+ * com.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the transmission manager of the messages described in MCAL/CAN/can_db.h: a task writes the
+ *                  payload of a message whenever it has a value, and the transmission mode of the message decides
+ *                  whether and when a frame goes out, so tasks that run periodically no longer put a frame on the bus
+ *                  on every run.
+ *               2) Support the transmission modes of the message table (txMode, cycleMs, gapMs, burst):
+ *                  - CAN_DB_TX_CYCLIC: every cycleMs, with the latest payload written;
+ *                  - CAN_DB_TX_ON_CHANGE: at once when the payload written differs from the previous one;
+ *                  - CAN_DB_TX_ON_CHANGE_GAP: on change, but at least gapMs after the previous frame; changes within
+ *                    the gap are merged and the latest payload goes out when the gap ends;
+ *                  - CAN_DB_TX_MIXED: every cycleMs, and on change a fast-start burst of burst frames gapMs apart
+ *                    (the first one at once if the gap allows) before the cycle resumes;
+ *                  - CAN_DB_TX_DIRECT: not managed here; the sender calls CAN_Send itself (request replies, commands,
+ *                    reports the sender already paces).
+ *
+ *      Usage rules:
+ *               - OS_voidComMainFunction runs as a task every OS_COM_PERIOD_TICKS; OS_voidComWrite is called from tasks
+ *                 or timer callbacks (task context), never from an interrupt handler.
+ *               - A message is not sent before its first write: the first write starts its cycle.
+ *               - The payload passed to OS_voidComWrite has the message length (CAN_DLC_<message>). The alive counter
+ *                 and the checksum of a sealed message are left to CAN_Send and do not count as a change.
+ */
+
+#ifndef COM_H_
+#define COM_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "MCAL/CAN/can.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_COM_PERIOD_TICKS         10U     // Period of OS_voidComMainFunction; cycles and gaps are multiples of it
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t written;       // Payloads written
+    uint32_t sent;          // Frames passed to CAN_Send
+    uint32_t maxDelayTicks; // Longest time from a change to its first frame
+} ComStats;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidComInit(void);
+void OS_voidComWrite(uint32_t a_ui32Index, const uint8_t *a_ptrData);
+void OS_voidComMainFunction(void);
+void OS_voidComGetStats(uint32_t a_ui32Index, ComStats *a_ptrStats);
+
+#endif /* COM_H_ */
@@ -0,0 +1,163 @@
+/*
+ * deferred.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the deferred-work level between the interrupt handlers and
+ *      the task loop. A handler posts a job into a small FIFO of function pointers and pends PendSV; the PendSV
+ *      handler, at the lowest interrupt priority, drains the FIFO in posting order. The task that was running in main
+ *      is preempted for the duration of the jobs only, so a fault reaction no longer waits for a slow task (a UART
+ *      string at 9600 baud) to return.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/deferred.h"
+#include "OS/trace.h"
+#include "OS/atomic.h"
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    void (*job)(void);
+    uint32_t postCycles;         // Cycle counter at the post, for the latency statistic
+} DeferredEntry;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static DeferredEntry OS_stDeferredQueue[OS_DEFERRED_QUEUE_LEN];
+static volatile uint8_t OS_ui8DeferredHead = 0;     // Next entry to run (PendSV only)
+static volatile uint8_t OS_ui8DeferredTail = 0;     // Next free entry (posters, in a critical section)
+static DeferredStats OS_stDeferredStats = {0, 0, 0, 0};
+static Seqlock OS_stDeferredStatsLock = OS_SEQLOCK_INITIALIZER;    // Guards the PendSV fields of the statistics
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidDeferredInit
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Empties the queue, clears the statistics and installs the PendSV handler. Call before enabling the
+ *              interrupts whose handlers post jobs.
+ ***********************************************/
+void OS_voidDeferredInit(void)
+{
+    bool boolMasked = false;
+
+    OS_ENTER_CRITICAL(boolMasked);
+    OS_ui8DeferredHead = 0;
+    OS_ui8DeferredTail = 0;
+    OS_voidSeqlockWriteBegin(&OS_stDeferredStatsLock);
+    OS_stDeferredStats.maxLatencyCycles = 0;
+    OS_stDeferredStats.maxRunCycles = 0;
+    OS_stDeferredStats.runCount = 0;
+    OS_voidSeqlockWriteEnd(&OS_stDeferredStatsLock);
+    OS_stDeferredStats.overflowCount = 0;
+    OS_EXIT_CRITICAL(boolMasked);
+
+    OS_DEFERRED_PORT_INIT();
+}
+
+/***********************************************
+ * Function Name: OS_boolDeferredPost
+ * Inputs: void (*a_ptrJob)(void) - Job to run on the deferred level
+ * Outputs: bool - false if the queue is full and the job was dropped
+ * Reentrancy: Reentrant
+ * Synchronous: Asynch
+ * Description: Appends the job and pends PendSV. Intended for interrupt handlers and for jobs; interrupts are left
+ *              masked if the caller had masked them. A job posted from a job runs after the jobs already queued.
+ ***********************************************/
+bool OS_boolDeferredPost(void (*a_ptrJob)(void))
+{
+    uint8_t ui8Tail = 0;
+    bool boolMasked = false;
+
+    OS_ENTER_CRITICAL(boolMasked);
+    ui8Tail = OS_ui8DeferredTail;
+    if ((uint8_t)(ui8Tail - OS_ui8DeferredHead) >= OS_DEFERRED_QUEUE_LEN) {
+        OS_stDeferredStats.overflowCount++;
+        OS_EXIT_CRITICAL(boolMasked);
+        return false;
+    }
+    OS_stDeferredQueue[ui8Tail & OS_DEFERRED_QUEUE_MASK].job = a_ptrJob;
+    OS_stDeferredQueue[ui8Tail & OS_DEFERRED_QUEUE_MASK].postCycles = OS_CYCLE_COUNT();
+    OS_ui8DeferredTail = (uint8_t)(ui8Tail + 1U);
+    OS_EXIT_CRITICAL(boolMasked);
+
+    OS_DEFERRED_TRIGGER();
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_voidDeferredHandler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: PendSV handler. Runs the queued jobs one after the other, including jobs posted while it runs, and
+ *              updates the latency and run-time statistics. Only this handler advances the head, so an entry is
+ *              read without masking interrupts; it is also the only writer of the statistics under the sequence lock.
+ ***********************************************/
+void OS_voidDeferredHandler(void)
+{
+    DeferredEntry stEntry;
+    uint32_t ui32Start = 0;
+    uint32_t ui32Cycles = 0;
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_PENDSV, 0U);
+    while (OS_ui8DeferredHead != OS_ui8DeferredTail) {
+        stEntry = OS_stDeferredQueue[OS_ui8DeferredHead & OS_DEFERRED_QUEUE_MASK];
+        OS_ui8DeferredHead = (uint8_t)(OS_ui8DeferredHead + 1U);
+
+        ui32Start = OS_CYCLE_COUNT();
+        if (stEntry.job != 0) {
+            stEntry.job();
+        }
+        ui32Cycles = OS_CYCLE_COUNT() - ui32Start;
+
+        OS_voidSeqlockWriteBegin(&OS_stDeferredStatsLock);
+        if ((ui32Start - stEntry.postCycles) > OS_stDeferredStats.maxLatencyCycles) {
+            OS_stDeferredStats.maxLatencyCycles = ui32Start - stEntry.postCycles;
+        }
+        if (ui32Cycles > OS_stDeferredStats.maxRunCycles) {
+            OS_stDeferredStats.maxRunCycles = ui32Cycles;
+        }
+        OS_stDeferredStats.runCount++;
+        OS_voidSeqlockWriteEnd(&OS_stDeferredStatsLock);
+    }
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_PENDSV, 0U);
+}
+
+/***********************************************
+ * Function Name: OS_voidDeferredGetStats
+ * Inputs: DeferredStats *a_ptrStats - Receives a copy of the statistics
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Copies the statistics without masking interrupts. The PendSV fields are read under the sequence
+ *              lock and copied again if a job finished in between, so they belong to the same instant. Call from
+ *              task level only: a handler that preempted PendSV would wait for it forever.
+ ***********************************************/
+void OS_voidDeferredGetStats(DeferredStats *a_ptrStats)
+{
+    uint32_t ui32Sequence = 0;
+
+    do {
+        ui32Sequence = OS_ui32SeqlockReadBegin(&OS_stDeferredStatsLock);
+        a_ptrStats->maxLatencyCycles = OS_stDeferredStats.maxLatencyCycles;
+        a_ptrStats->maxRunCycles = OS_stDeferredStats.maxRunCycles;
+        a_ptrStats->runCount = OS_stDeferredStats.runCount;
+    } while (OS_boolSeqlockReadRetry(&OS_stDeferredStatsLock, ui32Sequence));
+    a_ptrStats->overflowCount = OS_stDeferredStats.overflowCount;   // Single word, written by the posters
+}
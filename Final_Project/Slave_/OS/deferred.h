@@ -0,0 +1,73 @@
+/*
+ * deferred.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the deferred-work level: short jobs posted by interrupt handlers and run from the PendSV
+ *                  exception, so they preempt the task loop in main instead of waiting for the running task to return.
+ *               2) Keep jobs cooperative among themselves: PendSV runs at the lowest interrupt priority and does not
+ *                  preempt itself, so a job runs to completion before the next one starts, and every interrupt
+ *                  handler still preempts the jobs.
+ *               3) Record the worst post-to-start latency and the longest job, from the dispatcher cycle counter.
+ *
+ *      Usage rules:
+ *               - A job is a void (void) function. It must be short and must not block: no busy-waits, no UART
+ *                 strings, no EEPROM writes. The only exception is the watchdog failure record (wdgm.c), written
+ *                 once on the way to the reset.
+ *               - Jobs run in handler mode. They may not use the software timers or resume coroutines (task context
+ *                 only); they share data with the tasks in the same way as an interrupt handler does.
+ */
+
+#ifndef DEFERRED_H_
+#define DEFERRED_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "OS/dispatcher.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_DEFERRED_QUEUE_LEN       8U      // Pending jobs; power of two
+#define OS_DEFERRED_QUEUE_MASK      (OS_DEFERRED_QUEUE_LEN - 1U)
+
+/**
+ * Port layer:
+ *      OS_DEFERRED_PORT_INIT()     // Install the PendSV handler at the lowest interrupt priority
+ *      OS_DEFERRED_TRIGGER()       // Pend PendSV; it runs as soon as no interrupt handler is active
+ */
+#define OS_DEFERRED_PRIORITY    0xE0U   // Lowest of the eight levels, peripheral interrupts keep the default 0
+#define OS_DEFERRED_PORT_INIT() do { IntRegister(FAULT_PENDSV, OS_voidDeferredHandler); \
+                                     IntPrioritySet(FAULT_PENDSV, OS_DEFERRED_PRIORITY); } while (0)
+#define OS_DEFERRED_TRIGGER()   (HWREG(NVIC_INT_CTRL) = NVIC_INT_CTRL_PEND_SV)
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t maxLatencyCycles;   // Longest time from OS_boolDeferredPost to the start of the job
+    uint32_t maxRunCycles;       // Longest job execution time
+    uint32_t runCount;           // Number of jobs run
+    uint32_t overflowCount;      // Posts rejected because the queue was full
+} DeferredStats;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidDeferredInit(void);
+bool OS_boolDeferredPost(void (*a_ptrJob)(void));
+void OS_voidDeferredHandler(void);
+void OS_voidDeferredGetStats(DeferredStats *a_ptrStats);
+
+#endif /* DEFERRED_H_ */
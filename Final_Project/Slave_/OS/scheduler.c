@@ -38,13 +38,23 @@ uint32_t OS_ui32time1 = 100;
 uint32_t OS_ui32time2 = 200;
 uint32_t OS_ui32time3 = 50;
 uint32_t OS_ui32time4 = 500;
-uint32_t OS_ui32BlinkWhiteTimer = 0;
-uint32_t OS_ui32BlinkBlueTimer = 0;
-uint32_t OS_ui32AvgTimer = 0;
-uint32_t OS_ui32SumOfReadings = 0;
-uint32_t OS_ui32CommLostTimer = 0;
+float OS_floatSumOfReadings = 0;       // Sum of the readings of the averaging window (degC)
+uint32_t OS_ui32ReadingsCount = 0;
+uint32_t OS_ui32IdleCycles = 0;         // SysTick cycles spent in tickless sleep this load sample
+uint32_t OS_ui32IdlePasses = 0;         // Scheduler passes that found nothing to run this load sample
+uint32_t OS_ui32IdlePassCycles = 0;     // Cost of one such pass, calibrated at start-up
+uint32_t OS_ui32LoadWindowStart = 0;    // Tick at which the current load sample started
+uint32_t OS_ui32LoadSamples = 0;        // Samples taken since the last report
+uint32_t OS_ui32CpuLoadSmoothedX16 = 0; // Exponential average of the samples, in 1/16 %
+uint8_t OS_ui8CpuLoad = 0;              // CPU load of the last sample (%)
+uint8_t OS_ui8CpuLoadSmoothed = 0;      // Smoothed CPU load at the last report (%)
+uint8_t OS_ui8CpuLoadPeak = 0;          // Highest sample since the last report (%)
+volatile uint32_t OS_ui32CanErrorStatus = 0;   // CAN controller status latched by CAN_handler for OS_voidCanErrorJob
+uint32_t OS_ui32BusOffCount = 0;       // Bus-off events since reset
 
 static float OS_floatTempAverage = 0;
+static volatile uint8_t OS_ui8SafeStateCode = NORMAL_STATE;   // STATE code latched by OS_voidCanReceiveHook
+static uint32_t OS_ui32ComTempDelayReported = 0x00U; // Largest TEMPERATURE change-to-frame delay reported so far (ticks)
 
 bool  boolReturnAvgFlag = false;
 bool  OS_boolCommunicationLostFlag = false;
@@ -52,8 +62,24 @@ bool  OS_boolBlinkWhiteFlag = false;
 bool  OS_boolBlinkBlueFlag = false;
 bool  OS_boolIncrementCommFlag = false;
 
+SoftTimer OS_stCommLostTimer;           // No keep-alive frame for COMM_LOST_TIMEOUT_MS
+SoftTimer OS_stBlinkBlueTimer;          // Length of the communication-lost indication
+SoftTimer OS_stBlinkWhiteTimer;         // Length of the overheat indication
+SoftTimer OS_stAvgTimer;                // Temperature averaging window
+
+// Task table generated from OS_TASK_TABLE: const (flash) and sorted by priority, run-time state in taskList
+OS_STATIC_ASSERT(OS_TASK_COUNT <= MAX_TASKS, OS_assertTaskCountFitsMaxTasks);
+OS_STATIC_ASSERT(OS_TASK_COUNT <= OS_MAX_TABLE_TASKS, OS_assertTaskCountFitsTable);
+OS_STATIC_ASSERT(OS_TASK_TABLE_PRIOS(OS_TASK_TABLE) == OS_TASK_PRIOS_EXPECTED(OS_TASK_COUNT),
+                 OS_assertTaskPrioritiesUniqueFromOne);
+OS_STATIC_ASSERT(OS_TASK_TABLE_TIMING_OK(OS_TASK_TABLE), OS_assertTaskPeriodsAreRastersWithValidOffsets);
+
+const TaskConfig OS_stTaskTable[OS_TASK_COUNT] = {
+    OS_TASK_TABLE(OS_TASK_ENTRY)
+};
+TaskControlBlock taskList[OS_TASK_COUNT];
+
 uint8_t UNIDENTIFIED = 0x30;
-uint8_t ui8taskCount = 0;
 
 
 /***********************************************
@@ -63,7 +89,9 @@ uint8_t ui8taskCount = 0;
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
  * Description: The function handles the SysTick interrupt, which triggers every
- *              millisecond. It increments the global `g_ui32SysTickCount` and
+ *              millisecond (or once per tickless sleep, in which case the tick
+ *              counter advances by every elapsed tick). It publishes the tick to
+ *              the software timers and the dispatcher. It increments the global `g_ui32SysTickCount` and
  *              checks if data has been received via SPI. Depending on the received
  *              data and the state of certain buttons, it sends different responses
  *              via SPI (e.g., `UNIDENTIFIED`, `DONT_TOUCH`, `STATE_WHITE`, or `ACK`).
@@ -74,120 +102,468 @@ uint8_t ui8taskCount = 0;
  *              is set, it changes the `counter` to `STATE_WHITE`.
  ***********************************************/
 void SYSTICK_handler(void) {
-    // Increment the millisecond counter
-    g_ui32SysTickCount++;
-    OS_ui32BlinkWhiteTimer++;
-    OS_ui32AvgTimer++;
-    OS_ui32CommLostTimer++;
-    OS_ui32BlinkBlueTimer++;
+    // Ticks covered by this interrupt (more than one after a tickless sleep)
+    uint32_t ui32Ticks = SYSTICK_ui32ElapsedTicks();
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_SYSTICK, 0x00U);
+
+    // Advance the millisecond counter
+    g_ui32SysTickCount += ui32Ticks;
+
+    // Timeouts are handled by the software timers in the scheduler loop
+    OS_voidTimerTick(g_ui32SysTickCount);
+
+    // Release the tasks whose period elapsed on this tick
+    OS_voidDispatcherTick(g_ui32SysTickCount);
 
+#if configUSE_WATCHDOG
+    // Alive supervision runs here so that it also sees a task that never returns
+    OS_voidWdgMTick(g_ui32SysTickCount);
+#endif
+
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_SYSTICK, 0x00U);
 }
 
+/***********************************************
+ * Function Name: CAN_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: CAN interrupt handler. Clears the pending message object
+ *              interrupt, reads every object holding a new received frame
+ *              into the CAN RX ring and, if there was one, releases the tasks
+ *              waiting on OS_EVENT_CAN_RX; they take the frames with
+ *              CAN_Receive. Reading the objects here frees them for the next
+ *              frame at once. A transmit complete interrupt frees the mailbox
+ *              of the confirmed frame and loads the next queued frame.
+ *              A status interrupt (bus-off or error warning change) latches
+ *              the controller status, which also clears the interrupt, and
+ *              posts OS_voidCanErrorJob to the deferred level so the reaction
+ *              does not wait for the running task. The frames read also
+ *              pass through OS_voidCanReceiveHook, which posts the safe-state
+ *              job the same way.
+ ***********************************************/
+void CAN_handler(void) {
+    uint32_t ui32Cause = CANIntStatus(CAN_BASE, CAN_INT_STS_CAUSE);
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_CAN, 0x00U);
+
+    if ((ui32Cause >= 0x01U) && (ui32Cause <= 0x20U)) {
+        CANIntClear(CAN_BASE, ui32Cause);
+        if (CAN_DrainReceiveObjects() != 0x00U) {
+            OS_voidSetEvent(OS_EVENT_CAN_RX);
+        }
+        (void)CAN_ServiceTransmitObjects();
+    } else if (ui32Cause == CAN_INT_INTID_STATUS) {
+        OS_ui32CanErrorStatus = CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
+        (void)OS_boolDeferredPost(OS_voidCanErrorJob);
+    }
+
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_CAN, 0x00U);
+}
 
 /***********************************************
- * Function Name: Scheduler
+ * Function Name: OS_voidCanErrorJob
  * Inputs: N/A
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
  * Synchronous: Synch
- * Description: The function manages the state transitions and controls
- *              the operation of LEDs based on the current state. It checks the
- *              `counter` variable to determine which state to set the LEDs to
- *              (Red, Green, Blue, White, or COMM_LOST). The function also
- *              handles the initialization of Timer1 and manages flags, including
- *              `APP_boolWhiteFlag` and `APP_boolWhiteStateFlag`. The state transitions
- *              occur in a loop, and after each state update, it introduces a delay of
- *              1 second. After the loop, it resets the index to begin the cycle again.
+ * Description: Deferred job posted by CAN_handler. On bus-off the controller
+ *              stops and sets INIT: the job turns the red LED on as the
+ *              safe-state indication and clears INIT, which rejoins the bus
+ *              after 128 occurrences of 11 recessive bits. When the status no
+ *              longer reports bus-off the indication is removed; the DTC task
+ *              drives the red LED again if a fault is still pending.
  ***********************************************/
-void scheduler(void)
+void OS_voidCanErrorJob(void)
 {
-    OS_voidCheckCANCommunication();
-    OS_voidCANHandleReceivedMessages();
-    OS_voidCheckOverheat();
-    OS_voidHeartbeatError();
-    OS_voidCheckDTC();
-    //OS_voidCheckVoltageAndRemote();
+    static bool boolBusOff = false;
 
+    if (OS_ui32CanErrorStatus & CAN_STATUS_BUS_OFF) {
+        if (!boolBusOff) {
+            OS_ui32BusOffCount++;
+        }
+        boolBusOff = true;
+        OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_CAN_BUS, 0x01U);
+        HAL_voidLedOn(RED);
+        CANEnable(CAN_BASE);
+    } else if (boolBusOff) {
+        boolBusOff = false;
+        OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_CAN_BUS, 0x00U);
+        HAL_voidLedOff(RED);
+    }
+}
 
-    //OS_ui16SendTemperature();
+/***********************************************
+ * Function Name: OS_voidCanReceiveHook
+ * Inputs: const CAN_Frame_t *frame - Frame CAN_handler just queued
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Receive hook of CAN_handler. A STATE frame reporting an
+ *              overheat or a fault latches the code and posts
+ *              OS_voidSafeStateJob; OS_voidCheckState still handles the
+ *              frame in the task for the NVM part.
+ ***********************************************/
+void OS_voidCanReceiveHook(const CAN_Frame_t *frame)
+{
+    uint8_t ui8State = 0x00U;
 
-//    int x = getVoltage();
-//
-//    UART_SendMessage("Voltage: ");
-//    UART_SendNumber(x);
-//    UART_SendMessage("v\r\n");
+    if (frame->id == CAN_ID_STATE) {
+        ui8State = (uint8_t)CAN_UnpackRaw_STATE_CODE(frame->data);
+        if ((ui8State == OVERHEAT) || (ui8State == FAULT_STATE) || (ui8State == UNEXPECTED_VOLTAGE_STATE)) {
+            OS_ui8SafeStateCode = ui8State;
+            (void)OS_boolDeferredPost(OS_voidSafeStateJob);
+        }
+    }
+}
 
+/***********************************************
+ * Function Name: OS_voidSafeStateJob
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Deferred job posted by OS_voidCanReceiveHook. Turns the green
+ *              LED off and raises the white (overheat) or red (fault)
+ *              indication flag, so the safe state shows without waiting for
+ *              the running task. The indication timers stay in the tasks.
+ ***********************************************/
+void OS_voidSafeStateJob(void)
+{
+    HAL_voidLedOff(GREEN);
+    if (OS_ui8SafeStateCode == OVERHEAT) {
+        OS_boolBlinkWhiteFlag = true;
+    } else {
+        OS_boolFaultStateFlag = true;
+    }
+}
 
-    //OS_voidECU2HandleRemoteFrame();
-    //OS_voidECU2RespondToRemoteFrame();
+/***********************************************
+ * Function Name: UART_handler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: UART0 interrupt handler. On a transmit interrupt, refills the
+ *              TX FIFO from the TX ring, so the load report does not hold
+ *              the task loop for the time the line takes to send it.
+ ***********************************************/
+void UART_handler(void) {
+    uint32_t ui32Status = 0x00U;
+
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_UART, 0x00U);
+    ui32Status = UARTIntStatus(UART_BASE, true);
+    UARTIntClear(UART_BASE, ui32Status);
+    if ((ui32Status & UART_INT_TX) != 0x00U) {
+        UART_ServiceTransmit();
+    }
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_UART, 0x00U);
 }
 
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority) {
 
-    bool check_list = (ui8taskCount < MAX_TASKS);
-    if (check_list) {
-        taskList[ui8taskCount].taskFunction = taskFunction;
-        taskList[ui8taskCount].periodTicks = periodTicks;
-        taskList[ui8taskCount].lastRunTick = 0x00U;  // Initialize last run to 0
-        taskList[ui8taskCount].priority = priority;
-        taskList[ui8taskCount].isEnabled = 0x01U;    // Enable by default
-        taskList[ui8taskCount].state = TASK_READY; // Set state to READY
-        ui8taskCount++;
+/***********************************************
+ * Function Name: OS_voidScheduler
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Runs the callbacks of the expired software timers, then the
+ *              tasks released by the SysTick tick service, highest
+ *              priority first. Each task runs once per elapsed period as
+ *              registered in `OS_voidInitTasks`; when nothing is due the
+ *              function returns immediately.
+ ***********************************************/
+void OS_voidScheduler(void) {
+    OS_voidSchedulerPass();
+
+    // No task is ready: sleep until the next release
+    OS_voidIdleTask();
+}
+
+/***********************************************
+ * Function Name: OS_voidSchedulerPass
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: One pass of the scheduler loop without the idle sleep: the
+ *              expired software timers, then the ready tasks. A pass that
+ *              finds neither is idle time; it is counted here and converted
+ *              to cycles with the cost measured by OS_voidCalibrateIdlePass,
+ *              so the load figure also covers the time the loop spins
+ *              without sleeping. The check is not atomic with the pass; a
+ *              release in between misclassifies one pass, which only moves
+ *              the figure by one pass cost.
+ ***********************************************/
+void OS_voidSchedulerPass(void)
+{
+    if ((OS_ui8HighestReadyTask() == OS_NO_TASK) && (OS_ui32TicksToNextExpiry() != 0x00U)) {
+        OS_ui32IdlePasses++;
     }
+    OS_voidTimerService();
+    OS_voidDispatch();
 }
 
-void OS_voidSortTasksByPriority(void) {
-    uint8_t i = 0;
-    uint8_t j = 0;
-    for (i = 0; i < ui8taskCount - 1; i++) {
-        for (j = i + 1; j < ui8taskCount; j++) {
-            if (taskList[i].priority > taskList[j].priority) {
-                TaskControlBlock temp = taskList[i];
-                taskList[i] = taskList[j];
-                taskList[j] = temp;
-            }
-        }
+/***********************************************
+ * Function Name: OS_voidCalibrateIdlePass
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Measures the cost of an idle scheduler pass with the
+ *              dispatcher cycle counter, averaged over
+ *              OS_LOAD_CALIBRATION_RUNS passes with interrupts masked. Call
+ *              after OS_voidDispatcherInit, before the first release, when
+ *              every pass is idle.
+ ***********************************************/
+void OS_voidCalibrateIdlePass(void)
+{
+    uint32_t i = 0x00U;
+    uint32_t ui32Begin = 0x00U;
+    bool boolMasked = IntMasterDisable();
+
+    ui32Begin = OS_CYCLE_COUNT();
+    for (i = 0x00U; i < OS_LOAD_CALIBRATION_RUNS; i++) {
+        OS_voidSchedulerPass();
+    }
+    OS_ui32IdlePassCycles = (OS_CYCLE_COUNT() - ui32Begin) / OS_LOAD_CALIBRATION_RUNS;
+    OS_ui32IdlePasses = 0x00U;
+
+    if (!boolMasked) {
+        IntMasterEnable();
     }
 }
 
-void OS_voidScheduler(void) {
-    uint32_t currentTick = g_ui32SysTickCount;
-    uint8_t highestPriorityIndex = MAX_TASKS;
-    uint8_t i = 0;
-
-    bool check_en = (taskList[i].isEnabled);
-    bool check_task = (taskList[i].state == TASK_READY);
-    bool check_priority = (highestPriorityIndex == MAX_TASKS);
-    bool list =(taskList[i].priority < taskList[highestPriorityIndex].priority);
-    for ( i = 0; i < ui8taskCount; i++) {
-        if (check_en && check_task) {
-            // Check if the task is ready to run
-            if ((currentTick - taskList[i].lastRunTick) >= taskList[i].periodTicks) {
-                if (check_priority || list) {
-                    highestPriorityIndex = i;
-                }
-            }
-        }
+/***********************************************
+ * Function Name: OS_voidIdleTask
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Runs when the dispatcher has no ready task. With configUSE_TICKLESS_IDLE
+ *              the periodic tick is suppressed and the core sleeps in WFI until the
+ *              earliest task release or software timer expiry. Interrupts are masked while the deadline is
+ *              computed so that a release cannot slip in before the WFI; the masked
+ *              interrupt still wakes the core and is serviced on unmasking. The
+ *              cycles spent asleep feed the CPU load figure.
+ ***********************************************/
+void OS_voidIdleTask(void)
+{
+#if configUSE_TICKLESS_IDLE
+    uint32_t ui32Ticks = 0x00U;
+    uint32_t ui32TimerTicks = 0x00U;
+
+    IntMasterDisable();
+    ui32Ticks = OS_ui32TicksToNextRelease();
+    ui32TimerTicks = OS_ui32TicksToNextExpiry();
+    if (ui32TimerTicks < ui32Ticks) {
+        ui32Ticks = ui32TimerTicks;
     }
+    if (ui32Ticks != 0x00U) {
+        OS_ui32IdleCycles += SYSTICK_ui32Sleep(ui32Ticks);
+    }
+    IntMasterEnable();
+#endif
+}
 
-    // Execute the highest-priority task, if any
-    if (check_priority) {
-        taskList[highestPriorityIndex].state = TASK_RUNNING;
-        taskList[highestPriorityIndex].taskFunction();
-        taskList[highestPriorityIndex].lastRunTick = currentTick;
-        taskList[highestPriorityIndex].state = TASK_READY;
-    } else {
-        // Run idle task if no tasks are ready
-        //OS_IdleTask();
+/***********************************************
+ * Function Name: OS_voidReportCpuLoad
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Takes one CPU load sample every OS_LOAD_SAMPLE_TICKS: the share of
+ *              SysTick cycles of the window since the previous call not spent idle
+ *              (in the tickless sleep or in idle scheduler passes). The samples
+ *              feed an exponential average and a peak; every
+ *              OS_LOAD_SAMPLES_PER_REPORT samples the last sample, the average
+ *              and the peak are reported on UART (with the calibrated cost of
+ *              an idle pass, to check the calibration on the bench) and in
+ *              the ECU2_CPU_LOAD frame, and the peak restarts. Each report also tells
+ *              whether the task table is still schedulable with the execution
+ *              times measured so far, so an overload shows before tasks stall,
+ *              and warns when the stack high-water mark leaves less than
+ *              OS_STACK_WARN_HEADROOM bytes free. A new longest delay from a
+ *              TEMPERATURE change to its first frame is reported once, with
+ *              the frames sent so far.
+ ***********************************************/
+void OS_voidReportCpuLoad(void)
+{
+    uint32_t ui32Now = g_ui32SysTickCount;
+    uint32_t ui32WindowCycles = (ui32Now - OS_ui32LoadWindowStart) * SYSTICK_ui32TickCycles();
+    uint32_t ui32IdlePercent = 0x00U;
+    uint32_t ui32Idle = 0x00U;
+    uint8_t ui8LoadData[CAN_DLC_ECU2_CPU_LOAD] = {0};
+    RamBudget stRam;
+    ComStats stComTemp;
+
+    if (ui32WindowCycles == 0x00U) {
+        return;
     }
 
-    // If no tasks are ready, run the idle task
-    //OS_IdleTask();
+    ui32Idle = OS_ui32IdleCycles + (OS_ui32IdlePasses * OS_ui32IdlePassCycles);
+    ui32IdlePercent = ui32Idle / ((ui32WindowCycles / 100U) + 1U);
+    if (ui32IdlePercent > 100U) {
+        ui32IdlePercent = 100U;
+    }
+    OS_ui8CpuLoad = (uint8_t)(100U - ui32IdlePercent);
+    OS_ui32IdleCycles = 0x00U;
+    OS_ui32IdlePasses = 0x00U;
+    OS_ui32LoadWindowStart = ui32Now;
+
+    // Average over about 2^OS_LOAD_SMOOTHING_SHIFT samples, kept in 1/16 % so that low loads do not round away
+    OS_ui32CpuLoadSmoothedX16 = OS_ui32CpuLoadSmoothedX16 - (OS_ui32CpuLoadSmoothedX16 >> OS_LOAD_SMOOTHING_SHIFT)
+                              + (((uint32_t)OS_ui8CpuLoad << 4U) >> OS_LOAD_SMOOTHING_SHIFT);
+    if (OS_ui8CpuLoad > OS_ui8CpuLoadPeak) {
+        OS_ui8CpuLoadPeak = OS_ui8CpuLoad;
+    }
+    OS_ui32LoadSamples++;
+    if (OS_ui32LoadSamples < OS_LOAD_SAMPLES_PER_REPORT) {
+        return;
+    }
+    OS_ui32LoadSamples = 0x00U;
+    OS_ui8CpuLoadSmoothed = (uint8_t)((OS_ui32CpuLoadSmoothedX16 + 8U) >> 4U);
+
+    UART_SendMessage("CPU load: ");
+    UART_SendNumber(OS_ui8CpuLoad);
+    UART_SendMessage("% avg ");
+    UART_SendNumber(OS_ui8CpuLoadSmoothed);
+    UART_SendMessage("% peak ");
+    UART_SendNumber(OS_ui8CpuLoadPeak);
+    UART_SendMessage("% (idle pass ");
+    UART_SendNumber(OS_ui32IdlePassCycles);
+    UART_SendMessage(" cycles)\r\n");
+    if (!OS_boolIsSchedulable(SYSTICK_ui32TickCycles(), OS_RTA_BLOCKING_US * (SysCtlClockGet() / 1000000U))) {
+        UART_SendMessage("Task table NOT schedulable\r\n");
+    }
+    OS_voidGetRamBudget(&stRam);
+    if ((stRam.stackBytes - stRam.stackPeakBytes) < OS_STACK_WARN_HEADROOM) {
+        UART_SendMessage("Stack LOW: ");
+        UART_SendNumber(stRam.stackPeakBytes);
+        UART_SendMessage("/");
+        UART_SendNumber(stRam.stackBytes);
+        UART_SendMessage(" bytes\r\n");
+    }
+    OS_voidComGetStats(CAN_DB_INDEX_TEMPERATURE, &stComTemp);
+    if (stComTemp.maxDelayTicks > OS_ui32ComTempDelayReported) {
+        OS_ui32ComTempDelayReported = stComTemp.maxDelayTicks;
+        UART_SendMessage("COM TEMPERATURE maxDelay=");
+        UART_SendNumber(stComTemp.maxDelayTicks);
+        UART_SendMessage(" ms sent=");
+        UART_SendNumber(stComTemp.sent);
+        UART_SendMessage("\r\n");
+    }
+
+    CAN_PackRaw_ECU2_CPU_LOAD_LAST(ui8LoadData, OS_ui8CpuLoad);
+    CAN_PackRaw_ECU2_CPU_LOAD_SMOOTHED(ui8LoadData, OS_ui8CpuLoadSmoothed);
+    CAN_PackRaw_ECU2_CPU_LOAD_PEAK(ui8LoadData, OS_ui8CpuLoadPeak);
+    (void)CAN_Send(CAN_ID_ECU2_CPU_LOAD, ui8LoadData, CAN_DLC_ECU2_CPU_LOAD);
+    OS_ui8CpuLoadPeak = 0x00U;
 }
 
+/***********************************************
+ * Function Name: OS_voidInitTasks
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Hands the const task table and the run-time task list to
+ *              the dispatcher. The table is generated from OS_TASK_TABLE in
+ *              OS_config.h and already sorted by priority, so slot order is
+ *              priority order and nothing is built or sorted at startup.
+ *              Then starts the watchdog manager and reports on UART a
+ *              supervision failure that caused the previous reset.
+ ***********************************************/
 void OS_voidInitTasks(void) {
-    OS_voidAddTask(OS_voidCANHandleReceivedMessages , 200 , 1);
-    OS_voidSortTasksByPriority();
+#if configUSE_WATCHDOG
+    WdgMRecord stRecord;
+#endif
+
+    OS_voidDispatcherInit(OS_stTaskTable, taskList, (uint8_t)OS_TASK_COUNT, g_ui32SysTickCount);
+    OS_voidComInit();
+    OS_voidCalibrateIdlePass();
+
+#if configUSE_WATCHDOG
+    OS_voidWdgMInit(taskList, g_ui32SysTickCount);
+    if (OS_boolWdgMLastReset(&stRecord)) {
+        UART_SendMessage("Watchdog reset: task P");
+        UART_SendNumber(stRecord.priority);
+        UART_SendMessage(" not alive for ");
+        UART_SendNumber(stRecord.stuckTicks);
+        UART_SendMessage(" ms, ");
+        UART_SendNumber(OS_ui32UsToSeconds(stRecord.detectedUs));
+        UART_SendMessage(" s after start\r\n");
+    }
+#endif
+}
+
+/***********************************************
+ * Function Name: OS_voidInitTimers
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Creates the software timers that replace the free-running
+ *              timeout counters, starts the keep-alive supervision (restarted
+ *              by every keep-alive frame from ECU1) and the periodic
+ *              temperature averaging window.
+ ***********************************************/
+void OS_voidInitTimers(void)
+{
+    OS_voidTimerCreate(&OS_stCommLostTimer, OS_voidCommLostTimeout, COMM_LOST_RECHECK_MS);
+    OS_voidTimerCreate(&OS_stBlinkBlueTimer, OS_voidBlinkBlueTimeout, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&OS_stBlinkWhiteTimer, OS_voidBlinkWhiteTimeout, BLINK_RECHECK_MS);
+    OS_voidTimerCreate(&OS_stAvgTimer, OS_voidAvgWindowTimeout, AVG_WINDOW_MS);
+
+    OS_voidTimerStart(&OS_stCommLostTimer, COMM_LOST_TIMEOUT_MS);
+    OS_voidTimerStart(&OS_stAvgTimer, AVG_WINDOW_MS);
+}
+
+// ECU1 silent for COMM_LOST_TIMEOUT_MS: indicate communication lost, re-asserted every
+// COMM_LOST_RECHECK_MS until a keep-alive frame restarts the timer
+void OS_voidCommLostTimeout(void)
+{
+    if(!OS_boolFaultStateFlag)
+    {
+        if(OS_boolBlinkWhiteFlag)
+        {
+            HAL_voidLedOff((uint32_t)WHITE);
+        }
+        OS_boolCommunicationLostFlag = true;
+        OS_boolBlinkWhiteFlag = false;
+        OS_boolBlinkBlueFlag = true;
+    }
+}
+
+// Communication-lost indication shown for BLINK_TIMEOUT_MS
+void OS_voidBlinkBlueTimeout(void)
+{
+    HAL_voidLedOff(BLUE);
+    OS_boolBlinkBlueFlag = false;
+}
+
+// Overheat indication shown for BLINK_TIMEOUT_MS: stop it unless communication is lost
+// or a fault is pending, otherwise check again after BLINK_RECHECK_MS
+void OS_voidBlinkWhiteTimeout(void)
+{
+    if(!OS_boolCommunicationLostFlag && !OS_boolFaultStateFlag)
+    {
+        OS_boolBlinkWhiteFlag = false;
+        OS_voidTimerStop(&OS_stBlinkWhiteTimer);
+    }
+}
+
+// End of the averaging window: publish the mean of the collected readings
+void OS_voidAvgWindowTimeout(void)
+{
+    if(OS_ui32ReadingsCount != 0x00U)
+    {
+        OS_floatTempAverage = OS_floatSumOfReadings / (float)OS_ui32ReadingsCount;
+        boolReturnAvgFlag = true;
+    }
+    OS_ui32ReadingsCount = 0x00U;
 }
 
 void OS_voidCheckCANCommunication(void) {
@@ -209,27 +585,8 @@ void OS_voidCheckCANCommunication(void) {
 //        HAL_voidLedOff((uint32_t)WHITE);
 //        OS_boolCommunicationLostFlag = true;
     }
-
-    if(OS_ui32CommLostTimer >= 10000 && !OS_boolFaultStateFlag)
-    {
-        if(OS_boolBlinkWhiteFlag)
-        {
-            HAL_voidLedOff((uint32_t)WHITE);
-        }
-        //HAL_voidLedOn((uint32_t)BLUE);
-        OS_boolCommunicationLostFlag = true;
-        OS_boolBlinkWhiteFlag = false;
-        OS_boolBlinkBlueFlag = true;
-        //UART_SendNumber(OS_ui32CommLostTimer);
-    }
-
-    //OS_voidSendKeepAlive();
 }
 
-void OS_voidSendKeepAlive(void) {
-        uint8_t keepAliveData[1] = {0xAA}; // Example data
-        CAN_SendMessage(CAN_KEEP_ALIVE_ID, CAN_KEEP_ALIVE_OBJ, keepAliveData, CAN_DATA_LENGTH);
-}
 void APP_voidOS(void)
 {   static bool initFlag = false;
 
@@ -237,25 +594,24 @@ void APP_voidOS(void)
     {
         OS_voidInit();
         OS_voidInitTasks();
+        OS_voidInitTimers();
         initFlag = true;
 
     }else{}
 
-//    bool systick_fire = (g_ui32SysTickCount%0x10U==0x00U);
-//    if(systick_fire){
-//        //OS_voidScheduler();
-        scheduler();
-
-//    }else{}
+    OS_voidScheduler();
 }
 
 void OS_voidMCALInit(void)
 {
+    TIMER0_init();      // One-shot delays, before UART0_init starts the first one
     UART0_init();
+    UART_EnableTxInterrupt();
     SYSTICK_init();
     CAN_Init();
     //CAN_ReceiveInit();
     CAN_ConfigureReceiveObjects();
+    CAN_SetReceiveHook(OS_voidCanReceiveHook);
     initADC();
     initADC1();
     initializeEEPROM();
@@ -271,63 +627,24 @@ void OS_voidCheckDTC(void){
 }
 void OS_voidCheckVoltageAndRemote(void)
 {
-    static uint8_t KnownVoltage[2] = {0x00};
+    uint8_t KnownVoltage[CAN_DLC_VOLTAGE] = {0x00};
+    float fVoltage = getVoltage();
 
-    KnownVoltage[0] = getVoltage();
+    CAN_Pack_VOLTAGE_SENSOR(KnownVoltage, fVoltage);
 
     UART_SendMessage("Voltage ECU2: ");
-    UART_SendNumber(KnownVoltage[0]);
+    UART_SendNumber((uint8_t)fVoltage);
     UART_SendMessage("v\r\n");
 
-    CAN_SendMessage(CAN_REMOTE_ID, CAN_REMOTE_OBJ,KnownVoltage, CAN_DATA_LENGTH);
+    (void)CAN_Send(CAN_ID_VOLTAGE, KnownVoltage, CAN_DLC_VOLTAGE);
 
 
     //CAN_ConfigureRemoteFrameHandler(CAN_KEEP_ALIVE_OBJ,KnownVoltage);
 }
-void OS_voidECU2RespondToRemoteFrame(void) {
-    uint8_t responseData[1] = {0x02};
-
-    tCANMsgObject msgObject;
-
-    // Configure the message object for response
-    msgObject.ui32MsgID = CAN_REMOTE_ID;               // Same ID as the remote frame
-    msgObject.ui32MsgIDMask = 0;              // No mask for response
-    msgObject.ui32Flags = MSG_OBJ_REMOTE_FRAME; // Enable transmission interrupt
-    msgObject.ui32MsgLen = CAN_DATA_LENGTH;                 // Two bytes for voltage
-    msgObject.pui8MsgData = responseData;
-
-    // Send the response
-    CANMessageSet(CAN_BASE, CAN_REMOTE_OBJ, &msgObject, MSG_OBJ_TYPE_RX_REMOTE);
-
-    //OS_voidCheckRXOK();
-
-    // Check if the received message is a remote frame
-    if (msgObject.ui32Flags & MSG_OBJ_REMOTE_FRAME) {
-        if(msgObject.ui32MsgID == CAN_REMOTE_ID)
-        {
-            static uint8_t KnownVoltage[2] = {0x00};
-
-            KnownVoltage[0] = getVoltage();
-
-            UART_SendMessage("Voltage ECU2: ");
-            UART_SendNumber(KnownVoltage[0]);
-            UART_SendMessage("v\r\n");
-
-
-
-            //HAL_voidLedOn(RED); // Indicate successful detection
-            CAN_SendMessage(CAN_REMOTE_ID, CAN_REMOTE_OBJ, KnownVoltage, CAN_DATA_LENGTH);
-        }
-
-    }
-}
 
 void OS_floatCalculateAverageTemperature(void) {
     static float temperature_readings[500] = {0};  // Array to store 3 readings
 
-
-    static int i = 0;  // Declare loop variable outside the loop
-
 //    // Collect three temperature readings, spaced 500ms apart
 //    for (i = 0; i <= 50; i++) {
 //        temperature_readings[i] = getTemperature();  // Get temperature reading
@@ -335,23 +652,18 @@ void OS_floatCalculateAverageTemperature(void) {
 //        sum += temperature_readings[i];
 //    }
 
-    if(OS_ui32AvgTimer <= 500)
+    // Collect readings until OS_voidAvgWindowTimeout closes the window
+    if(!boolReturnAvgFlag && (OS_ui32ReadingsCount < 500U))
     {
-        temperature_readings[i] = getTemperature();  // Get temperature reading
+        temperature_readings[OS_ui32ReadingsCount] = getTemperature();  // Get temperature reading
         //SysCtlDelay(DELAY_500MS);                   // Wait for 500ms
-        OS_ui32SumOfReadings += temperature_readings[i];
-        i++;
+        OS_floatSumOfReadings += temperature_readings[OS_ui32ReadingsCount];
+        OS_ui32ReadingsCount++;
 
 //        UART_SendMessage("Average Temperature: ");
 //        UART_SendNumber(temperature_readings[i]);
 //        UART_SendMessage("C\r\n");
     }
-    else
-    {
-        OS_floatTempAverage = OS_ui32SumOfReadings / i;
-        i=0;
-        boolReturnAvgFlag = true;
-    }
 
 //    return average;
 }
@@ -363,31 +675,6 @@ void OS_voidCheckRXOK(void)
         HAL_voidLedOn(GREEN); // Indicate successful transmission
     }
 }
-void OS_voidECU2HandleRemoteFrame(void) {
-    tCANMsgObject msgObject;
-    uint8_t unusedBuffer[8]; // Placeholder buffer
-
-    msgObject.pui8MsgData = unusedBuffer;
-
-    // Check for incoming remote frame
-    CANMessageGet(CAN_BASE, CAN_REMOTE_OBJ, &msgObject, true);
-
-    // Check transmission status
-    uint32_t status = CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
-    if (status & CAN_STATUS_RXOK) {
-        HAL_voidLedOn(GREEN); // Indicate successful transmission
-    } else {
-        //HAL_voidLedOn(RED); // Indicate transmission failure
-    }
-
-    if ((msgObject.ui32Flags & MSG_OBJ_REMOTE_FRAME)) {
-
-        HAL_voidLedOn(BLUE); // Indicate successful reception
-        // Respond to the remote frame
-        OS_voidECU2RespondToRemoteFrame();
-    }
-
-}
 
 // Simulate or read temperature
 uint8_t OS_ui16ECU2ReadTemperature(void) {
@@ -398,17 +685,16 @@ uint8_t OS_ui16ECU2ReadTemperature(void) {
 
 void OS_ui16SendTemperature(void) {
 
-    static uint8_t avg_temperature[5];
+    uint8_t avg_temperature[CAN_DLC_TEMPERATURE] = {0};
     OS_floatCalculateAverageTemperature();
 
-    avg_temperature[0] = OS_floatTempAverage;
+    CAN_Pack_TEMPERATURE_AVERAGE(avg_temperature, OS_floatTempAverage);
 
     if(boolReturnAvgFlag)
     {
-        OS_ui32AvgTimer = 0;
         boolReturnAvgFlag = false;
-        OS_ui32SumOfReadings = 0;
-        CAN_SendMessage(CAN_TEMP_ID, CAN_TEMP_OBJ,avg_temperature, CAN_DATA_LENGTH); // Message Object 2, ID: 0x102
+        OS_floatSumOfReadings = 0;
+        OS_voidComWrite(CAN_DB_INDEX_TEMPERATURE, avg_temperature); // ID: 0x102, sent on change or every second
     }
     else{}
 
@@ -438,44 +724,34 @@ void CAN_ReceiveMessage(void) {
 }
 
 void OS_voidCANHandleReceivedMessages(void) {
-    uint8_t receivedData[8];
-    tCANMsgObject msgObject;
+    CAN_Frame_t stFrame;
 
-    // Temporary storage for message data
-    msgObject.pui8MsgData = receivedData;
+    // Every frame CAN_handler queued since the last release, oldest first
+    while (CAN_Receive(&stFrame)) {
 
-    // Check Message Object 2 (Temperature data)
-    CANMessageGet(CAN_BASE, CAN_KEEP_ALIVE_OBJ, &msgObject, true);
-
-
-    if (msgObject.ui32Flags & MSG_OBJ_NEW_DATA) {
-
-        if(msgObject.ui32MsgID == CAN_REMOTE_ID)
+        if(stFrame.id == CAN_ID_VOLTAGE)
         {
             OS_voidCheckVoltageAndRemote();
         }
 
-        if(msgObject.ui32MsgID == CAN_KEEP_ALIVE_ID)
+        if(stFrame.id == CAN_ID_KEEP_ALIVE)
         {
-            OS_ui16SendTemperature();
-            //OS_voidSendKeepAlive();
             //HAL_voidLedOn(BLUE);
             //UART_SendNumber(receivedData[0]);
-            OS_ui32CommLostTimer = 0;
+            OS_voidTimerStart(&OS_stCommLostTimer, COMM_LOST_TIMEOUT_MS);
             OS_boolBlinkBlueFlag = false;
-            OS_boolFaultStateFlag = false;
             OS_boolIncrementCommFlag = false;
             NVM_CommRet();
         }
         else{
         }
-        if(msgObject.ui32MsgID == CAN_STATE_ID)
+        if(stFrame.id == CAN_ID_STATE)
         {
             //HAL_voidLedBlink(GREEN);
-            OS_voidCheckState(receivedData[0]);
+            OS_voidCheckState((uint8_t)CAN_UnpackRaw_STATE_CODE(stFrame.data));
             //UART_SendNumber(receivedData[0]);
         }
-        if(msgObject.ui32MsgID == CAN_GPIO_CONTROL_ID)
+        if(stFrame.id == CAN_ID_GPIO_CONTROL)
         {
             HAL_voidLedOn(RED);
 
@@ -489,6 +765,12 @@ void OS_voidCANHandleReceivedMessages(void) {
 
 void OS_voidCheckState(uint8_t STATE)
 {
+    // ECU1 sends a state only when it changes (and once a second): a fault lasts until it reports normal again
+    if(STATE == NORMAL_STATE)
+    {
+        OS_boolFaultStateFlag = false;
+    }
+
     if(STATE == NORMAL_STATE && !OS_boolBlinkWhiteFlag)
     {
         if(!OS_boolBlinkWhiteFlag)
@@ -497,22 +779,13 @@ void OS_voidCheckState(uint8_t STATE)
         }
         HAL_voidLedOn(GREEN);
     }
-    else if(STATE == OVERHEAT)
-    {
-        HAL_voidLedOff(GREEN);
-        OS_boolBlinkWhiteFlag = true;
-        //OS_voidECU2RespondToRemoteFrame();
-    }
+    // OVERHEAT, FAULT_STATE and UNEXPECTED_VOLTAGE_STATE: OS_voidSafeStateJob already set the LEDs and flags
     else if(STATE == FAULT_STATE)
         {
-            HAL_voidLedOff(GREEN);
-            OS_boolFaultStateFlag = true;
             NVM_StateReminder();
         }
     else if(STATE == UNEXPECTED_VOLTAGE_STATE)
     {
-        HAL_voidLedOff(GREEN);
-        OS_boolFaultStateFlag = true;
         NVM_StateReminder();
 
     }
@@ -528,15 +801,16 @@ void OS_voidCheckOverheat(void)
 
     if(OS_boolBlinkWhiteFlag && !OS_boolCommunicationLostFlag && !OS_boolFaultStateFlag)
     {
-        if(OS_ui32BlinkWhiteTimer >= 20000)
+        // OS_voidBlinkWhiteTimeout ends the indication
+        if(!OS_boolTimerIsActive(&OS_stBlinkWhiteTimer))
         {
-            OS_boolBlinkWhiteFlag = false;
+            OS_voidTimerStart(&OS_stBlinkWhiteTimer, BLINK_TIMEOUT_MS);
         }
         HAL_voidLedBlink(WHITE);
     }
     else if(!OS_boolBlinkWhiteFlag && !OS_boolFaultStateFlag){
         //HAL_voidLedOff(WHITE);
-        OS_ui32BlinkWhiteTimer = 0;
+        OS_voidTimerStop(&OS_stBlinkWhiteTimer);
     }
 
 }
@@ -550,10 +824,10 @@ void OS_voidHeartbeatError(void)
             NVM_voidIncrementCommunicationDTCCounter();
         }
 
-        if(OS_ui32BlinkBlueTimer >= 20000)
+        // OS_voidBlinkBlueTimeout ends the indication
+        if(!OS_boolTimerIsActive(&OS_stBlinkBlueTimer))
         {
-            HAL_voidLedOff(BLUE);
-            OS_boolBlinkBlueFlag = false;
+            OS_voidTimerStart(&OS_stBlinkBlueTimer, BLINK_TIMEOUT_MS);
         }
         HAL_voidLedOff(GREEN);
         HAL_voidLedBlink(BLUE);
@@ -561,7 +835,7 @@ void OS_voidHeartbeatError(void)
     else
     {
         HAL_voidLedOff(BLUE);
-        OS_ui32BlinkBlueTimer = 0;
+        OS_voidTimerStop(&OS_stBlinkBlueTimer);
     }
 
 
@@ -570,6 +844,8 @@ void OS_voidHeartbeatError(void)
 
 void OS_voidInit(void)
 {
+    OS_voidDeferredInit();     // Deferred-work level, before the interrupts that post to it
+    OS_voidTimeBaseInit();     // 64-bit time base, before the first timestamp
     OS_voidMCALInit();
     OS_voidHALInit();
 }
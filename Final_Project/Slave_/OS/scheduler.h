@@ -37,6 +37,12 @@
 #include "HAL/buttons.h"
 #include "OS/OS_config.h"
 #include "MCAL/NVM/NVM.h"
+#include "OS/swtimer.h"
+#include "OS/deferred.h"
+#include "OS/wdgm.h"
+#include "OS/timebase.h"
+#include "OS/trace.h"
+#include "OS/com.h"
 
 
 /***********************************************
@@ -53,6 +59,16 @@
 
 #define GPIO_ON                         0x06
 
+// Software timer intervals (1 ms ticks)
+#define COMM_LOST_TIMEOUT_MS            10000U  // No keep-alive frame before the blue indication
+#define COMM_LOST_RECHECK_MS            100U    // Re-assert interval while communication stays lost
+#define BLINK_TIMEOUT_MS                20000U  // Length of the white/blue indications
+#define BLINK_RECHECK_MS                100U    // Retry interval while a fault keeps the indication on
+#define AVG_WINDOW_MS                   500U    // Temperature averaging window
+
+// Task activation events, set by the interrupt handlers
+#define OS_EVENT_CAN_RX                 OS_EVENT(0)     // A CAN message object received a frame
+
 /***********************************************
  * Shared Global Variables                     *
  ***********************************************/
@@ -79,8 +95,6 @@ uint32_t StoredValues[MAX_ELEMENTS];
  ***********************************************/
 void APP_voidOS(void);
 void OS_voidCheckCANCommunication(void);
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority);
-void OS_voidSortTasksByPriority(void);
 void OS_voidInitTasks(void);
 void OS_voidInit(void);
 void OS_voidMCALInit(void);
@@ -89,16 +103,26 @@ void OS_voidInitAll(void);
 void OS_voidCANHandleReceivedMessages(void);
 uint8_t OS_ui16ECU2ReadTemperature(void);
 void OS_ui16SendTemperature(void);
-void OS_voidECU2RespondToRemoteFrame(void);
-void OS_voidECU2HandleRemoteFrame(void);
 void OS_voidCheckRXOK(void);
 void OS_floatCalculateAverageTemperature(void);
 void OS_voidCheckState(uint8_t TempValue);
 void OS_voidCheckOverheat(void);
 void OS_voidHeartbeatError(void);
+void OS_voidInitTimers(void);
+void OS_voidCanErrorJob(void);
+void OS_voidCanReceiveHook(const CAN_Frame_t *frame);
+void OS_voidSafeStateJob(void);
+void OS_voidCommLostTimeout(void);
+void OS_voidBlinkBlueTimeout(void);
+void OS_voidBlinkWhiteTimeout(void);
+void OS_voidAvgWindowTimeout(void);
 void OS_voidCheckVoltageAndRemote(void);
 void OS_voidCheckDTC(void);
-void OS_voidSendKeepAlive(void);
+void OS_voidScheduler(void);
+void OS_voidSchedulerPass(void);
+void OS_voidCalibrateIdlePass(void);
+void OS_voidIdleTask(void);
+void OS_voidReportCpuLoad(void);
 
 
 void INITIALIZATION_MCAL(void);
@@ -107,7 +131,5 @@ void INITIALIZATION_leds(void);
 void SPI_put(uint32_t a_uint32data);
 bool SPI_check(void);
 
-void scheduler(void);
-
 
 #endif /* SCHEDULER_H_ */
@@ -0,0 +1,115 @@
+/*
+ * spsc.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the single-producer/single-consumer ring buffer. The
+ *      element bytes are copied through a volatile pointer and the owning index is written last, behind a fence, so
+ *      the other side never sees an index that covers an element not yet copied.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/spsc.h"
+#include "OS/atomic.h"
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidSpscInit
+ * Inputs: SpscRing *a_ptrRing - Ring to initialize
+ *         void *a_ptrBuffer - Storage of a_ui32Capacity elements
+ *         uint32_t a_ui32ElementSize - Bytes per element
+ *         uint32_t a_ui32Capacity - Number of elements; power of two
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Empties the ring. Call before either side uses it (before the producer's interrupt is enabled).
+ ***********************************************/
+void OS_voidSpscInit(SpscRing *a_ptrRing, void *a_ptrBuffer, uint32_t a_ui32ElementSize, uint32_t a_ui32Capacity)
+{
+    a_ptrRing->buffer = (volatile uint8_t *)a_ptrBuffer;
+    a_ptrRing->elementSize = a_ui32ElementSize;
+    a_ptrRing->mask = a_ui32Capacity - 1U;
+    a_ptrRing->head = 0;
+    a_ptrRing->tail = 0;
+    a_ptrRing->dropped = 0;
+}
+
+/***********************************************
+ * Function Name: OS_boolSpscPush
+ * Inputs: SpscRing *a_ptrRing - Ring
+ *         const void *a_ptrElement - Element to copy in
+ * Outputs: bool - false if the ring was full and the element was dropped
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Producer side.
+ ***********************************************/
+bool OS_boolSpscPush(SpscRing *a_ptrRing, const void *a_ptrElement)
+{
+    uint32_t ui32Head = a_ptrRing->head;
+    uint32_t i = 0;
+    const uint8_t *ptrSource = (const uint8_t *)a_ptrElement;
+    volatile uint8_t *ptrSlot = 0;
+
+    if ((ui32Head - a_ptrRing->tail) > a_ptrRing->mask) {
+        a_ptrRing->dropped++;
+        return false;
+    }
+
+    ptrSlot = &a_ptrRing->buffer[(ui32Head & a_ptrRing->mask) * a_ptrRing->elementSize];
+    for (i = 0; i < a_ptrRing->elementSize; i++) {
+        ptrSlot[i] = ptrSource[i];
+    }
+    OS_ATOMIC_FENCE();
+    a_ptrRing->head = ui32Head + 1U;
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_boolSpscPop
+ * Inputs: SpscRing *a_ptrRing - Ring
+ *         void *a_ptrElement - Receives the oldest element
+ * Outputs: bool - false if the ring was empty
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Consumer side.
+ ***********************************************/
+bool OS_boolSpscPop(SpscRing *a_ptrRing, void *a_ptrElement)
+{
+    uint32_t ui32Tail = a_ptrRing->tail;
+    uint32_t i = 0;
+    uint8_t *ptrDest = (uint8_t *)a_ptrElement;
+    volatile uint8_t *ptrSlot = 0;
+
+    if (a_ptrRing->head == ui32Tail) {
+        return false;
+    }
+    OS_ATOMIC_FENCE();
+
+    ptrSlot = &a_ptrRing->buffer[(ui32Tail & a_ptrRing->mask) * a_ptrRing->elementSize];
+    for (i = 0; i < a_ptrRing->elementSize; i++) {
+        ptrDest[i] = ptrSlot[i];
+    }
+    OS_ATOMIC_FENCE();
+    a_ptrRing->tail = ui32Tail + 1U;
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_ui32SpscCount
+ * Inputs: const SpscRing *a_ptrRing - Ring
+ * Outputs: uint32_t - Elements waiting to be popped
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: A snapshot: the producer may add elements and the consumer remove them right after the read.
+ ***********************************************/
+uint32_t OS_ui32SpscCount(const SpscRing *a_ptrRing)
+{
+    return a_ptrRing->head - a_ptrRing->tail;
+}
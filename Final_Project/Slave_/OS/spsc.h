@@ -0,0 +1,50 @@
+/*
+ * spsc.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the single-producer/single-consumer ring buffer: fixed-size elements passed from one
+ *                  interrupt handler to one task (or the other way round) without masking interrupts.
+ *               2) Keep each index written by one side only: the producer advances head after the element is
+ *                  stored, the consumer advances tail after it is copied out, so neither needs a lock and a push
+ *                  never waits for the consumer. A full ring refuses the push and counts it.
+ *
+ *      Usage rules:
+ *               - One producer context and one consumer context per ring. Several interrupt handlers feeding one
+ *                 queue need the deferred queue or their own rings.
+ *               - The capacity is a power of two; head and tail run freely and wrap at 2^32.
+ */
+
+#ifndef SPSC_H_
+#define SPSC_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    volatile uint8_t *buffer;    // capacity * elementSize bytes
+    uint32_t elementSize;        // Bytes per element
+    uint32_t mask;               // capacity - 1
+    volatile uint32_t head;      // Elements pushed, written by the producer only
+    volatile uint32_t tail;      // Elements popped, written by the consumer only
+    uint32_t dropped;            // Pushes refused because the ring was full, written by the producer only
+} SpscRing;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidSpscInit(SpscRing *a_ptrRing, void *a_ptrBuffer, uint32_t a_ui32ElementSize, uint32_t a_ui32Capacity);
+bool OS_boolSpscPush(SpscRing *a_ptrRing, const void *a_ptrElement);
+bool OS_boolSpscPop(SpscRing *a_ptrRing, void *a_ptrElement);
+uint32_t OS_ui32SpscCount(const SpscRing *a_ptrRing);
+
+#endif /* SPSC_H_ */
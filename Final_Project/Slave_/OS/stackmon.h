@@ -0,0 +1,53 @@
+/*
+ * stackmon.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the stack monitor: the system stack (.stack, shared by main, the tasks and every interrupt)
+ *                  is painted with a known pattern by the reset handler, and the deepest word no longer holding the
+ *                  pattern gives the high-water mark.
+ *               2) Provide the repaint/measure pair the dispatcher uses around every task run to attribute stack
+ *                  depth to individual tasks.
+ *               3) Provide the RAM budget of the image (.data, .bss, .stack) from the section symbols exported by the
+ *                  linker command file, for the report in tester mode.
+ */
+
+#ifndef STACKMON_H_
+#define STACKMON_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_STACK_PAINT_PATTERN      0xA5A5A5A5UL    // Fill value of unused stack words
+#define OS_STACK_PAINT_MARGIN       8U              // Words left unpainted below the caller's frame
+#define OS_STACK_WARN_HEADROOM      64U             // Free stack bytes below which the report warns
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t dataBytes;          // Initialised variables (.data)
+    uint32_t bssBytes;           // Zero-initialised variables (.bss)
+    uint32_t stackBytes;         // Size of the system stack (.stack)
+    uint32_t stackPeakBytes;     // Deepest stack use seen since reset
+} RamBudget;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidStackPaint(void);
+uint32_t OS_ui32StackUsed(void);
+uint32_t OS_ui32StackHighWater(void);
+void OS_voidGetRamBudget(RamBudget *a_ptrBudget);
+
+#endif /* STACKMON_H_ */
@@ -0,0 +1,54 @@
+/*
+ * swtimer.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the software timer object and the start/stop/restart API used to replace free-running
+ *                  timeout counters.
+ *               2) Keep the SysTick interrupt cost constant: the tick service only publishes the current tick, while
+ *                  expiry processing and callbacks run from the scheduler loop in task context.
+ */
+
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_TIMER_ONE_SHOT           0U              // Reload value of a timer that stops after expiring
+#define OS_TIMER_NONE_ACTIVE        0xFFFFFFFFUL    // Returned when no timer is running
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct SoftTimer {
+    struct SoftTimer *next;      // Next timer in the active list
+    struct SoftTimer *prev;      // Previous timer in the active list
+    uint32_t delta;              // Ticks after the expiry of the previous timer in the list
+    uint32_t reloadTicks;        // Restart interval after expiry, OS_TIMER_ONE_SHOT to stop
+    void (*callback)(void);      // Called from the scheduler loop on expiry
+    bool isActive;
+} SoftTimer;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidTimerCreate(SoftTimer *a_ptrTimer, void (*a_ptrCallback)(void), uint32_t a_ui32ReloadTicks);
+void OS_voidTimerStart(SoftTimer *a_ptrTimer, uint32_t a_ui32Ticks);
+void OS_voidTimerStop(SoftTimer *a_ptrTimer);
+bool OS_boolTimerIsActive(const SoftTimer *a_ptrTimer);
+void OS_voidTimerTick(uint32_t a_ui32Now);
+void OS_voidTimerService(void);
+uint32_t OS_ui32TicksToNextExpiry(void);
+
+#endif /* SWTIMER_H_ */
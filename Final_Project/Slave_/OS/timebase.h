@@ -0,0 +1,66 @@
+/*
+ * timebase.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the monotonic time base: a 64-bit count of CPU cycles since OS_voidTimeBaseInit, readable in
+ *                  cycles or microseconds from tasks, interrupt handlers and deferred jobs alike.
+ *               2) Give timestamps that neither wrap in the life of the device (the 64-bit cycle count lasts for
+ *                  thousands of years) nor depend on the system tick, which the tickless sleep adjusts in steps.
+ *               3) Keep the hardware access in the port macros.
+ *
+ *      Usage rules:
+ *               - g_ui32SysTickCount remains the scheduling tick; compare ticks only by unsigned subtraction. Use the
+ *                 time base for timestamps and for anything finer than one tick.
+ *               - Differences of OS_ui64TimeUs values are exact; there is no rollover to handle.
+ */
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_TIMEBASE_US_PER_S        1000000UL
+
+/**
+ * Port layer:
+ *      OS_TIMEBASE_PORT_INIT()     // Start the free-running 64-bit counter at the CPU clock
+ *      OS_TIMEBASE_COUNT()         // Read the counter, consistent across the carry between its two halves
+ *      OS_TIMEBASE_CLOCK_HZ()      // Counter clock; a whole number of MHz
+ *
+ * The counter is WTIMER0 in concatenated 64-bit periodic-up mode. TimerValueGet64 reads the high, low and again the
+ * high half, and reads the low half once more if the high half changed in between, so a read is consistent without
+ * masking interrupts and may be taken from any context.
+ */
+#define OS_TIMEBASE_PORT_INIT() do { SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER0); \
+                                     while (!SysCtlPeripheralReady(SYSCTL_PERIPH_WTIMER0)) {} \
+                                     TimerConfigure(WTIMER0_BASE, TIMER_CFG_PERIODIC_UP); \
+                                     TimerLoadSet64(WTIMER0_BASE, 0xFFFFFFFFFFFFFFFFULL); \
+                                     TimerControlStall(WTIMER0_BASE, TIMER_A, true); \
+                                     TimerEnable(WTIMER0_BASE, TIMER_A); } while (0)
+#define OS_TIMEBASE_COUNT()     TimerValueGet64(WTIMER0_BASE)
+#define OS_TIMEBASE_CLOCK_HZ()  SysCtlClockGet()
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidTimeBaseInit(void);
+uint64_t OS_ui64TimeCycles(void);
+uint64_t OS_ui64TimeUs(void);
+uint64_t OS_ui64UsToCycles(uint64_t a_ui64Us);
+uint32_t OS_ui32UsToSeconds(uint64_t a_ui64Us);
+
+#endif /* TIMEBASE_H_ */
@@ -0,0 +1,315 @@
+/*
+ * trace.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the trace recorder. Events go into a power-of-two ring
+ *      indexed by a free-running head counter; a slot is claimed and filled with interrupts masked, so events from
+ *      tasks, interrupt handlers and deferred jobs never interleave inside one slot. The export stops recording,
+ *      rebuilds 64-bit time from the 32-bit cycle stamps (consecutive events are assumed less than 2^32 cycles apart,
+ *      which the SysTick entries guarantee) and prints Chrome trace-event JSON with microsecond timestamps:
+ *      tasks, interrupts and CAN frames on separate timeline rows, state variables as counters.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/trace.h"
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_TRACE_CALIBRATION_RUNS   8U      // Events recorded by OS_voidTraceStart to measure the cost
+#define OS_TRACE_ROW_TASKS          "1"     // Timeline rows (tid) of the export
+#define OS_TRACE_ROW_ISRS           "2"
+#define OS_TRACE_ROW_CAN            "3"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static TraceEvent OS_stTraceBuffer[OS_TRACE_EVENTS];
+static uint32_t OS_ui32TraceHead = 0;               // Events recorded since start; the next one goes to head & mask
+static volatile bool OS_boolTraceOn = false;
+static uint32_t OS_ui32TraceCost = 0;               // Measured cycles per event
+
+static const char * const OS_pcTraceIsrNames[OS_TRACE_ISR_COUNT] = {
+    "SysTick", "CAN", "UART", "Buttons", "Timer0", "PendSV"
+};
+static const char * const OS_pcTraceStateNames[OS_TRACE_STATE_COUNT] = {
+    "UartState", "CanBusOff"
+};
+
+// Export in progress
+static void (*OS_ptrTracePut)(const char *) = 0;
+static uint32_t OS_ui32TraceExportNext = 0;         // Head count of the next event to export
+static uint32_t OS_ui32TraceExportEnd = 0;          // Head count when the export began
+static uint32_t OS_ui32TraceLastCycles = 0;         // Stamp of the previous exported event
+static uint64_t OS_ui64TraceElapsed = 0;            // Cycles from the first exported event
+static char OS_pcTraceLine[OS_TRACE_LINE_LEN];      // Line being exported; static to keep it off the shared stack
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidTraceStart
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Empties the buffer and starts recording. Records OS_TRACE_CALIBRATION_RUNS events first to measure
+ *              the cost per event (an interrupt taken meanwhile only makes the figure pessimistic), then discards
+ *              them. Call from task context.
+ ***********************************************/
+void OS_voidTraceStart(void)
+{
+    uint8_t i = 0;
+    uint32_t ui32Begin = 0;
+
+    OS_boolTraceOn = true;
+    ui32Begin = OS_CYCLE_COUNT();
+    for (i = 0; i < OS_TRACE_CALIBRATION_RUNS; i++) {
+        OS_voidTraceRecord(0U, 0U, 0U);
+    }
+    OS_ui32TraceCost = (OS_CYCLE_COUNT() - ui32Begin) / OS_TRACE_CALIBRATION_RUNS;
+    OS_ui32TraceHead = 0;
+}
+
+/***********************************************
+ * Function Name: OS_voidTraceStop
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Freezes the buffer; OS_voidTraceRecord returns at once until the next OS_voidTraceStart.
+ ***********************************************/
+void OS_voidTraceStop(void)
+{
+    OS_boolTraceOn = false;
+}
+
+/***********************************************
+ * Function Name: OS_voidTraceRecord
+ * Inputs: uint8_t a_ui8Type - OS_TRACE_xxx event type
+ *         uint8_t a_ui8Id - Task slot, interrupt source, message object or state variable
+ *         uint16_t a_ui16Data - CAN identifier or state value, 0 if unused
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Stores one event, overwriting the oldest when the buffer is full. Safe from tasks, interrupt
+ *              handlers and deferred jobs, and from inside a critical section.
+ ***********************************************/
+void OS_voidTraceRecord(uint8_t a_ui8Type, uint8_t a_ui8Id, uint16_t a_ui16Data)
+{
+    TraceEvent *ptrEvent = 0;
+    uint32_t ui32State = 0;
+
+    if (!OS_boolTraceOn) {
+        return;
+    }
+
+    ui32State = OS_TRACE_LOCK();
+    ptrEvent = &OS_stTraceBuffer[OS_ui32TraceHead & OS_TRACE_MASK];
+    OS_ui32TraceHead++;
+    ptrEvent->cycles = OS_CYCLE_COUNT();
+    ptrEvent->type = a_ui8Type;
+    ptrEvent->id = a_ui8Id;
+    ptrEvent->data = a_ui16Data;
+    OS_TRACE_UNLOCK(ui32State);
+}
+
+/***********************************************
+ * Function Name: OS_ui32TraceCostCycles
+ * Inputs: N/A
+ * Outputs: uint32_t - Cycles per recorded event, measured by the last OS_voidTraceStart
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Includes the call and the loop around it.
+ ***********************************************/
+uint32_t OS_ui32TraceCostCycles(void)
+{
+    return OS_ui32TraceCost;
+}
+
+/***********************************************
+ * Function Name: OS_ui8TraceAppend
+ * Inputs: char *a_pcLine - Line being built
+ *         uint8_t a_ui8Pos - Current length of the line
+ *         const char *a_pcText - Text to append
+ * Outputs: uint8_t - New length of the line
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Appends as much of the text as fits in OS_TRACE_LINE_LEN - 1 characters.
+ ***********************************************/
+static uint8_t OS_ui8TraceAppend(char *a_pcLine, uint8_t a_ui8Pos, const char *a_pcText)
+{
+    while ((*a_pcText != '\0') && (a_ui8Pos < (OS_TRACE_LINE_LEN - 1U))) {
+        a_pcLine[a_ui8Pos] = *a_pcText;
+        a_ui8Pos++;
+        a_pcText++;
+    }
+    a_pcLine[a_ui8Pos] = '\0';
+    return a_ui8Pos;
+}
+
+/***********************************************
+ * Function Name: OS_ui8TraceAppendNumber
+ * Inputs: char *a_pcLine - Line being built
+ *         uint8_t a_ui8Pos - Current length of the line
+ *         uint32_t a_ui32Value - Value to append
+ *         uint8_t a_ui8Base - 10 or 16
+ *         uint8_t a_ui8MinDigits - Zero-padded to at least this many digits
+ * Outputs: uint8_t - New length of the line
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Formats an unsigned number without the C library, in a static buffer.
+ ***********************************************/
+static uint8_t OS_ui8TraceAppendNumber(char *a_pcLine, uint8_t a_ui8Pos, uint32_t a_ui32Value, uint8_t a_ui8Base,
+                                       uint8_t a_ui8MinDigits)
+{
+    static const char pcDigits[] = "0123456789ABCDEF";
+    static char pcText[11];
+    uint8_t ui8Index = sizeof(pcText) - 1U;
+
+    pcText[ui8Index] = '\0';
+    do {
+        ui8Index--;
+        pcText[ui8Index] = pcDigits[a_ui32Value % a_ui8Base];
+        a_ui32Value /= a_ui8Base;
+        if (a_ui8MinDigits > 0U) {
+            a_ui8MinDigits--;
+        }
+    } while (((a_ui32Value != 0U) || (a_ui8MinDigits > 0U)) && (ui8Index > 0U));
+
+    return OS_ui8TraceAppend(a_pcLine, a_ui8Pos, &pcText[ui8Index]);
+}
+
+/***********************************************
+ * Function Name: OS_voidTraceExportBegin
+ * Inputs: void (*a_ptrPutString)(const char *) - Writes a string to the terminal (UART_SendMessage on the target)
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Stops recording and writes the JSON header: the measured cost per event against the budget, the
+ *              number of events lost to overwriting, and the names of the timeline rows. Follow with
+ *              OS_boolTraceExportStep until it returns false.
+ ***********************************************/
+void OS_voidTraceExportBegin(void (*a_ptrPutString)(const char *))
+{
+    char *pcLine = OS_pcTraceLine;
+    uint8_t ui8Pos = 0;
+
+    OS_voidTraceStop();
+    OS_ptrTracePut = a_ptrPutString;
+    OS_ui32TraceExportEnd = OS_ui32TraceHead;
+    OS_ui32TraceExportNext = (OS_ui32TraceHead > OS_TRACE_EVENTS) ? (OS_ui32TraceHead - OS_TRACE_EVENTS) : 0U;
+    OS_ui32TraceLastCycles = OS_stTraceBuffer[OS_ui32TraceExportNext & OS_TRACE_MASK].cycles;
+    OS_ui64TraceElapsed = 0;
+
+    ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, "{\"otherData\":{\"costCycles\":");
+    ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, OS_ui32TraceCost, 10U, 1U);
+    ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",\"budgetCycles\":");
+    ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, OS_TRACE_COST_BUDGET, 10U, 1U);
+    ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",\"lost\":");
+    ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, OS_ui32TraceExportNext, 10U, 1U);
+    (void)OS_ui8TraceAppend(pcLine, ui8Pos, "},\"traceEvents\":[\r\n");
+    OS_ptrTracePut(pcLine);
+
+    OS_ptrTracePut("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" OS_TRACE_ROW_TASKS
+                   ",\"args\":{\"name\":\"Tasks\"}}\r\n");
+    OS_ptrTracePut(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" OS_TRACE_ROW_ISRS
+                   ",\"args\":{\"name\":\"Interrupts\"}}\r\n");
+    OS_ptrTracePut(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" OS_TRACE_ROW_CAN
+                   ",\"args\":{\"name\":\"CAN\"}}\r\n");
+}
+
+/***********************************************
+ * Function Name: OS_boolTraceExportStep
+ * Inputs: N/A
+ * Outputs: bool - true while events remain, false once the JSON is closed
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Writes the next event as one JSON line. After the last one closes the JSON and restarts recording
+ *              with an empty buffer.
+ ***********************************************/
+bool OS_boolTraceExportStep(void)
+{
+    char *pcLine = OS_pcTraceLine;
+    uint8_t ui8Pos = 0;
+    const TraceEvent *ptrEvent = 0;
+    uint64_t ui64Nanos = 0;
+
+    if (OS_ptrTracePut == 0) {
+        return false;
+    }
+    if (OS_ui32TraceExportNext == OS_ui32TraceExportEnd) {
+        OS_ptrTracePut("]}\r\n");
+        OS_ptrTracePut = 0;
+        OS_voidTraceStart();
+        return false;
+    }
+
+    ptrEvent = &OS_stTraceBuffer[OS_ui32TraceExportNext & OS_TRACE_MASK];
+    OS_ui32TraceExportNext++;
+    OS_ui64TraceElapsed += (uint32_t)(ptrEvent->cycles - OS_ui32TraceLastCycles);
+    OS_ui32TraceLastCycles = ptrEvent->cycles;
+
+    switch (ptrEvent->type) {
+    case OS_TRACE_TASK_START:
+    case OS_TRACE_TASK_END:
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",{\"name\":\"P");
+        ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, (uint32_t)ptrEvent->id + 1U, 10U, 1U);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, (ptrEvent->type == OS_TRACE_TASK_START) ? "\",\"ph\":\"B\",\"tid\":"
+                                                   OS_TRACE_ROW_TASKS : "\",\"ph\":\"E\",\"tid\":" OS_TRACE_ROW_TASKS);
+        break;
+    case OS_TRACE_ISR_ENTER:
+    case OS_TRACE_ISR_EXIT:
+        if (ptrEvent->id >= OS_TRACE_ISR_COUNT) {
+            return true;
+        }
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",{\"name\":\"");
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, OS_pcTraceIsrNames[ptrEvent->id]);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, (ptrEvent->type == OS_TRACE_ISR_ENTER) ? "\",\"ph\":\"B\",\"tid\":"
+                                                   OS_TRACE_ROW_ISRS : "\",\"ph\":\"E\",\"tid\":" OS_TRACE_ROW_ISRS);
+        break;
+    case OS_TRACE_CAN_TX:
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",{\"name\":\"TX 0x");
+        ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, ptrEvent->data, 16U, 3U);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, "\",\"ph\":\"i\",\"s\":\"t\",\"tid\":" OS_TRACE_ROW_CAN);
+        break;
+    case OS_TRACE_CAN_RX:
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",{\"name\":\"RX 0x");
+        ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, ptrEvent->data, 16U, 3U);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, " obj ");
+        ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, ptrEvent->id, 10U, 1U);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, "\",\"ph\":\"i\",\"s\":\"t\",\"tid\":" OS_TRACE_ROW_CAN);
+        break;
+    case OS_TRACE_STATE:
+        if (ptrEvent->id >= OS_TRACE_STATE_COUNT) {
+            return true;
+        }
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",{\"name\":\"");
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, OS_pcTraceStateNames[ptrEvent->id]);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, "\",\"ph\":\"C\",\"args\":{\"value\":");
+        ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, ptrEvent->data, 10U, 1U);
+        ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, "}");
+        break;
+    default:
+        return true;
+    }
+
+    // Microseconds with three decimals; 32 bits of microseconds cover 71 minutes of buffer history
+    ui64Nanos = (OS_ui64TraceElapsed * 1000U) / (OS_TIMEBASE_CLOCK_HZ() / OS_TIMEBASE_US_PER_S);
+    ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ",\"pid\":1,\"ts\":");
+    ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, (uint32_t)(ui64Nanos / 1000U), 10U, 1U);
+    ui8Pos = OS_ui8TraceAppend(pcLine, ui8Pos, ".");
+    ui8Pos = OS_ui8TraceAppendNumber(pcLine, ui8Pos, (uint32_t)(ui64Nanos % 1000U), 10U, 3U);
+    (void)OS_ui8TraceAppend(pcLine, ui8Pos, "}\r\n");
+    OS_ptrTracePut(pcLine);
+    return true;
+}
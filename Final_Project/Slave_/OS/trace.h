@@ -0,0 +1,98 @@
+/*
+ * trace.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the trace recorder: task start/end, interrupt entry/exit, CAN transmission/reception and
+ *                  state changes stored as 8-byte events in a RAM ring buffer, timestamped with the dispatcher cycle
+ *                  counter. The oldest events are overwritten, so the buffer always holds the most recent history.
+ *               2) Keep recording cheap enough to leave enabled: one call, interrupts masked for a few instructions,
+ *                  two stores. OS_voidTraceStart measures the cost per event, which the export reports against
+ *                  OS_TRACE_COST_BUDGET.
+ *               3) Export the buffer as Chrome trace-event JSON, one event per call so that a task can spread the
+ *                  output over several releases. Saved from the terminal, the output opens in chrome://tracing or
+ *                  ui.perfetto.dev as a timeline without a conversion step.
+ *               4) Keep the interrupt masking in the port macros.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "OS/dispatcher.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_TRACE_EVENTS             128U    // Ring buffer length in events (8 bytes each); power of two
+#define OS_TRACE_MASK               (OS_TRACE_EVENTS - 1U)
+#define OS_TRACE_COST_BUDGET        50U     // Cycles per recorded event the recorder must stay under
+#define OS_TRACE_LINE_LEN           128U    // Longest exported JSON line, including the terminator
+#define OS_TRACE_HEADER_LEN         384U    // Characters written by OS_voidTraceExportBegin, at most
+
+// Event types
+#define OS_TRACE_TASK_START         1U      // id = task slot
+#define OS_TRACE_TASK_END           2U      // id = task slot
+#define OS_TRACE_ISR_ENTER          3U      // id = OS_TRACE_ISR_xxx
+#define OS_TRACE_ISR_EXIT           4U      // id = OS_TRACE_ISR_xxx
+#define OS_TRACE_CAN_TX             5U      // id = message object, data = CAN identifier
+#define OS_TRACE_CAN_RX             6U      // id = message object, data = CAN identifier
+#define OS_TRACE_STATE              7U      // id = OS_TRACE_STATE_xxx, data = new value
+
+// Interrupt sources (id of OS_TRACE_ISR_ENTER / OS_TRACE_ISR_EXIT)
+#define OS_TRACE_ISR_SYSTICK        0U
+#define OS_TRACE_ISR_CAN            1U
+#define OS_TRACE_ISR_UART           2U
+#define OS_TRACE_ISR_BUTTONS        3U
+#define OS_TRACE_ISR_TIMER0         4U
+#define OS_TRACE_ISR_PENDSV         5U
+#define OS_TRACE_ISR_COUNT          6U
+
+// State variables (id of OS_TRACE_STATE)
+#define OS_TRACE_STATE_UART         0U      // UartState, the state reported to the PC
+#define OS_TRACE_STATE_CAN_BUS      1U      // 1 while the CAN controller is bus-off
+#define OS_TRACE_STATE_COUNT        2U
+
+/**
+ * Port layer:
+ *      OS_TRACE_LOCK()             // Mask interrupts, return the previous mask state
+ *      OS_TRACE_UNLOCK(state)      // Restore the mask state returned by OS_TRACE_LOCK()
+ *
+ * The intrinsics compile to a single CPSID / MSR each, where IntMasterDisable() is two nested calls; the recorder
+ * may be called with interrupts already masked (from inside another critical section), so the state is restored
+ * rather than unconditionally enabled.
+ */
+#define OS_TRACE_LOCK()             _disable_IRQ()         // CPSID I, returns the previous PRIMASK (TI ARM intrinsic)
+#define OS_TRACE_UNLOCK(state)      _restore_interrupts(state)
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t cycles;             // OS_CYCLE_COUNT() when the event was recorded (wraps every 2^32 cycles)
+    uint8_t type;                // OS_TRACE_xxx event type
+    uint8_t id;                  // Task slot, interrupt source, message object or state variable
+    uint16_t data;               // CAN identifier or state value
+} TraceEvent;
+
+OS_STATIC_ASSERT(sizeof(TraceEvent) == 8U, OS_TraceEventIs8Bytes);
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidTraceStart(void);
+void OS_voidTraceStop(void);
+void OS_voidTraceRecord(uint8_t a_ui8Type, uint8_t a_ui8Id, uint16_t a_ui16Data);
+uint32_t OS_ui32TraceCostCycles(void);
+void OS_voidTraceExportBegin(void (*a_ptrPutString)(const char *));
+bool OS_boolTraceExportStep(void);
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,157 @@
+/*
+ * wdgm.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The purpose of this file is to implement the watchdog manager. Every OS_WDGM_WINDOW_TICKS the SysTick
+ *      interrupt closes a supervision window: if every supervised task completed at least its aliveMin runs, the
+ *      hardware watchdog is serviced. Otherwise servicing stops for good, a deferred job writes the failing task to
+ *      EEPROM and the watchdog resets the device. Because the check runs in the interrupt, a task that never returns (a
+ *      busy-wait loop, a lost hardware flag) is detected as well as one that is starved by higher priorities. A hang
+ *      with interrupts masked stops the servicing directly.
+ *
+ *      The watchdog reload is 1.5 windows, so a serviced watchdog never times out. Once servicing stops, the first
+ *      time-out raises the (unused) interrupt flag and the second one resets: the reset follows the detection
+ *      within 3 windows. The EEPROM write runs in PendSV rather than in a task, because a hung task would keep
+ *      every other task from running; a hang in an interrupt handler or with interrupts masked loses the record.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "OS/wdgm.h"
+#include "OS/OS_config.h"
+#include "OS/timebase.h"
+#include "OS/periodic.h"
+#include "OS/deferred.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/watchdog.h"
+#include "driverlib/eeprom.h"
+#include "MCAL/NVM/NVM.h"
+#include "MCAL/Timers/SYSTICK_TIMER/systickTimer.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static const TaskControlBlock *OS_ptrWdgMTaskList = 0;
+static uint32_t OS_ui32WdgMWindowEnd = 0;           // Tick at which the current supervision window closes
+static uint32_t OS_ui32WdgMReload = 0;              // Watchdog reload in system clock cycles
+static bool OS_boolWdgMFailed = false;              // Supervision failed, the watchdog is no longer serviced
+static bool OS_boolWdgMRecordPosted = false;        // The failure record job was queued
+static WdgMRecord OS_stWdgMRecord;                  // Failure of this run, written by OS_voidWdgMRecordJob
+static WdgMRecord OS_stWdgMLastRecord = {OS_WDGM_NO_RECORD, OS_WDGM_NO_RECORD, OS_WDGM_NO_TIME};   // Read back at start-up
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidWdgMRecordJob
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Deferred job that writes the failure record to EEPROM. It is the one job allowed to program the
+ *              EEPROM: it runs once, on the way to the reset, when the latency of the other jobs no longer matters.
+ ***********************************************/
+static void OS_voidWdgMRecordJob(void)
+{
+    EEPROMProgram((uint32_t *)&OS_stWdgMRecord, EEPROM_WDGM_RECORD_ADDR, sizeof(OS_stWdgMRecord));
+}
+
+/***********************************************
+ * Function Name: OS_voidWdgMInit
+ * Inputs: const TaskControlBlock *a_ptrTaskList - Run-time task list attached to the dispatcher
+ *         uint32_t a_ui32Now - Current system tick, start of the first supervision window
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Keeps the failure record left by the previous reset (see OS_boolWdgMLastReset) and erases it in
+ *              EEPROM, then starts WATCHDOG0 with reset enabled. The watchdog stalls while the debugger halts the
+ *              CPU. Call after initializeEEPROM and OS_voidDispatcherInit; it cannot be stopped again.
+ ***********************************************/
+void OS_voidWdgMInit(const TaskControlBlock *a_ptrTaskList, uint32_t a_ui32Now)
+{
+    static const WdgMRecord stErased = {OS_WDGM_NO_RECORD, OS_WDGM_NO_RECORD, OS_WDGM_NO_TIME};
+
+    EEPROMRead((uint32_t *)&OS_stWdgMLastRecord, EEPROM_WDGM_RECORD_ADDR, sizeof(OS_stWdgMLastRecord));
+    if (OS_stWdgMLastRecord.priority != OS_WDGM_NO_RECORD) {
+        EEPROMProgram((uint32_t *)&stErased, EEPROM_WDGM_RECORD_ADDR, sizeof(stErased));
+    }
+
+    OS_ptrWdgMTaskList = a_ptrTaskList;
+    OS_voidPeriodicStart(&OS_ui32WdgMWindowEnd, OS_WDGM_WINDOW_TICKS, a_ui32Now);
+    OS_boolWdgMFailed = false;
+    OS_boolWdgMRecordPosted = false;
+    OS_ui32WdgMReload = SYSTICK_ui32TickCycles() * ((OS_WDGM_WINDOW_TICKS * 3U) / 2U);
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WDOG0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_WDOG0)) {}
+
+    if (WatchdogLockState(WATCHDOG0_BASE)) {
+        WatchdogUnlock(WATCHDOG0_BASE);
+    }
+    WatchdogReloadSet(WATCHDOG0_BASE, OS_ui32WdgMReload);
+    WatchdogStallEnable(WATCHDOG0_BASE);
+    WatchdogResetEnable(WATCHDOG0_BASE);
+    WatchdogEnable(WATCHDOG0_BASE);
+}
+
+/***********************************************
+ * Function Name: OS_voidWdgMTick
+ * Inputs: uint32_t a_ui32Now - Current system tick
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Called from the SysTick interrupt. At the end of every supervision window checks the alive
+ *              indications of the tasks and services the watchdog (clears the time-out flag and reloads the
+ *              counter) if all of them are present. On the first failure fills the record and posts
+ *              OS_voidWdgMRecordJob to write it; a post refused by a full queue is retried on the next ticks.
+ ***********************************************/
+void OS_voidWdgMTick(uint32_t a_ui32Now)
+{
+    uint8_t ui8Failed = OS_NO_TASK;
+
+    if (OS_boolWdgMFailed) {
+        if (!OS_boolWdgMRecordPosted) {
+            OS_boolWdgMRecordPosted = OS_boolDeferredPost(OS_voidWdgMRecordJob);
+        }
+        return;
+    }
+
+    // Windows stay on their raster; a tick jump over several window ends closes one longer window
+    if (OS_ui32PeriodicSkip(&OS_ui32WdgMWindowEnd, OS_WDGM_WINDOW_TICKS, a_ui32Now) == 0U) {
+        return;
+    }
+
+    ui8Failed = OS_ui8CheckAlive();
+    if (ui8Failed == OS_NO_TASK) {
+        WatchdogIntClear(WATCHDOG0_BASE);
+        WatchdogReloadSet(WATCHDOG0_BASE, OS_ui32WdgMReload);
+        return;
+    }
+
+    OS_boolWdgMFailed = true;
+    OS_stWdgMRecord.priority = (uint32_t)ui8Failed + 1U;
+    OS_stWdgMRecord.stuckTicks = a_ui32Now - OS_ptrWdgMTaskList[ui8Failed].lastRunTick;
+    OS_stWdgMRecord.detectedUs = OS_ui64TimeUs();
+    OS_boolWdgMRecordPosted = OS_boolDeferredPost(OS_voidWdgMRecordJob);
+}
+
+/***********************************************
+ * Function Name: OS_boolWdgMLastReset
+ * Inputs: WdgMRecord *a_ptrRecord - Receives the record of the previous supervision failure
+ * Outputs: bool - true if the previous reset was caused by a supervision failure
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Valid after OS_voidWdgMInit, which has already erased the record in EEPROM.
+ ***********************************************/
+bool OS_boolWdgMLastReset(WdgMRecord *a_ptrRecord)
+{
+    *a_ptrRecord = OS_stWdgMLastRecord;
+    return (OS_stWdgMLastRecord.priority != OS_WDGM_NO_RECORD);
+}
@@ -0,0 +1,50 @@
+/*
+ * wdgm.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Declare the watchdog manager: alive supervision of the dispatched tasks, checked once per
+ *                  supervision window from the SysTick interrupt, and the only code that services the hardware
+ *                  watchdog (WATCHDOG0).
+ *               2) Record which task failed its supervision, and for how long it had not completed a run, in EEPROM
+ *                  before the watchdog resets the device, and hand that record to the application after the reset.
+ */
+
+#ifndef WDGM_H_
+#define WDGM_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "OS/dispatcher.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define OS_WDGM_NO_RECORD           0xFFFFFFFFUL    // Erased EEPROM word: no supervision failure recorded
+#define OS_WDGM_NO_TIME             0xFFFFFFFFFFFFFFFFULL   // Erased EEPROM double word
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+// Supervision failure, stored in EEPROM as four words
+typedef struct {
+    uint32_t priority;           // Priority (slot + 1) of the task that failed, OS_WDGM_NO_RECORD if none
+    uint32_t stuckTicks;         // Ticks from the start of its last run to the detection
+    uint64_t detectedUs;         // Time base (OS_ui64TimeUs) at the detection, i.e. uptime before the reset
+} WdgMRecord;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void OS_voidWdgMInit(const TaskControlBlock *a_ptrTaskList, uint32_t a_ui32Now);
+void OS_voidWdgMTick(uint32_t a_ui32Now);
+bool OS_boolWdgMLastReset(WdgMRecord *a_ptrRecord);
+
+#endif /* WDGM_H_ */
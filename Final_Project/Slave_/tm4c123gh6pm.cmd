@@ -36,8 +36,8 @@ SECTIONS
     .init_array : > FLASH
 
     .vtable :   > 0x20000000
-    .data   :   > SRAM
-    .bss    :   > SRAM
+    .data   :   > SRAM, RUN_SIZE(__DATA_SIZE)
+    .bss    :   > SRAM, RUN_SIZE(__BSS_SIZE)
     .sysmem :   > SRAM
     .stack  :   > SRAM
 }
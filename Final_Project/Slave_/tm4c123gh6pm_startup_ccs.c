@@ -23,6 +23,7 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include "OS/stackmon.h"
 
 //*****************************************************************************
 //
@@ -49,6 +50,13 @@ extern void _c_int00(void);
 //*****************************************************************************
 extern uint32_t __STACK_TOP;
 
+//*****************************************************************************
+//
+// Linker variable that marks the bottom of the stack.
+//
+//*****************************************************************************
+extern uint32_t __stack;
+
 //*****************************************************************************
 //
 // External declarations for the interrupt handlers used by the application.
@@ -237,6 +245,19 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    uint32_t *pui32Word;
+
+    //
+    // Paint the stack with a known pattern so the stack monitor can find the
+    // deepest word used later on.  The top words, used by this function, are
+    // left alone.
+    //
+    for(pui32Word = &__stack;
+        pui32Word < (&__STACK_TOP - OS_STACK_PAINT_MARGIN); pui32Word++)
+    {
+        *pui32Word = OS_STACK_PAINT_PATTERN;
+    }
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
@@ -0,0 +1,59 @@
+/*
+ * bench.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Timing shared by the host benchmarks. They measure host nanoseconds, not target cycles: the numbers
+ *               compare two implementations built and run the same way, and how one scales with its input size.
+ *               The cycle costs on the TM4C123 are measured by the firmware itself (task statistics, trace cost).
+ *
+ *      Usage rules:
+ *               - BENCH_TIME(ns, iterations, body) runs body iterations times and stores the mean in ns.
+ *               - Results the compiler could drop go to BENCH_ui32Sink.
+ *               - A benchmark exits non-zero only when a result is wrong, never because it was slow.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_TIME(ns, iterations, body) \
+    do { \
+        uint64_t ui64Start_ = BENCH_ui64Now(); \
+        uint32_t ui32Iter_ = 0; \
+        for (ui32Iter_ = 0; ui32Iter_ < (iterations); ui32Iter_++) { \
+            body; \
+        } \
+        (ns) = (double)(BENCH_ui64Now() - ui64Start_) / (double)(iterations); \
+    } while (0)
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static volatile uint32_t BENCH_ui32Sink = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+static inline uint64_t BENCH_ui64Now(void)
+{
+    struct timespec stNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return ((uint64_t)stNow.tv_sec * 1000000000ULL) + (uint64_t)stNow.tv_nsec;
+}
+
+#endif /* BENCH_H_ */
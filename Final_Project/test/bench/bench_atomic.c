@@ -0,0 +1,141 @@
+/*
+ * bench_atomic.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Micro-benchmark of each primitive of OS/atomic.h and OS/spsc.c, uncontended, against a plain
+ *               read-modify-write and against the same update inside an interrupt-masking critical section (the
+ *               fake's IntMasterDisable/IntMasterEnable). On the host LDREX/STREX are emulated with a compare-and-swap
+ *               (stubs/host_port.h); the figures rank the primitives, the target costs are a few cycles each.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "bench.h"
+#include "OS/atomic.h"
+#include "OS/spsc.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_ITERATIONS        5000000U
+#define BENCH_RING_LEN          16U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint64_t timestamp;
+    uint32_t id;
+    uint8_t length;
+    uint8_t data[8];
+} BENCH_Frame;                  // Same size as CAN_Frame_t
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static volatile uint32_t BENCH_ui32Word = 0;
+static Seqlock BENCH_stLock = OS_SEQLOCK_INITIALIZER;
+static BENCH_Frame BENCH_stShared;
+static BENCH_Frame BENCH_stRingBuffer[BENCH_RING_LEN];
+static SpscRing BENCH_stRing;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void BENCH_voidPrint(const char *a_ptrName, double a_dNs)
+{
+    printf("    %-36s %8.2f ns\n", a_ptrName, a_dNs);
+}
+
+static void BENCH_voidCritical(void)
+{
+    bool boolMasked = IntMasterDisable();
+
+    BENCH_ui32Word = BENCH_ui32Word + 1U;
+    if (!boolMasked) {
+        IntMasterEnable();
+    }
+}
+
+static void BENCH_voidSeqlockWrite(uint32_t a_ui32Value)
+{
+    OS_voidSeqlockWriteBegin(&BENCH_stLock);
+    BENCH_stShared.timestamp = a_ui32Value;
+    BENCH_stShared.id = a_ui32Value;
+    OS_voidSeqlockWriteEnd(&BENCH_stLock);
+}
+
+static uint32_t BENCH_ui32SeqlockRead(void)
+{
+    BENCH_Frame stCopy;
+    uint32_t ui32Sequence = 0;
+
+    do {
+        ui32Sequence = OS_ui32SeqlockReadBegin(&BENCH_stLock);
+        stCopy = BENCH_stShared;
+    } while (OS_boolSeqlockReadRetry(&BENCH_stLock, ui32Sequence));
+    return stCopy.id;
+}
+
+static void BENCH_voidRingPair(void)
+{
+    BENCH_Frame stFrame = BENCH_stShared;
+
+    (void)OS_boolSpscPush(&BENCH_stRing, &stFrame);
+    (void)OS_boolSpscPop(&BENCH_stRing, &stFrame);
+    BENCH_ui32Sink += stFrame.id;
+}
+
+int main(void)
+{
+    double dNs = 0;
+    uint32_t ui32Expected = 0;
+
+    BENCH_TIME(dNs, BENCH_ITERATIONS, BENCH_ui32Word = BENCH_ui32Word + 1U);
+    BENCH_voidPrint("plain increment (not atomic)", dNs);
+    BENCH_TIME(dNs, BENCH_ITERATIONS / 10U, BENCH_voidCritical());
+    BENCH_voidPrint("increment, interrupts masked", dNs);
+
+    BENCH_ui32Word = 0;
+    BENCH_TIME(dNs, BENCH_ITERATIONS, (void)OS_ui32AtomicFetchAdd(&BENCH_ui32Word, 1U));
+    BENCH_voidPrint("OS_ui32AtomicFetchAdd", dNs);
+    UNIT_CHECK_EQ(BENCH_ui32Word, BENCH_ITERATIONS);
+    BENCH_TIME(dNs, BENCH_ITERATIONS, (void)OS_ui32AtomicFetchOr(&BENCH_ui32Word, 0x80000000UL));
+    BENCH_voidPrint("OS_ui32AtomicFetchOr", dNs);
+    BENCH_TIME(dNs, BENCH_ITERATIONS, (void)OS_ui32AtomicFetchAnd(&BENCH_ui32Word, 0x7FFFFFFFUL));
+    BENCH_voidPrint("OS_ui32AtomicFetchAnd", dNs);
+    UNIT_CHECK_EQ(BENCH_ui32Word, BENCH_ITERATIONS);
+    BENCH_TIME(dNs, BENCH_ITERATIONS, BENCH_ui32Sink += OS_ui32AtomicExchange(&BENCH_ui32Word, ui32Iter_));
+    BENCH_voidPrint("OS_ui32AtomicExchange", dNs);
+
+    ui32Expected = BENCH_ui32Word;
+    BENCH_TIME(dNs, BENCH_ITERATIONS, {
+        (void)OS_boolAtomicCompareExchange(&BENCH_ui32Word, ui32Expected, ui32Expected + 1U);
+        ui32Expected++;
+    });
+    BENCH_voidPrint("OS_boolAtomicCompareExchange", dNs);
+    UNIT_CHECK_EQ(BENCH_ui32Word, ui32Expected);
+
+    BENCH_TIME(dNs, BENCH_ITERATIONS, BENCH_voidSeqlockWrite(ui32Iter_));
+    BENCH_voidPrint("seqlock write (12 bytes)", dNs);
+    UNIT_CHECK_EQ(BENCH_stLock.sequence, 2U * BENCH_ITERATIONS);
+    BENCH_TIME(dNs, BENCH_ITERATIONS, BENCH_ui32Sink += BENCH_ui32SeqlockRead());
+    BENCH_voidPrint("seqlock read (24-byte copy)", dNs);
+
+    OS_voidSpscInit(&BENCH_stRing, BENCH_stRingBuffer, sizeof(BENCH_Frame), BENCH_RING_LEN);
+    BENCH_TIME(dNs, BENCH_ITERATIONS, BENCH_voidRingPair());
+    BENCH_voidPrint("SPSC push + pop (24-byte frame)", dNs);
+    UNIT_CHECK_EQ(BENCH_stRing.dropped, 0U);
+    UNIT_CHECK_EQ(OS_ui32SpscCount(&BENCH_stRing), 0U);
+
+    return UNIT_intReport("bench_atomic");
+}
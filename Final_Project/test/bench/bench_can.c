@@ -0,0 +1,269 @@
+/*
+ * bench_can.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: CAN throughput of MCAL/CAN/can.c on the fake MCU at 500 kbit/s, in simulated time (frame length
+ *               47 + 8 x DLC bits, no stuff bits, every frame acknowledged):
+ *               1) transmit: sustained frames per second with CAN_Send keeping the TX queue full, against the bus
+ *                  limit, with the queue latency; then bursts of 8 frames every 2 ms (60 % load) sent through one
+ *                  fixed message object rewritten per frame, as CAN_SendMessage did, and through the TX queue;
+ *               2) receive: a 100 % load flood of 8-byte frames read by polling one message object every 200 ms,
+ *                  as the baseline firmware did, and by CAN_handler into the RX ring with the task reading it every
+ *                  1 ms and every 10 ms.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "bench.h"
+#include "fake.h"
+#include "CAN.h"
+#include "CAN_config.h"
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_BIT_CYCLES        (FAKE_CPU_HZ / 500000U)
+#define BENCH_STEP_CYCLES       50U                             // 1 us
+#define BENCH_MS_CYCLES         (FAKE_CPU_HZ / 1000U)
+#define BENCH_SECOND            ((uint64_t)FAKE_CPU_HZ)
+#define BENCH_FRAME_BITS(dlc)   (47U + (8U * (dlc)))
+#define BENCH_ID                0x120U
+#define BENCH_BASE_OBJECT       1U                              // The fixed object of the baseline
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint64_t busyUntil;         // End of the frame on the bus, 0 when idle
+    uint32_t sent;
+} BENCH_Bus;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static BENCH_Bus BENCH_stBus;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+void CAN_handler(void)
+{
+    uint32_t ui32Cause = CANIntStatus(CAN_BASE, CAN_INT_STS_CAUSE);
+
+    if ((ui32Cause >= 1U) && (ui32Cause <= 32U)) {
+        CANIntClear(CAN_BASE, ui32Cause);
+        (void)CAN_DrainReceiveObjects();
+        (void)CAN_ServiceTransmitObjects();
+    } else if (ui32Cause == CAN_INT_INTID_STATUS) {
+        (void)CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
+    }
+}
+
+// One microsecond of the bus: ends the frame in flight, starts the next one the controller offers
+static void BENCH_voidBusStep(void)
+{
+    FAKE_CanFrame stFrame;
+
+    if ((BENCH_stBus.busyUntil != 0U) && (FAKE_ui64Now >= BENCH_stBus.busyUntil)) {
+        FAKE_voidCanTxDone(true);
+        BENCH_stBus.busyUntil = 0;
+        BENCH_stBus.sent++;
+    }
+    if ((BENCH_stBus.busyUntil == 0U) && FAKE_boolCanStartTx(&stFrame)) {
+        BENCH_stBus.busyUntil = FAKE_ui64Now + ((uint64_t)BENCH_FRAME_BITS(stFrame.length) * BENCH_BIT_CYCLES);
+    }
+    FAKE_voidSpend(BENCH_STEP_CYCLES);
+}
+
+static void BENCH_voidReset(void)
+{
+    memset(&BENCH_stBus, 0, sizeof(BENCH_stBus));
+    OS_voidTimeBaseInit();
+    CAN_Init();
+    CAN_ConfigureReceiveObjects();
+    IntMasterEnable();
+}
+
+// The baseline's CAN_SendMessage: rewrite the object, whatever it still holds
+static void BASE_voidSend(const uint8_t *a_ptrData)
+{
+    tCANMsgObject stObject;
+
+    stObject.ui32MsgID = BENCH_ID;
+    stObject.ui32MsgIDMask = 0;
+    stObject.ui32Flags = 0;
+    stObject.ui32MsgLen = 8U;
+    stObject.pui8MsgData = (uint8_t *)a_ptrData;
+    CANMessageSet(CAN_BASE, BENCH_BASE_OBJECT, &stObject, MSG_OBJ_TYPE_TX);
+}
+
+static void BENCH_voidSustained(void)
+{
+    uint8_t aui8Data[8] = {0};
+    uint64_t ui64End = 0;
+    uint32_t ui32Limit = (uint32_t)(BENCH_SECOND / ((uint64_t)BENCH_FRAME_BITS(8U) * BENCH_BIT_CYCLES));
+    CAN_TxStats_t stStats;
+
+    BENCH_voidReset();
+    ui64End = FAKE_ui64Now + BENCH_SECOND;
+    while (FAKE_ui64Now < ui64End) {
+        while (CAN_Send(BENCH_ID, aui8Data, 8U)) {
+            aui8Data[0]++;
+        }
+        BENCH_voidBusStep();
+    }
+    CAN_GetTxStats(&stStats);
+
+    printf("    sustained: %u frames/s of 8 bytes, bus limit %u; queue latency mean %u us, max %u us\n",
+           (unsigned)BENCH_stBus.sent, (unsigned)ui32Limit, (unsigned)(stStats.meanLatencyCycles / 50U),
+           (unsigned)(stStats.maxLatencyCycles / 50U));
+    UNIT_CHECK(BENCH_stBus.sent >= ((ui32Limit * 99U) / 100U));
+    UNIT_CHECK(BENCH_stBus.sent <= ui32Limit);
+}
+
+// Bursts of 8 frames every 2 ms; a_boolQueue selects CAN_Send over the fixed object. Returns the frames sent.
+static uint32_t BENCH_ui32Bursts(bool a_boolQueue, uint32_t *a_ptrOffered)
+{
+    uint8_t aui8Data[8] = {0};
+    uint64_t ui64End = 0;
+    uint64_t ui64NextBurst = 0;
+    uint32_t i = 0;
+
+    BENCH_voidReset();
+    *a_ptrOffered = 0;
+    ui64NextBurst = FAKE_ui64Now;
+    ui64End = FAKE_ui64Now + BENCH_SECOND;
+    while (FAKE_ui64Now < ui64End) {
+        if (FAKE_ui64Now >= ui64NextBurst) {
+            for (i = 0; i < 8U; i++) {
+                aui8Data[0]++;
+                if (a_boolQueue) {
+                    (void)CAN_Send(BENCH_ID, aui8Data, 8U);
+                } else {
+                    BASE_voidSend(aui8Data);
+                }
+                (*a_ptrOffered)++;
+            }
+            ui64NextBurst += 2U * BENCH_MS_CYCLES;
+        }
+        BENCH_voidBusStep();
+    }
+
+    // Let the last burst out
+    for (i = 0; i < (2U * BENCH_MS_CYCLES / BENCH_STEP_CYCLES); i++) {
+        BENCH_voidBusStep();
+    }
+    return BENCH_stBus.sent;
+}
+
+static void BENCH_voidBurstTransmit(void)
+{
+    uint32_t ui32Offered = 0;
+    uint32_t ui32Base = BENCH_ui32Bursts(false, &ui32Offered);
+    uint32_t ui32Queue = 0;
+    CAN_TxStats_t stBefore;
+    CAN_TxStats_t stStats;
+
+    CAN_GetTxStats(&stBefore);
+    ui32Queue = BENCH_ui32Bursts(true, &ui32Offered);
+    CAN_GetTxStats(&stStats);
+    stStats.dropped -= stBefore.dropped;
+    printf("    bursts: %u frames offered; fixed object sent %u, TX queue sent %u (%u dropped)\n",
+           (unsigned)ui32Offered, (unsigned)ui32Base, (unsigned)ui32Queue, (unsigned)stStats.dropped);
+    UNIT_CHECK_EQ(ui32Queue, ui32Offered);
+    UNIT_CHECK_EQ(stStats.dropped, 0U);
+    UNIT_CHECK(ui32Base < (ui32Offered / 2U));
+}
+
+// 100 % load of 8-byte frames for one second; a_ui32ReadMs = 0 polls one object every 200 ms instead of the ring
+static uint32_t BENCH_ui32Flood(uint32_t a_ui32ReadMs, uint32_t *a_ptrOffered)
+{
+    FAKE_CanFrame stFrame;
+    CAN_Frame_t stReceived;
+    tCANMsgObject stObject;
+    uint8_t aui8Data[8];
+    uint64_t ui64End = 0;
+    uint64_t ui64NextFrame = 0;
+    uint64_t ui64NextRead = 0;
+    uint32_t ui32Read = 0;
+
+    BENCH_voidReset();
+    if (a_ui32ReadMs == 0U) {
+        // The baseline: one receive object, CAN_INTERRUPT_MODE disabled, read by the 200 ms task
+        IntDisable(CAN_INT);
+        CANInit(CAN_BASE);
+        CAN_ReceiveInit();
+        CANEnable(CAN_BASE);
+    }
+
+    memset(&stFrame, 0, sizeof(stFrame));
+    stFrame.id = BENCH_ID;
+    stFrame.length = 8U;
+    stObject.pui8MsgData = aui8Data;
+    *a_ptrOffered = 0;
+    ui64NextFrame = FAKE_ui64Now;
+    ui64NextRead = FAKE_ui64Now;
+    ui64End = FAKE_ui64Now + BENCH_SECOND;
+    while (FAKE_ui64Now < ui64End) {
+        if (FAKE_ui64Now >= ui64NextFrame) {
+            stFrame.data[0]++;
+            FAKE_voidCanReceive(&stFrame);
+            (*a_ptrOffered)++;
+            ui64NextFrame += (uint64_t)BENCH_FRAME_BITS(8U) * BENCH_BIT_CYCLES;
+        }
+        if (FAKE_ui64Now >= ui64NextRead) {
+            if (a_ui32ReadMs == 0U) {
+                CANMessageGet(CAN_BASE, CAN_RX_OBJECT_NUM, &stObject, true);
+                ui32Read += ((stObject.ui32Flags & MSG_OBJ_NEW_DATA) != 0U) ? 1U : 0U;
+                ui64NextRead += 200U * BENCH_MS_CYCLES;
+            } else {
+                while (CAN_Receive(&stReceived)) {
+                    ui32Read++;
+                }
+                ui64NextRead += (uint64_t)a_ui32ReadMs * BENCH_MS_CYCLES;
+            }
+        }
+        FAKE_voidSpend(BENCH_STEP_CYCLES);
+    }
+    while ((a_ui32ReadMs != 0U) && CAN_Receive(&stReceived)) {
+        ui32Read++;
+    }
+    return ui32Read;
+}
+
+static void BENCH_voidReceiveFlood(void)
+{
+    uint32_t ui32Offered = 0;
+    uint32_t ui32Polled = BENCH_ui32Flood(0U, &ui32Offered);
+    uint32_t ui32Fast = BENCH_ui32Flood(1U, &ui32Offered);
+    uint32_t ui32Slow = BENCH_ui32Flood(10U, &ui32Offered);
+    CAN_RxCounters_t stCounters;
+
+    CAN_GetRxCounters(&stCounters);
+    printf("    RX flood: %u frames in 1 s; lost %u polling every 200 ms, %u with the ring read every 1 ms,"
+           " %u read every 10 ms (%u dropped by the ring)\n", (unsigned)ui32Offered,
+           (unsigned)(ui32Offered - ui32Polled), (unsigned)(ui32Offered - ui32Fast),
+           (unsigned)(ui32Offered - ui32Slow), (unsigned)stCounters.dropped);
+    UNIT_CHECK_EQ(ui32Fast, ui32Offered);
+    UNIT_CHECK(ui32Polled <= 6U);
+    UNIT_CHECK_EQ(ui32Offered - ui32Slow, stCounters.dropped);
+}
+
+int main(void)
+{
+    UNIT_RUN(BENCH_voidSustained);
+    UNIT_RUN(BENCH_voidBurstTransmit);
+    UNIT_RUN(BENCH_voidReceiveFlood);
+    return UNIT_intReport("bench_can");
+}
@@ -0,0 +1,147 @@
+/*
+ * bench_dispatcher.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Dispatch latency of OS/dispatcher.c against the linear scan it replaced (APP_voidScheduler of the
+ *               baseline Master_/OS/scheduler.c, reproduced below), at 8, 32 and 64 tasks:
+ *               1) selection: only the lowest-priority task is ready, the scan has to look at every entry;
+ *               2) idle pass: nothing is ready, the scheduler loop polls;
+ *               3) the tick service of the dispatcher, which does the release checks once per tick instead of on
+ *                  every loop pass.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "bench.h"
+#include "OS/dispatcher.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_ITERATIONS        2000000U
+#define BENCH_PERIOD            1000U
+#define BENCH_NOW               500U        // No release due
+#define BASE_MAX_TASKS          OS_MAX_TASK_SLOTS
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+// Task entry of the baseline scheduler
+typedef struct {
+    void (*taskFunction)(void);
+    uint32_t periodTicks;
+    uint32_t lastRunTick;
+    uint8_t priority;
+    uint8_t isEnabled;
+    TaskState state;
+} BASE_TaskControlBlock;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static BASE_TaskControlBlock BASE_stTaskList[BASE_MAX_TASKS];
+static uint8_t BASE_ui8TaskCount = 0;
+static volatile uint32_t BASE_ui32SysTickCount = 0;
+
+static TaskConfig BENCH_stTable[OS_MAX_TASK_SLOTS];
+static TaskControlBlock BENCH_stTasks[OS_MAX_TASK_SLOTS];
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void BENCH_voidTask(void)
+{
+}
+
+// Selection loop of APP_voidScheduler: the slot it would run, BASE_MAX_TASKS if none
+static uint8_t BASE_ui8Select(void)
+{
+    uint32_t currentTick = BASE_ui32SysTickCount;
+    uint8_t highestPriorityIndex = BASE_MAX_TASKS;
+    uint8_t i = 0;
+
+    for (i = 0; i < BASE_ui8TaskCount; i++) {
+        if (BASE_stTaskList[i].isEnabled && BASE_stTaskList[i].state == TASK_READY) {
+            if ((currentTick - BASE_stTaskList[i].lastRunTick) >= BASE_stTaskList[i].periodTicks) {
+                if (highestPriorityIndex == BASE_MAX_TASKS ||
+                    BASE_stTaskList[i].priority < BASE_stTaskList[highestPriorityIndex].priority) {
+                    highestPriorityIndex = i;
+                }
+            }
+        }
+    }
+    return highestPriorityIndex;
+}
+
+// n tasks, sorted by priority as OS_voidSortTasksByPriority left them; with a_boolLastDue only the last is due
+static void BENCH_voidSetUp(uint8_t a_ui8Tasks, bool a_boolLastDue)
+{
+    uint8_t i = 0;
+
+    BASE_ui8TaskCount = a_ui8Tasks;
+    BASE_ui32SysTickCount = BENCH_NOW;
+    for (i = 0; i < a_ui8Tasks; i++) {
+        BASE_stTaskList[i].taskFunction = BENCH_voidTask;
+        BASE_stTaskList[i].periodTicks = BENCH_PERIOD;
+        BASE_stTaskList[i].lastRunTick = 0;
+        BASE_stTaskList[i].priority = (uint8_t)(i + 1U);
+        BASE_stTaskList[i].isEnabled = 1;
+        BASE_stTaskList[i].state = TASK_READY;
+
+        BENCH_stTable[i].taskFunction = BENCH_voidTask;
+        BENCH_stTable[i].periodTicks = BENCH_PERIOD;
+        BENCH_stTable[i].offsetTicks = 0;
+        BENCH_stTable[i].eventMask = 0;
+        BENCH_stTable[i].priority = (uint8_t)(i + 1U);
+        BENCH_stTable[i].aliveMin = 0;
+    }
+    if (a_boolLastDue) {
+        BASE_stTaskList[a_ui8Tasks - 1U].periodTicks = BENCH_NOW;
+    }
+
+    // First releases at BENCH_PERIOD: nothing is due at BENCH_NOW
+    OS_voidDispatcherInit(BENCH_stTable, BENCH_stTasks, a_ui8Tasks, 0U);
+    if (a_boolLastDue) {
+        OS_voidSetTaskReady((uint8_t)(a_ui8Tasks - 1U));
+    }
+}
+
+int main(void)
+{
+    static const uint8_t aui8Sizes[3] = {8U, 32U, 64U};
+    double dScan = 0;
+    double dBitmap = 0;
+    double dScanIdle = 0;
+    double dDispatchIdle = 0;
+    double dTick = 0;
+    uint32_t i = 0;
+
+    printf("  tasks   selection scan / bitmap (ns)   idle pass scan / dispatch (ns)   tick service (ns)\n");
+    for (i = 0; i < 3U; i++) {
+        BENCH_voidSetUp(aui8Sizes[i], true);
+        UNIT_CHECK_EQ(BASE_ui8Select(), aui8Sizes[i] - 1U);
+        UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), aui8Sizes[i] - 1U);
+        BENCH_TIME(dScan, BENCH_ITERATIONS, BENCH_ui32Sink += BASE_ui8Select());
+        BENCH_TIME(dBitmap, BENCH_ITERATIONS, BENCH_ui32Sink += OS_ui8HighestReadyTask());
+
+        BENCH_voidSetUp(aui8Sizes[i], false);
+        UNIT_CHECK_EQ(BASE_ui8Select(), BASE_MAX_TASKS);
+        BENCH_TIME(dScanIdle, BENCH_ITERATIONS, BENCH_ui32Sink += BASE_ui8Select());
+        BENCH_TIME(dDispatchIdle, BENCH_ITERATIONS, OS_voidDispatch());
+        BENCH_TIME(dTick, BENCH_ITERATIONS / 10U, OS_voidDispatcherTick(BENCH_NOW));
+        UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), OS_NO_TASK);
+
+        printf("  %5u   %12.2f / %-12.2f    %12.2f / %-12.2f     %10.2f\n", (unsigned)aui8Sizes[i], dScan, dBitmap,
+               dScanIdle, dDispatchIdle, dTick);
+    }
+    return UNIT_intReport("bench_dispatcher");
+}
@@ -0,0 +1,119 @@
+/*
+ * bench_swtimer.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Cost of OS/swtimer.c with 1000 running periodic timers against the free-running counters it replaced
+ *               (every counter incremented in SYSTICK_handler and compared in the tasks): the interrupt part per tick,
+ *               the task part per tick, and a restart, which walks the delta list.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "bench.h"
+#include "OS/swtimer.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_TIMERS            1000U
+#define BENCH_TICKS             200000U
+#define BENCH_FIRST_PERIOD      100U        // Timer i reloads every BENCH_FIRST_PERIOD + i ticks
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static SoftTimer BENCH_stTimer[BENCH_TIMERS];
+static uint32_t BENCH_ui32Expired = 0;
+static uint32_t BENCH_ui32Now = 0;
+
+static volatile uint32_t BASE_ui32Counter[BENCH_TIMERS];
+static uint32_t BASE_ui32Expired = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void BENCH_voidExpired(void)
+{
+    BENCH_ui32Expired++;
+}
+
+// SYSTICK_handler before the timer service: every counter counts every tick
+static void BASE_voidTick(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        BASE_ui32Counter[i]++;
+    }
+}
+
+// The tasks: each compares its counter with its timeout and clears it
+static void BASE_voidCheck(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        if (BASE_ui32Counter[i] >= (BENCH_FIRST_PERIOD + i)) {
+            BASE_ui32Counter[i] = 0;
+            BASE_ui32Expired++;
+        }
+    }
+}
+
+static void BENCH_voidTick(void)
+{
+    BENCH_ui32Now++;
+    OS_voidTimerTick(BENCH_ui32Now);
+}
+
+int main(void)
+{
+    double dBaseTick = 0;
+    double dBaseCheck = 0;
+    double dTick = 0;
+    double dService = 0;
+    double dRestart = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        OS_voidTimerCreate(&BENCH_stTimer[i], BENCH_voidExpired, BENCH_FIRST_PERIOD + i);
+        OS_voidTimerStart(&BENCH_stTimer[i], BENCH_FIRST_PERIOD + i);
+    }
+
+    // Interrupt part alone, then interrupt and task parts together, per tick
+    BENCH_TIME(dBaseTick, BENCH_TICKS, BASE_voidTick());
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        BASE_ui32Counter[i] = 0;
+    }
+    BENCH_TIME(dBaseCheck, BENCH_TICKS, { BASE_voidTick(); BASE_voidCheck(); });
+    dBaseCheck -= dBaseTick;
+
+    BENCH_TIME(dTick, BENCH_TICKS, BENCH_voidTick());
+    BENCH_ui32Now = 0;
+    OS_voidTimerTick(0U);
+    BENCH_TIME(dService, BENCH_TICKS, { BENCH_voidTick(); OS_voidTimerService(); });
+    dService -= dTick;
+
+    // Restart of the timer with the longest period: stop, then insert behind the others
+    BENCH_TIME(dRestart, BENCH_TICKS, OS_voidTimerStart(&BENCH_stTimer[BENCH_TIMERS - 1U],
+                                                       BENCH_FIRST_PERIOD + BENCH_TIMERS - 1U));
+
+    printf("    %u timers, per tick: counters %.1f ns in the interrupt + %.1f ns in the tasks;"
+           " timer service %.1f ns in the interrupt + %.1f ns in the tasks; restart %.1f ns\n",
+           (unsigned)BENCH_TIMERS, dBaseTick, dBaseCheck, dTick, dService, dRestart);
+    printf("    expiries over %u ticks: counters %u, timer service %u\n", (unsigned)BENCH_TICKS,
+           (unsigned)BASE_ui32Expired, (unsigned)BENCH_ui32Expired);
+
+    // Both see the same expiries: the delta list loses none and adds none
+    UNIT_CHECK(BENCH_ui32Expired > 0U);
+    UNIT_CHECK_EQ(BENCH_ui32Expired, BASE_ui32Expired);
+    return UNIT_intReport("bench_swtimer");
+}
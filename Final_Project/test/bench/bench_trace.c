@@ -0,0 +1,54 @@
+/*
+ * bench_trace.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Cost of OS_voidTraceRecord: host nanoseconds per event while recording and while stopped, and the
+ *               cost per event OS_voidTraceStart measures with the cycle counter, checked against
+ *               OS_TRACE_COST_BUDGET. On the fake MCU the masking and unmasking are driverlib calls of
+ *               FAKE_CALL_CYCLES each and the rest is free, so that figure is the fake's model of the two PRIMASK
+ *               writes; on the target the same calibration reports the real count in the trace export header.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "bench.h"
+#include "fake.h"
+#include "OS/trace.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define BENCH_ITERATIONS        2000000U
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+int main(void)
+{
+    double dOn = 0;
+    double dOff = 0;
+    uint32_t ui32Cost = 0;
+
+    OS_CYCLE_COUNTER_INIT();
+    IntMasterEnable();
+
+    OS_voidTraceStart();
+    ui32Cost = OS_ui32TraceCostCycles();
+    BENCH_TIME(dOn, BENCH_ITERATIONS, OS_voidTraceRecord(OS_TRACE_CAN_RX, 17U, (uint16_t)ui32Iter_));
+    OS_voidTraceStop();
+    BENCH_TIME(dOff, BENCH_ITERATIONS, OS_voidTraceRecord(OS_TRACE_CAN_RX, 17U, (uint16_t)ui32Iter_));
+
+    printf("    OS_voidTraceRecord: %.2f ns recording, %.2f ns stopped (host)\n", dOn, dOff);
+    printf("    calibrated cost: %u cycles per event on the fake MCU, budget %u\n", (unsigned)ui32Cost,
+           (unsigned)OS_TRACE_COST_BUDGET);
+    UNIT_CHECK(ui32Cost < OS_TRACE_COST_BUDGET);
+    UNIT_CHECK(dOff < dOn);
+    return UNIT_intReport("bench_trace");
+}
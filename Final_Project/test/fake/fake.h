@@ -0,0 +1,106 @@
+/*
+ * fake.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Host model of the TM4C123GH6PM the firmware runs on: the driverlib functions of test/stubs are
+ *                  implemented here against a cycle clock, an interrupt controller and the peripherals the ECUs use
+ *                  (SysTick, TIMER0/1, WTIMER0, CAN, UART, GPIO, ADC, EEPROM, SSI, watchdog).
+ *               2) Time only moves inside the fake: every driverlib call costs FAKE_CALL_CYCLES, WFI skips to the
+ *                  next event, and the firmware code between two calls takes no time. The peripheral events that fall
+ *                  due are fired in time order and the pending interrupts are taken at the end of each call, with
+ *                  the NVIC priority and PRIMASK rules, so handlers preempt the firmware at call boundaries.
+ *               3) The SCS registers the firmware touches by address (SysTick RELOAD/CURRENT, ICSR, DEMCR, DWT) live
+ *                  in pages mapped at their real addresses; the fake merges firmware writes to them at each call.
+ *               4) The world outside the MCU is the board: the test or the simulator implements the BOARD_ hooks
+ *                  and feeds the fake with FAKE_voidCanReceive, FAKE_voidUartReceive and FAKE_voidGpioInput.
+ */
+
+#ifndef FAKE_H_
+#define FAKE_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_CPU_HZ             50000000U       // SYSDIV_4 | USE_PLL | XTAL_16MHZ
+#define FAKE_NEVER              UINT64_MAX      // No event scheduled
+#define FAKE_CALL_CYCLES        12U             // Cost of one driverlib call
+#define FAKE_ISR_CYCLES         12U             // Exception entry, and again exit
+#define FAKE_NUM_INTERRUPTS     155U
+#define FAKE_THREAD_PRIORITY    0x100U          // Running priority with no handler active
+#define FAKE_EEPROM_BYTES       2048U
+#define FAKE_EEPROM_WORD_CYCLES 4000U           // Programming one EEPROM word, the CPU waits
+#define FAKE_CAN_OBJECTS        32U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct FAKE_Timer {
+    uint64_t at;                    // Cycle at which fire is called; FAKE_NEVER while idle
+    void (*fire)(void);
+    struct FAKE_Timer *next;        // Chain of the timers scheduled once
+    bool linked;
+} FAKE_Timer;
+
+typedef struct {
+    uint32_t id;                    // 11-bit identifier
+    uint8_t length;                 // Data length code
+    bool remote;                    // Remote frame: length is the requested one, no data
+    uint8_t data[8];
+} FAKE_CanFrame;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+extern uint64_t FAKE_ui64Now;       // CPU cycles since power-on
+extern uint32_t FAKE_ui32CanTec;    // Transmit error counter, 256 = bus-off
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+// Core: clock, interrupt controller
+void FAKE_voidSpend(uint32_t a_ui32Cycles);
+void FAKE_voidTimerSet(FAKE_Timer *a_ptrTimer, uint64_t a_ui64At);
+uint64_t FAKE_ui64NextEvent(void);
+void FAKE_voidPend(uint32_t a_ui32Int);
+void FAKE_voidSetLine(uint32_t a_ui32Int, bool a_boolLevel);
+bool FAKE_boolPending(uint32_t a_ui32Int);
+bool FAKE_boolMasked(void);
+void FAKE_voidSuspend(void);
+void FAKE_voidResume(void);
+
+// CAN controller, seen from the bus
+bool FAKE_boolCanPeekTx(FAKE_CanFrame *a_ptrFrame);
+bool FAKE_boolCanStartTx(FAKE_CanFrame *a_ptrFrame);
+void FAKE_voidCanTxDone(bool a_boolAcked);
+void FAKE_voidCanReceive(const FAKE_CanFrame *a_ptrFrame);
+void FAKE_voidCanBusOff(void);
+bool FAKE_boolCanOnBus(void);
+
+// UART, GPIO, EEPROM seen from outside
+void FAKE_voidUartReceive(uint32_t a_ui32Base, uint8_t a_ui8Char);
+void FAKE_voidGpioInput(uint32_t a_ui32Port, uint8_t a_ui8Pins, uint8_t a_ui8Level);
+uint8_t FAKE_ui8GpioOutput(uint32_t a_ui32Port);
+uint8_t *FAKE_pui8Eeprom(void);
+
+// Board: implemented by the test or the simulator
+void BOARD_voidPoll(void);
+uint64_t BOARD_ui64Sleep(uint64_t a_ui64Until);
+void BOARD_voidCanRequest(void);
+void BOARD_voidUartTransmit(uint32_t a_ui32Base, uint8_t a_ui8Char);
+void BOARD_voidGpioOutput(uint32_t a_ui32Port, uint8_t a_ui8Old, uint8_t a_ui8New);
+uint32_t BOARD_ui32AdcSample(uint32_t a_ui32Base, uint32_t a_ui32Channel);
+void BOARD_voidReset(const char *a_ptrCause);
+
+#endif /* FAKE_H_ */
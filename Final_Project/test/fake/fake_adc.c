@@ -0,0 +1,132 @@
+/*
+ * fake_adc.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: ADC0 and ADC1 of the fake MCU, sample sequencer 3 with a processor trigger: the board supplies the
+ *               12-bit sample of the configured channel at the trigger, and the sequence completes one conversion
+ *               time later.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "inc/hw_memmap.h"
+#include "driverlib/adc.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_ADC_COUNT          2U
+#define FAKE_ADC_CYCLES         50U     // 1 Msps
+#define FAKE_ADC_CHANNEL_MASK   0x0FU
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t base;
+    uint32_t channel;
+    uint32_t sample;
+    uint64_t doneAt;            // End of the conversion started last
+    bool triggered;
+    bool ris;
+} FAKE_Adc;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static FAKE_Adc FAKE_stAdc[FAKE_ADC_COUNT] = {
+    {ADC0_BASE, 0, 0, 0, false, false},
+    {ADC1_BASE, 0, 0, 0, false, false},
+};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static FAKE_Adc *FAKE_ptrAdc(uint32_t a_ui32Base)
+{
+    FAKE_Adc *ptrAdc = (a_ui32Base == ADC1_BASE) ? &FAKE_stAdc[1] : &FAKE_stAdc[0];
+
+    if (ptrAdc->triggered && (FAKE_ui64Now >= ptrAdc->doneAt)) {
+        ptrAdc->triggered = false;
+        ptrAdc->ris = true;
+    }
+    return ptrAdc;
+}
+
+/***********************************************
+ * driverlib/adc.h
+ ***********************************************/
+void ADCSequenceConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Trigger, uint32_t ui32Priority)
+{
+    (void)ui32Base;
+    (void)ui32SequenceNum;
+    (void)ui32Trigger;
+    (void)ui32Priority;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void ADCSequenceStepConfigure(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t ui32Step, uint32_t ui32Config)
+{
+    (void)ui32SequenceNum;
+    (void)ui32Step;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ptrAdc(ui32Base)->channel = ui32Config & FAKE_ADC_CHANNEL_MASK;
+}
+
+void ADCSequenceEnable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    (void)ui32Base;
+    (void)ui32SequenceNum;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void ADCSequenceDisable(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    (void)ui32Base;
+    (void)ui32SequenceNum;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void ADCProcessorTrigger(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    FAKE_Adc *ptrAdc = 0;
+
+    (void)ui32SequenceNum;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrAdc = FAKE_ptrAdc(ui32Base);
+    ptrAdc->sample = BOARD_ui32AdcSample(ptrAdc->base, ptrAdc->channel) & 0xFFFU;
+    ptrAdc->doneAt = FAKE_ui64Now + FAKE_ADC_CYCLES;
+    ptrAdc->triggered = true;
+}
+
+uint32_t ADCIntStatus(uint32_t ui32Base, uint32_t ui32SequenceNum, bool bMasked)
+{
+    (void)ui32SequenceNum;
+    (void)bMasked;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_ptrAdc(ui32Base)->ris ? 1U : 0U;
+}
+
+void ADCIntClear(uint32_t ui32Base, uint32_t ui32SequenceNum)
+{
+    (void)ui32SequenceNum;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ptrAdc(ui32Base)->ris = false;
+}
+
+int32_t ADCSequenceDataGet(uint32_t ui32Base, uint32_t ui32SequenceNum, uint32_t *pui32Buffer)
+{
+    (void)ui32SequenceNum;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    *pui32Buffer = FAKE_ptrAdc(ui32Base)->sample;
+    return 1;
+}
@@ -0,0 +1,566 @@
+/*
+ * fake_can.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Register-level model of the CAN0 controller of the fake MCU: 32 message objects with their
+ *                  identifier, mask, direction, FIFO chaining, NEWDAT, MSGLST, TXRQST and interrupt pending bits, and
+ *                  the status register with the error counters.
+ *               2) Receive: acceptance filtering from object 1 up, stopping at the first match. A receive object
+ *                  takes data and remote frames (the direction is not compared when the mask is used); in a FIFO the
+ *                  frame goes to the first object without new data, or overwrites the end-of-buffer object and sets
+ *                  MSGLST. A matching transmit object answers a remote frame when it has RMTEN, else ignores it.
+ *               3) Transmit: the pending object with the lowest number goes first. NEWDAT is cleared when the frame
+ *                  is copied to the shift register (FAKE_boolCanStartTx), TXRQST when it was acknowledged
+ *                  (FAKE_voidCanTxDone). An unacknowledged frame stays pending and costs error counts; bus-off sets
+ *                  INIT, and clearing INIT rejoins the bus after 128 x 11 recessive bits.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/can.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_CAN_ID_MASK        0x7FFU
+#define FAKE_CAN_NONE           0xFFU           // No object on the bus
+#define FAKE_CAN_DETACHED       0xFEU           // The object on the bus was rewritten while its frame was sent
+#define FAKE_CAN_EWARN_LIMIT    96U
+#define FAKE_CAN_EPASS_LIMIT    128U
+#define FAKE_CAN_BOFF_LIMIT     256U
+#define FAKE_CAN_RECOVERY_BITS  (128U * 11U)
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    bool msgval;
+    bool dir;                   // Transmit object
+    bool umask;                 // Use the mask; the direction is then not compared
+    bool rmten;                 // Answer remote frames
+    bool eob;                   // End of buffer: last object of a FIFO, or a single object
+    bool txie;
+    bool rxie;
+    bool newdat;
+    bool msglst;
+    bool txrqst;
+    bool intpnd;
+    bool remote;                // Frame held is a remote frame
+    uint32_t id;
+    uint32_t mask;
+    uint8_t dlc;
+    uint8_t data[8];
+} FAKE_CanObject;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+uint32_t FAKE_ui32CanTec = 0;
+
+static FAKE_CanObject FAKE_stCanObj[FAKE_CAN_OBJECTS];
+static bool FAKE_boolCanInit = true;
+static bool FAKE_boolCanIe = false;         // CAN_INT_MASTER
+static bool FAKE_boolCanEie = false;        // CAN_INT_ERROR
+static bool FAKE_boolCanSie = false;        // CAN_INT_STATUS
+static bool FAKE_boolCanStatusInt = false;
+static uint32_t FAKE_ui32CanStatus = 0;
+static uint32_t FAKE_ui32CanRec = 0;
+static uint8_t FAKE_ui8CanSending = FAKE_CAN_NONE;
+static uint32_t FAKE_ui32CanBitCycles = FAKE_CPU_HZ / 500000U;
+static void FAKE_voidCanRecovered(void);
+static FAKE_Timer FAKE_stCanRecovery = {FAKE_NEVER, FAKE_voidCanRecovered, 0, false};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+// Interrupt line: IE and a non-zero INTID
+static void FAKE_voidCanLine(void)
+{
+    bool boolCause = FAKE_boolCanStatusInt;
+    uint32_t i = 0;
+
+    for (i = 0; (i < FAKE_CAN_OBJECTS) && !boolCause; i++) {
+        boolCause = FAKE_stCanObj[i].intpnd;
+    }
+    FAKE_voidSetLine(INT_CAN0, FAKE_boolCanIe && boolCause);
+}
+
+// Error counters to status bits; a change of EWARN or BOFF is an error interrupt
+static void FAKE_voidCanErrorState(void)
+{
+    uint32_t ui32Old = FAKE_ui32CanStatus & (CAN_STATUS_BUS_OFF | CAN_STATUS_EWARN);
+    uint32_t ui32Tec = FAKE_ui32CanTec;
+
+    FAKE_ui32CanStatus &= ~(CAN_STATUS_BUS_OFF | CAN_STATUS_EWARN | CAN_STATUS_EPASS);
+    if (ui32Tec >= FAKE_CAN_BOFF_LIMIT) {
+        FAKE_ui32CanStatus |= CAN_STATUS_BUS_OFF | CAN_STATUS_EPASS | CAN_STATUS_EWARN;
+    } else {
+        if ((ui32Tec >= FAKE_CAN_EWARN_LIMIT) || (FAKE_ui32CanRec >= FAKE_CAN_EWARN_LIMIT)) {
+            FAKE_ui32CanStatus |= CAN_STATUS_EWARN;
+        }
+        if ((ui32Tec >= FAKE_CAN_EPASS_LIMIT) || (FAKE_ui32CanRec >= FAKE_CAN_EPASS_LIMIT)) {
+            FAKE_ui32CanStatus |= CAN_STATUS_EPASS;
+        }
+    }
+    if (((FAKE_ui32CanStatus & (CAN_STATUS_BUS_OFF | CAN_STATUS_EWARN)) != ui32Old) && FAKE_boolCanEie) {
+        FAKE_boolCanStatusInt = true;
+    }
+}
+
+// A TXOK, RXOK or LEC update is a status interrupt when enabled
+static void FAKE_voidCanStatusEvent(uint32_t a_ui32Set)
+{
+    FAKE_ui32CanStatus = (FAKE_ui32CanStatus & ~CAN_STATUS_LEC_MSK) | a_ui32Set;
+    if (FAKE_boolCanSie) {
+        FAKE_boolCanStatusInt = true;
+    }
+}
+
+// Bus-off recovery sequence done
+static void FAKE_voidCanRecovered(void)
+{
+    FAKE_ui32CanTec = 0;
+    FAKE_ui32CanRec = 0;
+    FAKE_voidCanErrorState();
+    FAKE_voidCanLine();
+    BOARD_voidCanRequest();
+}
+
+// Object on the bus stops being sent
+static void FAKE_voidCanDetach(uint32_t a_ui32Index)
+{
+    if (FAKE_ui8CanSending == a_ui32Index) {
+        FAKE_ui8CanSending = FAKE_CAN_DETACHED;
+    }
+}
+
+// Lowest-numbered object waiting to be sent, FAKE_CAN_NONE if none or if the controller cannot send
+static uint32_t FAKE_ui32CanNextTx(void)
+{
+    uint32_t i = 0;
+
+    if (FAKE_boolCanInit || (FAKE_ui8CanSending != FAKE_CAN_NONE)) {
+        return FAKE_CAN_NONE;
+    }
+    for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+        if (FAKE_stCanObj[i].msgval && FAKE_stCanObj[i].txrqst) {
+            return i;
+        }
+    }
+    return FAKE_CAN_NONE;
+}
+
+// Frame an object sends: a data frame from a transmit object, a remote frame from a receive object
+static void FAKE_voidCanFrameOf(uint32_t a_ui32Index, FAKE_CanFrame *a_ptrFrame)
+{
+    const FAKE_CanObject *ptrObj = &FAKE_stCanObj[a_ui32Index];
+
+    a_ptrFrame->id = ptrObj->id;
+    a_ptrFrame->length = ptrObj->dlc;
+    a_ptrFrame->remote = !ptrObj->dir;
+    memcpy(a_ptrFrame->data, ptrObj->data, sizeof(a_ptrFrame->data));
+}
+
+/***********************************************
+ * Function Name: FAKE_boolCanPeekTx
+ * Inputs: FAKE_CanFrame *a_ptrFrame - Receives the frame
+ * Outputs: bool - true if the controller has a frame for the bus
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Frame this controller would enter arbitration with.
+ ***********************************************/
+bool FAKE_boolCanPeekTx(FAKE_CanFrame *a_ptrFrame)
+{
+    uint32_t ui32Index = FAKE_ui32CanNextTx();
+
+    if (ui32Index == FAKE_CAN_NONE) {
+        return false;
+    }
+    FAKE_voidCanFrameOf(ui32Index, a_ptrFrame);
+    return true;
+}
+
+/***********************************************
+ * Function Name: FAKE_boolCanStartTx
+ * Inputs: FAKE_CanFrame *a_ptrFrame - Receives the frame
+ * Outputs: bool - true if a frame was started
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: The controller won arbitration: its next frame goes to the shift register and NEWDAT is cleared.
+ ***********************************************/
+bool FAKE_boolCanStartTx(FAKE_CanFrame *a_ptrFrame)
+{
+    uint32_t ui32Index = FAKE_ui32CanNextTx();
+
+    if (ui32Index == FAKE_CAN_NONE) {
+        return false;
+    }
+    FAKE_voidCanFrameOf(ui32Index, a_ptrFrame);
+    FAKE_stCanObj[ui32Index].newdat = false;
+    FAKE_ui8CanSending = (uint8_t)ui32Index;
+    return true;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidCanTxDone
+ * Inputs: bool a_boolAcked - Another node acknowledged the frame
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: End of the frame started last. Acknowledged: TXRQST clears, TXOK, the object interrupt. Not
+ *              acknowledged: ACK error, the object stays pending for a retransmission.
+ ***********************************************/
+void FAKE_voidCanTxDone(bool a_boolAcked)
+{
+    FAKE_CanObject *ptrObj = 0;
+
+    if (FAKE_ui8CanSending == FAKE_CAN_NONE) {
+        return;
+    }
+    if (FAKE_ui8CanSending != FAKE_CAN_DETACHED) {
+        ptrObj = &FAKE_stCanObj[FAKE_ui8CanSending];
+    }
+    FAKE_ui8CanSending = FAKE_CAN_NONE;
+
+    if (a_boolAcked) {
+        if (ptrObj != 0) {
+            ptrObj->txrqst = false;
+            ptrObj->intpnd = ptrObj->intpnd || ptrObj->txie;
+        }
+        if (FAKE_ui32CanTec > 0U) {
+            FAKE_ui32CanTec--;
+        }
+        FAKE_voidCanStatusEvent(CAN_STATUS_TXOK);
+    } else {
+        // An error-passive node does not count ACK errors
+        if (FAKE_ui32CanTec < FAKE_CAN_EPASS_LIMIT) {
+            FAKE_ui32CanTec += 8U;
+        }
+        FAKE_voidCanStatusEvent(CAN_STATUS_LEC_ACK);
+    }
+    FAKE_voidCanErrorState();
+    FAKE_voidCanLine();
+}
+
+/***********************************************
+ * Function Name: FAKE_voidCanReceive
+ * Inputs: const FAKE_CanFrame *a_ptrFrame - Frame another node completed on the bus
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Acceptance filtering and storage, see the header of the file.
+ ***********************************************/
+void FAKE_voidCanReceive(const FAKE_CanFrame *a_ptrFrame)
+{
+    FAKE_CanObject *ptrObj = 0;
+    uint32_t ui32Mask = 0;
+    uint32_t i = 0;
+
+    if (FAKE_boolCanInit) {
+        return;
+    }
+    if (FAKE_ui32CanRec > 0U) {
+        FAKE_ui32CanRec--;
+    }
+    FAKE_voidCanStatusEvent(CAN_STATUS_RXOK);
+
+    for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+        ptrObj = &FAKE_stCanObj[i];
+        ui32Mask = ptrObj->umask ? ptrObj->mask : FAKE_CAN_ID_MASK;
+        if (!ptrObj->msgval || (((a_ptrFrame->id ^ ptrObj->id) & ui32Mask) != 0U) ||
+            (!ptrObj->umask && (ptrObj->dir != a_ptrFrame->remote))) {
+            continue;
+        }
+
+        if (ptrObj->dir) {
+            if (a_ptrFrame->remote && ptrObj->rmten && !ptrObj->txrqst) {
+                ptrObj->txrqst = true;
+                BOARD_voidCanRequest();
+            }
+            break;
+        }
+
+        // FIFO: first object without new data, else the end of the buffer is overwritten
+        while (ptrObj->newdat && !ptrObj->eob && ((i + 1U) < FAKE_CAN_OBJECTS)) {
+            i++;
+            ptrObj = &FAKE_stCanObj[i];
+        }
+        ptrObj->msglst = ptrObj->newdat;
+        ptrObj->newdat = true;
+        ptrObj->txrqst = false;         // Answer to the remote frame of this object
+        ptrObj->remote = a_ptrFrame->remote;
+        ptrObj->id = a_ptrFrame->id;
+        ptrObj->dlc = a_ptrFrame->length;
+        if (!a_ptrFrame->remote) {
+            memcpy(ptrObj->data, a_ptrFrame->data, sizeof(ptrObj->data));
+        }
+        ptrObj->intpnd = ptrObj->intpnd || ptrObj->rxie;
+        break;
+    }
+    FAKE_voidCanLine();
+}
+
+/***********************************************
+ * Function Name: FAKE_voidCanBusOff
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Drives the transmit error counter past 255, as a run of bit errors would: bus-off, INIT set.
+ ***********************************************/
+void FAKE_voidCanBusOff(void)
+{
+    FAKE_ui32CanTec = FAKE_CAN_BOFF_LIMIT;
+    FAKE_ui8CanSending = FAKE_CAN_NONE;
+    FAKE_boolCanInit = true;
+    FAKE_voidCanStatusEvent(CAN_STATUS_LEC_BIT0);
+    FAKE_voidCanErrorState();
+    FAKE_voidCanLine();
+}
+
+/***********************************************
+ * Function Name: FAKE_boolCanOnBus
+ * Inputs: N/A
+ * Outputs: bool - true if the controller takes part in bus traffic (INIT clear)
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: A node out of the bus neither acknowledges nor receives.
+ ***********************************************/
+bool FAKE_boolCanOnBus(void)
+{
+    return !FAKE_boolCanInit;
+}
+
+/***********************************************
+ * driverlib/can.h
+ ***********************************************/
+void CANInit(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES * FAKE_CAN_OBJECTS);
+    memset(FAKE_stCanObj, 0, sizeof(FAKE_stCanObj));
+    FAKE_boolCanInit = true;
+    FAKE_ui8CanSending = FAKE_CAN_NONE;
+    FAKE_voidCanLine();
+}
+
+uint32_t CANBitRateSet(uint32_t ui32Base, uint32_t ui32SourceClock, uint32_t ui32BitRate)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ui32CanBitCycles = ui32SourceClock / ui32BitRate;
+    return ui32BitRate;
+}
+
+// Clearing INIT while bus-off starts the recovery sequence
+void CANEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (!FAKE_boolCanInit) {
+        return;
+    }
+    FAKE_boolCanInit = false;
+    if (FAKE_ui32CanStatus & CAN_STATUS_BUS_OFF) {
+        FAKE_voidTimerSet(&FAKE_stCanRecovery, FAKE_ui64Now + (FAKE_CAN_RECOVERY_BITS * FAKE_ui32CanBitCycles));
+    } else {
+        BOARD_voidCanRequest();
+    }
+}
+
+void CANDisable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_boolCanInit = true;
+}
+
+void CANIntRegister(uint32_t ui32Base, void (*pfnHandler)(void))
+{
+    (void)ui32Base;
+    IntRegister(INT_CAN0, pfnHandler);
+    IntEnable(INT_CAN0);
+}
+
+void CANIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_boolCanIe = FAKE_boolCanIe || ((ui32IntFlags & CAN_INT_MASTER) != 0U);
+    FAKE_boolCanEie = FAKE_boolCanEie || ((ui32IntFlags & CAN_INT_ERROR) != 0U);
+    FAKE_boolCanSie = FAKE_boolCanSie || ((ui32IntFlags & CAN_INT_STATUS) != 0U);
+    FAKE_voidCanLine();
+}
+
+// The status interrupt is cleared by reading the status register, an object interrupt by clearing INTPND
+void CANIntClear(uint32_t ui32Base, uint32_t ui32IntClr)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ui32IntClr == CAN_INT_INTID_STATUS) {
+        FAKE_boolCanStatusInt = false;
+    } else if ((ui32IntClr >= 1U) && (ui32IntClr <= FAKE_CAN_OBJECTS)) {
+        FAKE_stCanObj[ui32IntClr - 1U].intpnd = false;
+    }
+    FAKE_voidCanLine();
+}
+
+uint32_t CANIntStatus(uint32_t ui32Base, tCANIntStsReg eIntStsReg)
+{
+    uint32_t ui32Status = 0;
+    uint32_t i = 0;
+
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (eIntStsReg == CAN_INT_STS_CAUSE) {
+        if (FAKE_boolCanStatusInt) {
+            return CAN_INT_INTID_STATUS;
+        }
+        for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+            if (FAKE_stCanObj[i].intpnd) {
+                return i + 1U;
+            }
+        }
+        return 0;
+    }
+    for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+        ui32Status |= FAKE_stCanObj[i].intpnd ? (1UL << i) : 0U;
+    }
+    return ui32Status;
+}
+
+// Reading the control status clears TXOK, RXOK, the last error code and the status interrupt
+uint32_t CANStatusGet(uint32_t ui32Base, tCANStsReg eStatusReg)
+{
+    uint32_t ui32Status = 0;
+    uint32_t i = 0;
+
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    switch (eStatusReg) {
+    case CAN_STS_CONTROL:
+        ui32Status = FAKE_ui32CanStatus;
+        FAKE_ui32CanStatus &= ~(CAN_STATUS_TXOK | CAN_STATUS_RXOK | CAN_STATUS_LEC_MSK);
+        FAKE_boolCanStatusInt = false;
+        FAKE_voidCanLine();
+        break;
+    case CAN_STS_TXREQUEST:
+        for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+            ui32Status |= FAKE_stCanObj[i].txrqst ? (1UL << i) : 0U;
+        }
+        break;
+    case CAN_STS_NEWDAT:
+        for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+            ui32Status |= FAKE_stCanObj[i].newdat ? (1UL << i) : 0U;
+        }
+        break;
+    default:
+        for (i = 0; i < FAKE_CAN_OBJECTS; i++) {
+            ui32Status |= FAKE_stCanObj[i].msgval ? (1UL << i) : 0U;
+        }
+        break;
+    }
+    return ui32Status;
+}
+
+void CANMessageSet(uint32_t ui32Base, uint32_t ui32ObjID, tCANMsgObject *psMsgObject, tMsgObjType eMsgType)
+{
+    FAKE_CanObject *ptrObj = &FAKE_stCanObj[ui32ObjID - 1U];
+    uint32_t ui32Flags = psMsgObject->ui32Flags;
+    bool boolRequest = false;
+
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidCanDetach(ui32ObjID - 1U);
+    memset(ptrObj, 0, sizeof(*ptrObj));
+    ptrObj->msgval = true;
+    ptrObj->id = psMsgObject->ui32MsgID & FAKE_CAN_ID_MASK;
+    ptrObj->mask = psMsgObject->ui32MsgIDMask & FAKE_CAN_ID_MASK;
+    ptrObj->umask = (ui32Flags & MSG_OBJ_USE_ID_FILTER) != 0U;
+    ptrObj->eob = (ui32Flags & MSG_OBJ_FIFO) == 0U;
+    ptrObj->txie = (ui32Flags & MSG_OBJ_TX_INT_ENABLE) != 0U;
+    ptrObj->rxie = (ui32Flags & MSG_OBJ_RX_INT_ENABLE) != 0U;
+    ptrObj->dlc = (uint8_t)((psMsgObject->ui32MsgLen > 8U) ? 8U : psMsgObject->ui32MsgLen);
+
+    switch (eMsgType) {
+    case MSG_OBJ_TYPE_TX:
+        ptrObj->dir = true;
+        ptrObj->txrqst = true;
+        ptrObj->newdat = true;
+        boolRequest = true;
+        break;
+    case MSG_OBJ_TYPE_TX_REMOTE:
+        ptrObj->txrqst = true;
+        boolRequest = true;
+        break;
+    case MSG_OBJ_TYPE_RXTX_REMOTE:
+        ptrObj->dir = true;
+        ptrObj->rmten = true;
+        ptrObj->umask = true;
+        break;
+    case MSG_OBJ_TYPE_RX_REMOTE:
+        ptrObj->dir = true;
+        ptrObj->umask = true;
+        break;
+    default:
+        break;
+    }
+    if (ptrObj->dir && (psMsgObject->pui8MsgData != 0)) {
+        memcpy(ptrObj->data, psMsgObject->pui8MsgData, ptrObj->dlc);
+    }
+    FAKE_voidCanLine();
+    if (boolRequest) {
+        BOARD_voidCanRequest();
+    }
+}
+
+// Reading an object clears its NEWDAT and MSGLST, and its INTPND when asked
+void CANMessageGet(uint32_t ui32Base, uint32_t ui32ObjID, tCANMsgObject *psMsgObject, bool bClrPendingInt)
+{
+    FAKE_CanObject *ptrObj = &FAKE_stCanObj[ui32ObjID - 1U];
+    uint32_t ui32Flags = 0;
+
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ui32Flags |= ptrObj->txie ? MSG_OBJ_TX_INT_ENABLE : 0U;
+    ui32Flags |= ptrObj->rxie ? MSG_OBJ_RX_INT_ENABLE : 0U;
+    ui32Flags |= ptrObj->umask ? MSG_OBJ_USE_ID_FILTER : 0U;
+    ui32Flags |= ptrObj->remote ? MSG_OBJ_REMOTE_FRAME : 0U;
+    ui32Flags |= ptrObj->newdat ? MSG_OBJ_NEW_DATA : 0U;
+    ui32Flags |= ptrObj->msglst ? MSG_OBJ_DATA_LOST : 0U;
+    ui32Flags |= ptrObj->eob ? 0U : MSG_OBJ_FIFO;
+    psMsgObject->ui32MsgID = ptrObj->id;
+    psMsgObject->ui32MsgIDMask = ptrObj->mask;
+    psMsgObject->ui32Flags = ui32Flags;
+    psMsgObject->ui32MsgLen = ptrObj->dlc;
+    if (psMsgObject->pui8MsgData != 0) {
+        memcpy(psMsgObject->pui8MsgData, ptrObj->data, ptrObj->dlc);
+    }
+    ptrObj->newdat = false;
+    ptrObj->msglst = false;
+    if (bClrPendingInt) {
+        ptrObj->intpnd = false;
+    }
+    FAKE_voidCanLine();
+}
+
+void CANMessageClear(uint32_t ui32Base, uint32_t ui32ObjID)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidCanDetach(ui32ObjID - 1U);
+    memset(&FAKE_stCanObj[ui32ObjID - 1U], 0, sizeof(FAKE_stCanObj[0]));
+    FAKE_voidCanLine();
+}
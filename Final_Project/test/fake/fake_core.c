@@ -0,0 +1,644 @@
+/*
+ * fake_core.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) The cycle clock and the timed events of the fake MCU (fake.h).
+ *               2) The interrupt controller: handlers, enables, priorities, pending bits, PRIMASK and the running
+ *                  priority. A pending interrupt is taken when PRIMASK is clear and its priority is above the running
+ *                  one; level-sensitive peripheral lines pend again on exit while the peripheral still asserts them.
+ *               3) The SCS pages, SysTick, SysCtl and the CPU functions (WFI).
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/cpu.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_SCS_BASE           0xE0000000UL    // DWT, SysTick, NVIC, SCB
+#define FAKE_SCS_SIZE           0x00010000UL
+#define FAKE_PERIPH_BASE        0x40000000UL    // APB and AHB peripherals, SysCtl, EEPROM
+#define FAKE_PERIPH_SIZE        0x00100000UL
+
+#define FAKE_DEMCR              0xE000EDFCUL
+#define FAKE_DEMCR_TRCENA       0x01000000UL
+#define FAKE_DWT_CTRL           0xE0001000UL
+#define FAKE_DWT_CYCCNT         0xE0001004UL
+
+#define FAKE_ST_UNWRITTEN       0xFFFFFFFFUL    // Held in NVIC_ST_CURRENT: any firmware write replaces it
+#define FAKE_ST_RELOAD_MASK     0x00FFFFFFUL
+
+#define FAKE_SCS_WORDS          6U
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+uint64_t FAKE_ui64Now = 0;
+
+static FAKE_Timer *FAKE_ptrTimers = 0;
+
+static void (*FAKE_ptrHandlers[FAKE_NUM_INTERRUPTS])(void);
+static bool FAKE_boolEnabled[FAKE_NUM_INTERRUPTS];
+static bool FAKE_boolPendingInt[FAKE_NUM_INTERRUPTS];
+static bool FAKE_boolLine[FAKE_NUM_INTERRUPTS];
+static uint8_t FAKE_ui8Priority[FAKE_NUM_INTERRUPTS];
+static uint32_t FAKE_ui32PendingCount = 0;
+static uint32_t FAKE_ui32Running = FAKE_THREAD_PRIORITY;
+static bool FAKE_boolPrimask = false;
+
+static bool FAKE_boolSysTickOn = false;
+static bool FAKE_boolSysTickInt = false;
+static uint32_t FAKE_ui32SysTickFrozen = 0;     // Counter value while disabled
+static FAKE_Timer FAKE_stSysTick;
+
+// SCS words the firmware reads or writes by address; FAKE_voidSuspend/Resume swap them between two fakes
+static const uint32_t FAKE_ui32ScsAddr[FAKE_SCS_WORDS] = {
+    NVIC_INT_CTRL, NVIC_ST_RELOAD, NVIC_ST_CURRENT, FAKE_DEMCR, FAKE_DWT_CTRL, FAKE_DWT_CYCCNT
+};
+static uint32_t FAKE_ui32ScsSaved[FAKE_SCS_WORDS];
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+static void FAKE_voidMapPages(void) __attribute__((constructor));
+static void FAKE_voidMoveTo(uint64_t a_ui64At);
+static void FAKE_voidAdvance(uint64_t a_ui64Target);
+static void FAKE_voidIntCtrlSync(void);
+static void FAKE_voidIntCtrlMirror(void);
+static uint32_t FAKE_ui32NextInterrupt(void);
+static void FAKE_voidTakeInterrupts(void);
+static void FAKE_voidSysTickFire(void);
+static void FAKE_voidSysTickRestart(void);
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: FAKE_voidMapPages
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Maps zeroed pages at the SCS and peripheral addresses before main. A second fake linked into the
+ *              same process (the simulator's other ECU) finds them mapped and shares them.
+ ***********************************************/
+static void FAKE_voidMapPages(void)
+{
+    static const uintptr_t uiBase[2] = {FAKE_SCS_BASE, FAKE_PERIPH_BASE};
+    static const size_t uiSize[2] = {FAKE_SCS_SIZE, FAKE_PERIPH_SIZE};
+    void *ptrPage = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < 2U; i++) {
+        ptrPage = mmap((void *)uiBase[i], uiSize[i], PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if ((ptrPage == MAP_FAILED) && (errno == EEXIST)) {
+            continue;
+        }
+        if (ptrPage != (void *)uiBase[i]) {
+            fprintf(stderr, "fake: cannot map the registers at 0x%08lx\n", (unsigned long)uiBase[i]);
+            exit(2);
+        }
+    }
+    HWREG(NVIC_ST_CURRENT) = FAKE_ST_UNWRITTEN;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidMoveTo
+ * Inputs: uint64_t a_ui64At - New time, not before FAKE_ui64Now
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Sets the clock; the DWT cycle counter follows while the firmware has it enabled.
+ ***********************************************/
+static void FAKE_voidMoveTo(uint64_t a_ui64At)
+{
+    if ((HWREG(FAKE_DEMCR) & FAKE_DEMCR_TRCENA) && (HWREG(FAKE_DWT_CTRL) & 1U)) {
+        HWREG(FAKE_DWT_CYCCNT) += (uint32_t)(a_ui64At - FAKE_ui64Now);
+    }
+    FAKE_ui64Now = a_ui64At;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidAdvance
+ * Inputs: uint64_t a_ui64Target - Time to reach
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Moves the clock to the target, firing on the way every timer due by then, earliest first.
+ ***********************************************/
+static void FAKE_voidAdvance(uint64_t a_ui64Target)
+{
+    FAKE_Timer *ptrTimer = 0;
+    FAKE_Timer *ptrNext = 0;
+
+    while (1) {
+        ptrNext = 0;
+        for (ptrTimer = FAKE_ptrTimers; ptrTimer != 0; ptrTimer = ptrTimer->next) {
+            if ((ptrTimer->at <= a_ui64Target) && ((ptrNext == 0) || (ptrTimer->at < ptrNext->at))) {
+                ptrNext = ptrTimer;
+            }
+        }
+        if (ptrNext == 0) {
+            break;
+        }
+        if (ptrNext->at > FAKE_ui64Now) {
+            FAKE_voidMoveTo(ptrNext->at);
+        }
+        ptrNext->at = FAKE_NEVER;
+        ptrNext->fire();
+    }
+    if (a_ui64Target > FAKE_ui64Now) {
+        FAKE_voidMoveTo(a_ui64Target);
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_voidTimerSet
+ * Inputs: FAKE_Timer *a_ptrTimer - Timer of a peripheral
+ *         uint64_t a_ui64At - Cycle to fire at, FAKE_NEVER to stop it
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Schedules a peripheral event.
+ ***********************************************/
+void FAKE_voidTimerSet(FAKE_Timer *a_ptrTimer, uint64_t a_ui64At)
+{
+    if (!a_ptrTimer->linked) {
+        a_ptrTimer->next = FAKE_ptrTimers;
+        FAKE_ptrTimers = a_ptrTimer;
+        a_ptrTimer->linked = true;
+    }
+    a_ptrTimer->at = a_ui64At;
+}
+
+/***********************************************
+ * Function Name: FAKE_ui64NextEvent
+ * Inputs: N/A
+ * Outputs: uint64_t - Earliest scheduled peripheral event, FAKE_NEVER if none
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Tells the board how long the MCU can sleep.
+ ***********************************************/
+uint64_t FAKE_ui64NextEvent(void)
+{
+    FAKE_Timer *ptrTimer = 0;
+    uint64_t ui64Next = FAKE_NEVER;
+
+    for (ptrTimer = FAKE_ptrTimers; ptrTimer != 0; ptrTimer = ptrTimer->next) {
+        if (ptrTimer->at < ui64Next) {
+            ui64Next = ptrTimer->at;
+        }
+    }
+    return ui64Next;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidPend
+ * Inputs: uint32_t a_ui32Int - Exception number
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Sets the pending bit of an interrupt, as a pulse from the peripheral or a software request.
+ ***********************************************/
+void FAKE_voidPend(uint32_t a_ui32Int)
+{
+    if (!FAKE_boolPendingInt[a_ui32Int]) {
+        FAKE_boolPendingInt[a_ui32Int] = true;
+        FAKE_ui32PendingCount++;
+        if ((a_ui32Int == FAULT_PENDSV) || (a_ui32Int == FAULT_SYSTICK)) {
+            FAKE_voidIntCtrlMirror();
+        }
+    }
+}
+
+// Clears a pending bit
+static void FAKE_voidUnpend(uint32_t a_ui32Int)
+{
+    if (FAKE_boolPendingInt[a_ui32Int]) {
+        FAKE_boolPendingInt[a_ui32Int] = false;
+        FAKE_ui32PendingCount--;
+        if ((a_ui32Int == FAULT_PENDSV) || (a_ui32Int == FAULT_SYSTICK)) {
+            FAKE_voidIntCtrlMirror();
+        }
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_voidSetLine
+ * Inputs: uint32_t a_ui32Int - Interrupt number of a peripheral
+ *         bool a_boolLevel - Level of its interrupt line
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Drives a level-sensitive line: an asserted line pends the interrupt, and pends it again when its
+ *              handler returns without clearing the cause.
+ ***********************************************/
+void FAKE_voidSetLine(uint32_t a_ui32Int, bool a_boolLevel)
+{
+    FAKE_boolLine[a_ui32Int] = a_boolLevel;
+    if (a_boolLevel) {
+        FAKE_voidPend(a_ui32Int);
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_boolPending
+ * Inputs: uint32_t a_ui32Int - Exception number
+ * Outputs: bool - true if pending
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: For tests.
+ ***********************************************/
+bool FAKE_boolPending(uint32_t a_ui32Int)
+{
+    FAKE_voidIntCtrlSync();
+    return FAKE_boolPendingInt[a_ui32Int];
+}
+
+/***********************************************
+ * Function Name: FAKE_boolMasked
+ * Inputs: N/A
+ * Outputs: bool - PRIMASK
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: For tests.
+ ***********************************************/
+bool FAKE_boolMasked(void)
+{
+    return FAKE_boolPrimask;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidIntCtrlSync
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Merges what the firmware wrote to ICSR and to the SysTick current value since the last call: set or
+ *              clear PendSV, clear SysTick, restart the SysTick count.
+ ***********************************************/
+static void FAKE_voidIntCtrlSync(void)
+{
+    uint32_t ui32IntCtrl = HWREG(NVIC_INT_CTRL);
+
+    if (ui32IntCtrl & NVIC_INT_CTRL_UNPEND_SV) {
+        FAKE_voidUnpend(FAULT_PENDSV);
+    } else if (ui32IntCtrl & NVIC_INT_CTRL_PEND_SV) {
+        FAKE_voidPend(FAULT_PENDSV);
+    }
+    if (ui32IntCtrl & NVIC_INT_CTRL_PENDSTCLR) {
+        FAKE_voidUnpend(FAULT_SYSTICK);
+    }
+    FAKE_voidIntCtrlMirror();
+
+    if (HWREG(NVIC_ST_CURRENT) != FAKE_ST_UNWRITTEN) {
+        HWREG(NVIC_ST_CURRENT) = FAKE_ST_UNWRITTEN;
+        FAKE_ui32SysTickFrozen = 0;
+        if (FAKE_boolSysTickOn) {
+            FAKE_voidSysTickRestart();
+        }
+    }
+}
+
+// Shows the SysTick and PendSV pending bits in ICSR
+static void FAKE_voidIntCtrlMirror(void)
+{
+    HWREG(NVIC_INT_CTRL) = (FAKE_boolPendingInt[FAULT_SYSTICK] ? NVIC_INT_CTRL_PENDSTSET : 0U) |
+                           (FAKE_boolPendingInt[FAULT_PENDSV] ? NVIC_INT_CTRL_PEND_SV : 0U);
+}
+
+/***********************************************
+ * Function Name: FAKE_ui32NextInterrupt
+ * Inputs: N/A
+ * Outputs: uint32_t - Pending interrupt that would preempt now, 0 if none
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Highest priority first, then lowest number; PRIMASK is not considered.
+ ***********************************************/
+static uint32_t FAKE_ui32NextInterrupt(void)
+{
+    uint32_t ui32Best = 0;
+    uint32_t ui32Seen = 0;
+    uint32_t i = 0;
+
+    // Up to the last pending one: a disabled interrupt can stay pending for hours of simulated time
+    for (i = FAULT_PENDSV; (i < FAKE_NUM_INTERRUPTS) && (ui32Seen < FAKE_ui32PendingCount); i++) {
+        if (!FAKE_boolPendingInt[i]) {
+            continue;
+        }
+        ui32Seen++;
+        if (((i < INT_GPIOA) || FAKE_boolEnabled[i]) && (FAKE_ui8Priority[i] < FAKE_ui32Running) &&
+            ((ui32Best == 0U) || (FAKE_ui8Priority[i] < FAKE_ui8Priority[ui32Best]))) {
+            ui32Best = i;
+        }
+    }
+    return ui32Best;
+}
+
+/***********************************************
+ * Function Name: FAKE_voidTakeInterrupts
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Runs the handlers of the interrupts that preempt the current code, nesting by priority.
+ ***********************************************/
+static void FAKE_voidTakeInterrupts(void)
+{
+    uint32_t ui32Int = 0;
+    uint32_t ui32Saved = 0;
+
+    while (!FAKE_boolPrimask && ((ui32Int = FAKE_ui32NextInterrupt()) != 0U)) {
+        if (FAKE_ptrHandlers[ui32Int] == 0) {
+            fprintf(stderr, "fake: interrupt %u taken without a handler\n", (unsigned)ui32Int);
+            abort();
+        }
+        FAKE_voidUnpend(ui32Int);
+        ui32Saved = FAKE_ui32Running;
+        FAKE_ui32Running = FAKE_ui8Priority[ui32Int];
+        FAKE_voidAdvance(FAKE_ui64Now + FAKE_ISR_CYCLES);
+        FAKE_ptrHandlers[ui32Int]();
+        FAKE_voidIntCtrlSync();
+        FAKE_voidAdvance(FAKE_ui64Now + FAKE_ISR_CYCLES);
+        FAKE_ui32Running = ui32Saved;
+        if (FAKE_boolLine[ui32Int]) {
+            FAKE_voidPend(ui32Int);
+        }
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_voidSpend
+ * Inputs: uint32_t a_ui32Cycles - CPU time used
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Charges the firmware for the work of a driverlib call: takes the register writes into account,
+ *              moves the clock, lets the board deliver what it has for this time and takes the interrupts due.
+ ***********************************************/
+void FAKE_voidSpend(uint32_t a_ui32Cycles)
+{
+    FAKE_voidIntCtrlSync();
+    FAKE_voidAdvance(FAKE_ui64Now + a_ui32Cycles);
+    BOARD_voidPoll();
+    FAKE_voidTakeInterrupts();
+}
+
+/***********************************************
+ * Function Name: FAKE_voidSuspend
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Saves this MCU's SCS words before another fake sharing the pages runs.
+ ***********************************************/
+void FAKE_voidSuspend(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < FAKE_SCS_WORDS; i++) {
+        FAKE_ui32ScsSaved[i] = HWREG(FAKE_ui32ScsAddr[i]);
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_voidResume
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Puts back the words FAKE_voidSuspend saved.
+ ***********************************************/
+void FAKE_voidResume(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < FAKE_SCS_WORDS; i++) {
+        HWREG(FAKE_ui32ScsAddr[i]) = FAKE_ui32ScsSaved[i];
+    }
+}
+
+/***********************************************
+ * driverlib/interrupt.h
+ ***********************************************/
+bool IntMasterEnable(void)
+{
+    bool boolWas = FAKE_boolPrimask;
+
+    FAKE_boolPrimask = false;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return boolWas;
+}
+
+bool IntMasterDisable(void)
+{
+    bool boolWas = FAKE_boolPrimask;
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_boolPrimask = true;
+    return boolWas;
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void))
+{
+    FAKE_ptrHandlers[ui32Interrupt] = pfnHandler;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    FAKE_boolEnabled[ui32Interrupt] = true;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    FAKE_boolEnabled[ui32Interrupt] = false;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority)
+{
+    FAKE_ui8Priority[ui32Interrupt] = (uint8_t)(ui8Priority & 0xE0U);
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+/***********************************************
+ * driverlib/cpu.h
+ ***********************************************/
+uint32_t CPUcpsid(void)
+{
+    return IntMasterDisable() ? 1U : 0U;
+}
+
+uint32_t CPUcpsie(void)
+{
+    return IntMasterEnable() ? 1U : 0U;
+}
+
+// Sleeps until an interrupt that would preempt the current code is pending, whether PRIMASK masks it or not
+void CPUwfi(void)
+{
+    uint64_t ui64Wake = 0;
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    while (FAKE_ui32NextInterrupt() == 0U) {
+        ui64Wake = BOARD_ui64Sleep(FAKE_ui64NextEvent());
+        if (ui64Wake == FAKE_NEVER) {
+            fprintf(stderr, "fake: WFI with nothing left to wake the core\n");
+            abort();
+        }
+        FAKE_voidAdvance(ui64Wake);
+        BOARD_voidPoll();
+        FAKE_voidIntCtrlSync();
+    }
+    FAKE_voidTakeInterrupts();
+}
+
+/***********************************************
+ * driverlib/sysctl.h
+ ***********************************************/
+void SysCtlClockSet(uint32_t ui32Config)
+{
+    (void)ui32Config;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+uint32_t SysCtlClockGet(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_CPU_HZ;
+}
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return true;
+}
+
+// Three cycles per loop count
+void SysCtlDelay(uint32_t ui32Count)
+{
+    FAKE_voidSpend(ui32Count * 3U);
+}
+
+/***********************************************
+ * driverlib/systick.h
+ * The counter reaches zero RELOAD + 1 cycles after it was (re)loaded, pends its exception and reloads from the
+ * RELOAD word as it is then. A write to CURRENT clears the count: the next enable starts a full period.
+ ***********************************************/
+
+// Fires at zero
+static void FAKE_voidSysTickFire(void)
+{
+    uint32_t ui32Reload = HWREG(NVIC_ST_RELOAD) & FAKE_ST_RELOAD_MASK;
+
+    if (FAKE_boolSysTickInt) {
+        FAKE_voidPend(FAULT_SYSTICK);
+    }
+    if (ui32Reload != 0U) {
+        FAKE_voidTimerSet(&FAKE_stSysTick, FAKE_ui64Now + ui32Reload + 1U);
+    } else {
+        FAKE_boolSysTickOn = false;
+        FAKE_ui32SysTickFrozen = 0;
+    }
+}
+
+// Starts a full period now
+static void FAKE_voidSysTickRestart(void)
+{
+    FAKE_stSysTick.fire = FAKE_voidSysTickFire;
+    FAKE_voidTimerSet(&FAKE_stSysTick, FAKE_ui64Now + (HWREG(NVIC_ST_RELOAD) & FAKE_ST_RELOAD_MASK) + 1U);
+}
+
+void SysTickEnable(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (FAKE_boolSysTickOn) {
+        return;
+    }
+    FAKE_boolSysTickOn = true;
+    if (FAKE_ui32SysTickFrozen == 0U) {
+        FAKE_voidSysTickRestart();
+    } else {
+        FAKE_stSysTick.fire = FAKE_voidSysTickFire;
+        FAKE_voidTimerSet(&FAKE_stSysTick, FAKE_ui64Now + FAKE_ui32SysTickFrozen);
+    }
+}
+
+void SysTickDisable(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (!FAKE_boolSysTickOn) {
+        return;
+    }
+    FAKE_boolSysTickOn = false;
+    FAKE_ui32SysTickFrozen = (uint32_t)(FAKE_stSysTick.at - FAKE_ui64Now);
+    FAKE_voidTimerSet(&FAKE_stSysTick, FAKE_NEVER);
+}
+
+void SysTickIntRegister(void (*pfnHandler)(void))
+{
+    IntRegister(FAULT_SYSTICK, pfnHandler);
+}
+
+void SysTickIntEnable(void)
+{
+    FAKE_boolSysTickInt = true;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void SysTickIntDisable(void)
+{
+    FAKE_boolSysTickInt = false;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void SysTickPeriodSet(uint32_t ui32Period)
+{
+    HWREG(NVIC_ST_RELOAD) = ui32Period - 1U;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+uint32_t SysTickPeriodGet(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return (HWREG(NVIC_ST_RELOAD) & FAKE_ST_RELOAD_MASK) + 1U;
+}
+
+uint32_t SysTickValueGet(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (!FAKE_boolSysTickOn) {
+        return FAKE_ui32SysTickFrozen;
+    }
+    return (uint32_t)(FAKE_stSysTick.at - FAKE_ui64Now);
+}
@@ -0,0 +1,129 @@
+/*
+ * fake_eeprom.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) The 2 KB EEPROM of the fake MCU, erased (0xFF) at power-on. Programming stalls the CPU for the
+ *                  duration of each word write, as EEPROMProgram does on the target.
+ *               2) SSI0 and SSI1, which no test or scenario drives: writes are dropped and nothing is ever received.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "driverlib/eeprom.h"
+#include "driverlib/ssi.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static uint8_t FAKE_ui8Eeprom[FAKE_EEPROM_BYTES];
+static bool FAKE_boolEepromErased = false;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: FAKE_pui8Eeprom
+ * Inputs: N/A
+ * Outputs: uint8_t * - The EEPROM contents
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Lets a test or the simulator preset or inspect the stored words.
+ ***********************************************/
+uint8_t *FAKE_pui8Eeprom(void)
+{
+    if (!FAKE_boolEepromErased) {
+        memset(FAKE_ui8Eeprom, 0xFF, sizeof(FAKE_ui8Eeprom));
+        FAKE_boolEepromErased = true;
+    }
+    return FAKE_ui8Eeprom;
+}
+
+/***********************************************
+ * driverlib/eeprom.h
+ ***********************************************/
+uint32_t EEPROMInit(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    (void)FAKE_pui8Eeprom();
+    return EEPROM_INIT_OK;
+}
+
+uint32_t EEPROMSizeGet(void)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_EEPROM_BYTES;
+}
+
+void EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES + ui32Count);
+    if ((ui32Address + ui32Count) <= FAKE_EEPROM_BYTES) {
+        memcpy(pui32Data, FAKE_pui8Eeprom() + ui32Address, ui32Count);
+    }
+}
+
+uint32_t EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    if ((ui32Address + ui32Count) <= FAKE_EEPROM_BYTES) {
+        memcpy(FAKE_pui8Eeprom() + ui32Address, pui32Data, ui32Count);
+    }
+    FAKE_voidSpend(FAKE_CALL_CYCLES + (((ui32Count + 3U) / 4U) * FAKE_EEPROM_WORD_CYCLES));
+    return 0;
+}
+
+/***********************************************
+ * driverlib/ssi.h
+ ***********************************************/
+void SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol, uint32_t ui32Mode,
+                        uint32_t ui32BitRate, uint32_t ui32DataWidth)
+{
+    (void)ui32Base;
+    (void)ui32SSIClk;
+    (void)ui32Protocol;
+    (void)ui32Mode;
+    (void)ui32BitRate;
+    (void)ui32DataWidth;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void SSIEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void SSIDisable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void SSIDataPut(uint32_t ui32Base, uint32_t ui32Data)
+{
+    (void)ui32Base;
+    (void)ui32Data;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+int32_t SSIDataGetNonBlocking(uint32_t ui32Base, uint32_t *pui32Data)
+{
+    (void)ui32Base;
+    (void)pui32Data;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return 0;
+}
+
+bool SSIBusy(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return false;
+}
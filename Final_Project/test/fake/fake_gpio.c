@@ -0,0 +1,264 @@
+/*
+ * fake_gpio.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: GPIO ports A to F of the fake MCU. Output pins are reported to the board when they change; input
+ *               pins read the levels the board drives (pulled up until then) and raise the edge interrupts
+ *               configured on them.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/gpio.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_GPIO_PORTS     6U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t base;
+    uint32_t interrupt;
+    uint8_t dir;                // Output pins
+    uint8_t data;               // Output latch
+    uint8_t input;              // Level driven from outside
+    uint8_t rising;             // Pins interrupting on a rising edge
+    uint8_t falling;            // Pins interrupting on a falling edge
+    uint8_t ris;
+    uint8_t im;
+} FAKE_GpioPort;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static FAKE_GpioPort FAKE_stGpio[FAKE_GPIO_PORTS] = {
+    {GPIO_PORTA_BASE, INT_GPIOA, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+    {GPIO_PORTB_BASE, INT_GPIOB, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+    {GPIO_PORTC_BASE, INT_GPIOC, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+    {GPIO_PORTD_BASE, INT_GPIOD, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+    {GPIO_PORTE_BASE, INT_GPIOE, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+    {GPIO_PORTF_BASE, INT_GPIOF, 0, 0, 0xFFU, 0, 0xFFU, 0, 0},
+};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static FAKE_GpioPort *FAKE_ptrGpio(uint32_t a_ui32Port)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < (FAKE_GPIO_PORTS - 1U); i++) {
+        if (FAKE_stGpio[i].base == a_ui32Port) {
+            break;
+        }
+    }
+    return &FAKE_stGpio[i];
+}
+
+static void FAKE_voidGpioLine(FAKE_GpioPort *a_ptrPort)
+{
+    FAKE_voidSetLine(a_ptrPort->interrupt, (a_ptrPort->ris & a_ptrPort->im) != 0U);
+}
+
+// Output latch as seen on the pins
+static void FAKE_voidGpioSet(FAKE_GpioPort *a_ptrPort, uint8_t a_ui8Dir, uint8_t a_ui8Data)
+{
+    uint8_t ui8Old = a_ptrPort->data & a_ptrPort->dir;
+    uint8_t ui8New = a_ui8Data & a_ui8Dir;
+
+    a_ptrPort->dir = a_ui8Dir;
+    a_ptrPort->data = a_ui8Data;
+    if (ui8New != ui8Old) {
+        BOARD_voidGpioOutput(a_ptrPort->base, ui8Old, ui8New);
+    }
+}
+
+/***********************************************
+ * Function Name: FAKE_voidGpioInput
+ * Inputs: uint32_t a_ui32Port - Port base address
+ *         uint8_t a_ui8Pins - Pins driven
+ *         uint8_t a_ui8Level - Their new level
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Drives input pins from outside, e.g. a button pressed to ground.
+ ***********************************************/
+void FAKE_voidGpioInput(uint32_t a_ui32Port, uint8_t a_ui8Pins, uint8_t a_ui8Level)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(a_ui32Port);
+    uint8_t ui8Old = ptrPort->input;
+    uint8_t ui8New = (uint8_t)((ui8Old & ~a_ui8Pins) | (a_ui8Level & a_ui8Pins));
+    uint8_t ui8Edges = (uint8_t)((~ui8Old & ui8New & ptrPort->rising) | (ui8Old & ~ui8New & ptrPort->falling));
+
+    ptrPort->input = ui8New;
+    ptrPort->ris |= (uint8_t)(ui8Edges & ~ptrPort->dir);
+    FAKE_voidGpioLine(ptrPort);
+}
+
+/***********************************************
+ * Function Name: FAKE_ui8GpioOutput
+ * Inputs: uint32_t a_ui32Port - Port base address
+ * Outputs: uint8_t - Levels of the output pins, 0 on the others
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: For tests.
+ ***********************************************/
+uint8_t FAKE_ui8GpioOutput(uint32_t a_ui32Port)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(a_ui32Port);
+
+    return ptrPort->data & ptrPort->dir;
+}
+
+/***********************************************
+ * driverlib/gpio.h
+ ***********************************************/
+void GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidGpioSet(ptrPort, (uint8_t)(ptrPort->dir & ~ui8Pins), ptrPort->data);
+}
+
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidGpioSet(ptrPort, (uint8_t)(ptrPort->dir | ui8Pins), ptrPort->data);
+}
+
+// Alternate functions: the pins leave the GPIO model
+static void FAKE_voidGpioAlternate(uint32_t a_ui32Port, uint8_t a_ui8Pins)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(a_ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidGpioSet(ptrPort, (uint8_t)(ptrPort->dir & ~a_ui8Pins), ptrPort->data);
+}
+
+void GPIOPinTypeADC(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_voidGpioAlternate(ui32Port, ui8Pins);
+}
+
+void GPIOPinTypeCAN(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_voidGpioAlternate(ui32Port, ui8Pins);
+}
+
+void GPIOPinTypeSSI(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_voidGpioAlternate(ui32Port, ui8Pins);
+}
+
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_voidGpioAlternate(ui32Port, ui8Pins);
+}
+
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PadType)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+    (void)ui32Strength;
+    (void)ui32PadType;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+    (void)ui32PinConfig;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return (int32_t)(((ptrPort->data & ptrPort->dir) | (ptrPort->input & ~ptrPort->dir)) & ui8Pins);
+}
+
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_voidGpioSet(ptrPort, ptrPort->dir, (uint8_t)((ptrPort->data & ~ui8Pins) | (ui8Val & ui8Pins)));
+}
+
+void GPIOIntRegister(uint32_t ui32Port, void (*pfnIntHandler)(void))
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    IntRegister(ptrPort->interrupt, pfnIntHandler);
+    IntEnable(ptrPort->interrupt);
+}
+
+// Edge types only; the level types are not used by the firmware
+void GPIOIntTypeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32IntType)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrPort->rising &= (uint8_t)~ui8Pins;
+    ptrPort->falling &= (uint8_t)~ui8Pins;
+    if ((ui32IntType == GPIO_RISING_EDGE) || (ui32IntType == GPIO_BOTH_EDGES)) {
+        ptrPort->rising |= ui8Pins;
+    }
+    if ((ui32IntType == GPIO_FALLING_EDGE) || (ui32IntType == GPIO_BOTH_EDGES)) {
+        ptrPort->falling |= ui8Pins;
+    }
+}
+
+void GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrPort->im |= (uint8_t)ui32IntFlags;
+    FAKE_voidGpioLine(ptrPort);
+}
+
+void GPIOIntDisable(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrPort->im &= (uint8_t)~ui32IntFlags;
+    FAKE_voidGpioLine(ptrPort);
+}
+
+void GPIOIntClear(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrPort->ris &= (uint8_t)~ui32IntFlags;
+    FAKE_voidGpioLine(ptrPort);
+}
+
+uint32_t GPIOIntStatus(uint32_t ui32Port, bool bMasked)
+{
+    FAKE_GpioPort *ptrPort = FAKE_ptrGpio(ui32Port);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return bMasked ? (uint32_t)(ptrPort->ris & ptrPort->im) : ptrPort->ris;
+}
@@ -0,0 +1,298 @@
+/*
+ * fake_timer.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) General-purpose timers of the fake MCU: TIMER0 and TIMER1 as full-width down counters, one-shot or
+ *                  periodic, with the timeout interrupt; WTIMER0 as the 64-bit up counter of the time base.
+ *               2) The watchdog: the first timeout raises its interrupt flag, the second one resets the MCU, which
+ *                  the board is told about.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/timer.h"
+#include "driverlib/watchdog.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_GPTM_COUNT     2U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t base;
+    uint32_t interrupt;
+    uint32_t config;            // TIMER_CFG_*
+    uint32_t load;
+    uint32_t value;             // Count while disabled
+    bool enabled;
+    bool intEnabled;
+    bool raw;                   // Timeout flag
+    FAKE_Timer timeout;
+} FAKE_Gptm;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static void FAKE_voidTimer0Fire(void);
+static void FAKE_voidTimer1Fire(void);
+
+static FAKE_Gptm FAKE_stGptm[FAKE_GPTM_COUNT] = {
+    {TIMER0_BASE, INT_TIMER0A, 0, 0, 0, false, false, false, {FAKE_NEVER, FAKE_voidTimer0Fire, 0, false}},
+    {TIMER1_BASE, INT_TIMER1A, 0, 0, 0, false, false, false, {FAKE_NEVER, FAKE_voidTimer1Fire, 0, false}},
+};
+
+static bool FAKE_boolWtimerOn = false;
+static uint64_t FAKE_ui64WtimerStart = 0;       // FAKE_ui64Now when WTIMER0 was enabled
+
+static uint32_t FAKE_ui32WdogLoad = 0xFFFFFFFFU;
+static bool FAKE_boolWdogOn = false;
+static bool FAKE_boolWdogReset = false;
+static bool FAKE_boolWdogRaw = false;
+static void FAKE_voidWdogFire(void);
+static FAKE_Timer FAKE_stWdog = {FAKE_NEVER, FAKE_voidWdogFire, 0, false};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+// Timer of a base address; 0 for WTIMER0
+static FAKE_Gptm *FAKE_ptrGptm(uint32_t a_ui32Base)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < FAKE_GPTM_COUNT; i++) {
+        if (FAKE_stGptm[i].base == a_ui32Base) {
+            return &FAKE_stGptm[i];
+        }
+    }
+    return 0;
+}
+
+// Timeout: flag, interrupt line, then stop (one-shot) or reload (periodic)
+static void FAKE_voidGptmFire(FAKE_Gptm *a_ptrTimer)
+{
+    a_ptrTimer->raw = true;
+    FAKE_voidSetLine(a_ptrTimer->interrupt, a_ptrTimer->intEnabled);
+    a_ptrTimer->value = a_ptrTimer->load;
+    if (a_ptrTimer->config == TIMER_CFG_PERIODIC) {
+        FAKE_voidTimerSet(&a_ptrTimer->timeout, FAKE_ui64Now + a_ptrTimer->load);
+    } else {
+        a_ptrTimer->enabled = false;
+    }
+}
+
+static void FAKE_voidTimer0Fire(void)
+{
+    FAKE_voidGptmFire(&FAKE_stGptm[0]);
+}
+
+static void FAKE_voidTimer1Fire(void)
+{
+    FAKE_voidGptmFire(&FAKE_stGptm[1]);
+}
+
+/***********************************************
+ * driverlib/timer.h
+ ***********************************************/
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ptrTimer != 0) {
+        ptrTimer->config = ui32Config;
+        ptrTimer->enabled = false;
+        FAKE_voidTimerSet(&ptrTimer->timeout, FAKE_NEVER);
+    } else {
+        FAKE_boolWtimerOn = false;
+    }
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    (void)ui32Timer;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ptrTimer == 0) {
+        if (!FAKE_boolWtimerOn) {
+            FAKE_boolWtimerOn = true;
+            FAKE_ui64WtimerStart = FAKE_ui64Now;
+        }
+        return;
+    }
+    if (!ptrTimer->enabled) {
+        ptrTimer->enabled = true;
+        FAKE_voidTimerSet(&ptrTimer->timeout, FAKE_ui64Now + ptrTimer->value);
+    }
+}
+
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    (void)ui32Timer;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if ((ptrTimer != 0) && ptrTimer->enabled) {
+        ptrTimer->enabled = false;
+        ptrTimer->value = (uint32_t)(ptrTimer->timeout.at - FAKE_ui64Now);
+        FAKE_voidTimerSet(&ptrTimer->timeout, FAKE_NEVER);
+    }
+}
+
+void TimerControlStall(uint32_t ui32Base, uint32_t ui32Timer, bool bStall)
+{
+    (void)ui32Base;
+    (void)ui32Timer;
+    (void)bStall;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+// A new load is taken by the counter at once
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    (void)ui32Timer;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ptrTimer == 0) {
+        return;
+    }
+    ptrTimer->load = ui32Value;
+    ptrTimer->value = ui32Value;
+    if (ptrTimer->enabled) {
+        FAKE_voidTimerSet(&ptrTimer->timeout, FAKE_ui64Now + ui32Value);
+    }
+}
+
+void TimerLoadSet64(uint32_t ui32Base, uint64_t ui64Value)
+{
+    (void)ui32Base;
+    (void)ui64Value;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+uint64_t TimerValueGet64(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_boolWtimerOn ? (FAKE_ui64Now - FAKE_ui64WtimerStart) : 0U;
+}
+
+void TimerIntRegister(uint32_t ui32Base, uint32_t ui32Timer, void (*pfnHandler)(void))
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    (void)ui32Timer;
+    if (ptrTimer != 0) {
+        IntRegister(ptrTimer->interrupt, pfnHandler);
+        IntEnable(ptrTimer->interrupt);
+    }
+}
+
+void TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if ((ptrTimer != 0) && (ui32IntFlags & TIMER_TIMA_TIMEOUT)) {
+        ptrTimer->intEnabled = true;
+        FAKE_voidSetLine(ptrTimer->interrupt, ptrTimer->raw);
+    }
+}
+
+void TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_Gptm *ptrTimer = FAKE_ptrGptm(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if ((ptrTimer != 0) && (ui32IntFlags & TIMER_TIMA_TIMEOUT)) {
+        ptrTimer->raw = false;
+        FAKE_voidSetLine(ptrTimer->interrupt, false);
+    }
+}
+
+/***********************************************
+ * driverlib/watchdog.h
+ ***********************************************/
+
+// Counter reached zero
+static void FAKE_voidWdogFire(void)
+{
+    if (FAKE_boolWdogRaw && FAKE_boolWdogReset) {
+        BOARD_voidReset("watchdog");
+    }
+    FAKE_boolWdogRaw = true;
+    FAKE_voidTimerSet(&FAKE_stWdog, FAKE_ui64Now + FAKE_ui32WdogLoad);
+}
+
+bool WatchdogLockState(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return false;
+}
+
+void WatchdogUnlock(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+// Writing the load also reloads the counter
+void WatchdogReloadSet(uint32_t ui32Base, uint32_t ui32LoadVal)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ui32WdogLoad = ui32LoadVal;
+    if (FAKE_boolWdogOn) {
+        FAKE_voidTimerSet(&FAKE_stWdog, FAKE_ui64Now + FAKE_ui32WdogLoad);
+    }
+}
+
+void WatchdogStallEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void WatchdogResetEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_boolWdogReset = true;
+}
+
+void WatchdogEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (!FAKE_boolWdogOn) {
+        FAKE_boolWdogOn = true;
+        FAKE_voidTimerSet(&FAKE_stWdog, FAKE_ui64Now + FAKE_ui32WdogLoad);
+    }
+}
+
+void WatchdogIntClear(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_boolWdogRaw = false;
+    if (FAKE_boolWdogOn) {
+        FAKE_voidTimerSet(&FAKE_stWdog, FAKE_ui64Now + FAKE_ui32WdogLoad);
+    }
+}
@@ -0,0 +1,307 @@
+/*
+ * fake_uart.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) UART0 and UART1 of the fake MCU: 16-deep transmit and receive FIFOs moving one character per
+ *                  ten bit times, handed to the board as they leave the shift register.
+ *               2) Interrupts: TX when the transmit FIFO drains through its trigger level (or empties in EOT
+ *                  mode), RX when the receive FIFO fills to its level, RT when received characters wait for 32 bit
+ *                  times.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define FAKE_UART_COUNT         2U
+#define FAKE_UART_FIFO          16U
+#define FAKE_UART_CHAR_BITS     10U     // Start, 8 data, stop
+#define FAKE_UART_RT_BITS       32U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t base;
+    uint32_t interrupt;
+    uint32_t bitCycles;
+    uint32_t txLevel;           // TX interrupt when the FIFO drains to this many characters
+    uint32_t rxLevel;           // RX interrupt when the FIFO holds this many characters
+    bool eot;
+    bool shifting;              // A character is on the line
+    uint8_t shifter;
+    uint8_t tx[FAKE_UART_FIFO];
+    uint32_t txHead;
+    uint32_t txCount;
+    uint8_t rx[FAKE_UART_FIFO];
+    uint32_t rxHead;
+    uint32_t rxCount;
+    uint32_t ris;
+    uint32_t im;
+    FAKE_Timer txTimer;
+    FAKE_Timer rtTimer;
+} FAKE_Uart;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static void FAKE_voidUart0TxFire(void);
+static void FAKE_voidUart1TxFire(void);
+static void FAKE_voidUart0RtFire(void);
+static void FAKE_voidUart1RtFire(void);
+
+static FAKE_Uart FAKE_stUart[FAKE_UART_COUNT] = {
+    {UART0_BASE, INT_UART0, FAKE_CPU_HZ / 9600U, 8U, 8U, false, false, 0, {0}, 0, 0, {0}, 0, 0, 0, 0,
+     {FAKE_NEVER, FAKE_voidUart0TxFire, 0, false}, {FAKE_NEVER, FAKE_voidUart0RtFire, 0, false}},
+    {UART1_BASE, INT_UART1, FAKE_CPU_HZ / 9600U, 8U, 8U, false, false, 0, {0}, 0, 0, {0}, 0, 0, 0, 0,
+     {FAKE_NEVER, FAKE_voidUart1TxFire, 0, false}, {FAKE_NEVER, FAKE_voidUart1RtFire, 0, false}},
+};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static FAKE_Uart *FAKE_ptrUart(uint32_t a_ui32Base)
+{
+    return (a_ui32Base == UART1_BASE) ? &FAKE_stUart[1] : &FAKE_stUart[0];
+}
+
+static void FAKE_voidUartLine(FAKE_Uart *a_ptrUart)
+{
+    FAKE_voidSetLine(a_ptrUart->interrupt, (a_ptrUart->ris & a_ptrUart->im) != 0U);
+}
+
+// Moves the next character of the transmit FIFO to the line
+static void FAKE_voidUartShift(FAKE_Uart *a_ptrUart)
+{
+    uint32_t ui32Before = a_ptrUart->txCount;
+
+    if (a_ptrUart->shifting || (a_ptrUart->txCount == 0U)) {
+        return;
+    }
+    a_ptrUart->shifter = a_ptrUart->tx[a_ptrUart->txHead];
+    a_ptrUart->txHead = (a_ptrUart->txHead + 1U) % FAKE_UART_FIFO;
+    a_ptrUart->txCount--;
+    a_ptrUart->shifting = true;
+    FAKE_voidTimerSet(&a_ptrUart->txTimer, FAKE_ui64Now + (FAKE_UART_CHAR_BITS * a_ptrUart->bitCycles));
+    if (!a_ptrUart->eot && (ui32Before > a_ptrUart->txLevel) && (a_ptrUart->txCount <= a_ptrUart->txLevel)) {
+        a_ptrUart->ris |= UART_INT_TX;
+        FAKE_voidUartLine(a_ptrUart);
+    }
+}
+
+// Stop bit of the character on the line
+static void FAKE_voidUartTxFire(FAKE_Uart *a_ptrUart)
+{
+    a_ptrUart->shifting = false;
+    BOARD_voidUartTransmit(a_ptrUart->base, a_ptrUart->shifter);
+    FAKE_voidUartShift(a_ptrUart);
+    if (a_ptrUart->eot && !a_ptrUart->shifting) {
+        a_ptrUart->ris |= UART_INT_TX;
+        FAKE_voidUartLine(a_ptrUart);
+    }
+}
+
+static void FAKE_voidUart0TxFire(void)
+{
+    FAKE_voidUartTxFire(&FAKE_stUart[0]);
+}
+
+static void FAKE_voidUart1TxFire(void)
+{
+    FAKE_voidUartTxFire(&FAKE_stUart[1]);
+}
+
+// Receive timeout
+static void FAKE_voidUartRtFire(FAKE_Uart *a_ptrUart)
+{
+    if (a_ptrUart->rxCount != 0U) {
+        a_ptrUart->ris |= UART_INT_RT;
+        FAKE_voidUartLine(a_ptrUart);
+    }
+}
+
+static void FAKE_voidUart0RtFire(void)
+{
+    FAKE_voidUartRtFire(&FAKE_stUart[0]);
+}
+
+static void FAKE_voidUart1RtFire(void)
+{
+    FAKE_voidUartRtFire(&FAKE_stUart[1]);
+}
+
+/***********************************************
+ * Function Name: FAKE_voidUartReceive
+ * Inputs: uint32_t a_ui32Base - UART
+ *         uint8_t a_ui8Char - Character whose stop bit just arrived
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Puts a character into the receive FIFO; a full FIFO loses it (overrun).
+ ***********************************************/
+void FAKE_voidUartReceive(uint32_t a_ui32Base, uint8_t a_ui8Char)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(a_ui32Base);
+
+    if (ptrUart->rxCount < FAKE_UART_FIFO) {
+        ptrUart->rx[(ptrUart->rxHead + ptrUart->rxCount) % FAKE_UART_FIFO] = a_ui8Char;
+        ptrUart->rxCount++;
+    }
+    if (ptrUart->rxCount >= ptrUart->rxLevel) {
+        ptrUart->ris |= UART_INT_RX;
+    }
+    FAKE_voidTimerSet(&ptrUart->rtTimer, FAKE_ui64Now + (FAKE_UART_RT_BITS * ptrUart->bitCycles));
+    FAKE_voidUartLine(ptrUart);
+}
+
+/***********************************************
+ * driverlib/uart.h
+ ***********************************************/
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config)
+{
+    (void)ui32Config;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ptrUart(ui32Base)->bitCycles = ui32UARTClk / ui32Baud;
+}
+
+void UARTEnable(uint32_t ui32Base)
+{
+    (void)ui32Base;
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel)
+{
+    static const uint32_t ui32Eighths[5] = {2U, 4U, 8U, 12U, 14U};
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrUart->txLevel = ui32Eighths[ui32TxLevel % 5U];
+    ptrUart->rxLevel = ui32Eighths[(ui32RxLevel >> 3) % 5U];
+}
+
+void UARTTxIntModeSet(uint32_t ui32Base, uint32_t ui32Mode)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    FAKE_ptrUart(ui32Base)->eot = (ui32Mode == UART_TXINT_MODE_EOT);
+}
+
+// Waits for room in the FIFO; the core keeps taking interrupts meanwhile
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    while (ptrUart->txCount >= FAKE_UART_FIFO) {
+        FAKE_voidSpend((uint32_t)(ptrUart->txTimer.at - FAKE_ui64Now));
+    }
+    ptrUart->tx[(ptrUart->txHead + ptrUart->txCount) % FAKE_UART_FIFO] = ucData;
+    ptrUart->txCount++;
+    FAKE_voidUartShift(ptrUart);
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ptrUart->txCount >= FAKE_UART_FIFO) {
+        return false;
+    }
+    ptrUart->tx[(ptrUart->txHead + ptrUart->txCount) % FAKE_UART_FIFO] = ucData;
+    ptrUart->txCount++;
+    FAKE_voidUartShift(ptrUart);
+    return true;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+    uint8_t ui8Char = 0;
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    if (ptrUart->rxCount == 0U) {
+        return -1;
+    }
+    ui8Char = ptrUart->rx[ptrUart->rxHead];
+    ptrUart->rxHead = (ptrUart->rxHead + 1U) % FAKE_UART_FIFO;
+    ptrUart->rxCount--;
+    if (ptrUart->rxCount < ptrUart->rxLevel) {
+        ptrUart->ris &= ~UART_INT_RX;
+    }
+    if (ptrUart->rxCount == 0U) {
+        ptrUart->ris &= ~UART_INT_RT;
+    }
+    FAKE_voidUartLine(ptrUart);
+    return ui8Char;
+}
+
+bool UARTCharsAvail(uint32_t ui32Base)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_ptrUart(ui32Base)->rxCount != 0U;
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return FAKE_ptrUart(ui32Base)->txCount < FAKE_UART_FIFO;
+}
+
+void UARTIntRegister(uint32_t ui32Base, void (*pfnHandler)(void))
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    IntRegister(ptrUart->interrupt, pfnHandler);
+    IntEnable(ptrUart->interrupt);
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrUart->im |= ui32IntFlags;
+    FAKE_voidUartLine(ptrUart);
+}
+
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrUart->im &= ~ui32IntFlags;
+    FAKE_voidUartLine(ptrUart);
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    ptrUart->ris &= ~ui32IntFlags;
+    FAKE_voidUartLine(ptrUart);
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    FAKE_Uart *ptrUart = FAKE_ptrUart(ui32Base);
+
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    return bMasked ? (ptrUart->ris & ptrUart->im) : ptrUart->ris;
+}
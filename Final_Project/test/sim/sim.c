@@ -0,0 +1,762 @@
+/*
+ * sim.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Simulator of the two ECUs on their CAN bus: Master_ and Slave_ run unchanged in one process, each
+ *                  on its fake MCU, against a scenario (sim_scenario.c) of sensor waveforms, key presses, tester
+ *                  input and bus faults, with timed expectations on what the board shows.
+ *                      sim [-v] <scenario>     -v: print the UART lines and LED changes as they happen
+ *               2) Virtual time: a clock per ECU that only moves when the ECU has something scheduled, so an idle
+ *                  ECU skips to its next SysTick. The ECUs run in turns; the one behind runs, up to a horizon no
+ *                  later than the earliest time the other ECU or the scenario could still change what it sees
+ *                  (conservative synchronisation). A frame takes at least SIM_LOOKAHEAD from arbitration to
+ *                  delivery, which is what lets an ECU run ahead of the other.
+ *               3) The bus: 500 kbit/s, one frame at a time, lowest identifier first, stuff bits left out. The
+ *                  arbitration is decided once both ECUs have reached its time; the receiver gets the frame and the
+ *                  sender its end of transmission at the end of the frame, acknowledged if another node was on the
+ *                  bus. An unplugged ECU is alone on its own segment: its frames are not acknowledged.
+ *               4) The run is deterministic: the same scenario gives the same report and the same digest of every
+ *                  frame, UART character, LED change and reset, whatever the host. The report goes to stdout, the
+ *                  wall-clock speed to stderr.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "inc/hw_memmap.h"
+#include "sim.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define SIM_CAN_BIT_CYCLES      (FAKE_CPU_HZ / 500000U)             // 500 kbit/s
+#define SIM_CAN_FRAME_BITS      44U                                 // SOF to EOF without data
+#define SIM_CAN_IFS_BITS        3U                                  // Interframe space
+#define SIM_CAN_IDS             0x800U
+#define SIM_LOOKAHEAD           ((uint64_t)SIM_CAN_FRAME_BITS * SIM_CAN_BIT_CYCLES)
+
+#define SIM_UART_CHAR_CYCLES    (FAKE_CPU_HZ / 960U)                // 10 bits at 9600 baud
+#define SIM_UART_CAPTURE        65536U                              // Last characters kept for expectations
+#define SIM_UART_LINE           160U
+
+#define SIM_LEDS                3U                                  // PF1 red, PF2 blue, PF3 green
+#define SIM_LED_FIRST_PIN       1U
+#define SIM_BLINK_WINDOW        (3U * SIM_S)                        // HAL_voidLedBlink toggles every 1 to 1.2 s
+
+#define SIM_ADC_MAX             4095U
+#define SIM_TEMP_FULL_SCALE     40.0f                               // Slave_ ADC.c: 0 to 40 degC
+#define SIM_VOLT_FULL_SCALE     3.0f                                // Slave_ ADC.c: 0 to 3 V
+#define SIM_TEMP_START          22.0f
+#define SIM_VOLT_START          3.0f
+
+#define SIM_FNV_OFFSET          14695981039346656037ULL
+#define SIM_FNV_PRIME           1099511628211ULL
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint8_t level;
+    uint32_t changes;
+    uint64_t changed[2];        // Last two changes, latest first
+} SimLed;
+
+typedef struct {
+    SimState state;
+    uint64_t horizon;
+    bool connected;
+    bool request;               // A frame may wait in the controller since requestAt
+    uint64_t requestAt;
+    uint64_t busFree;           // End of the interframe space after the last frame on the segment
+    SimLed led[SIM_LEDS];
+    char uart[SIM_UART_CAPTURE + 1U];
+    uint32_t uartLength;
+    char line[SIM_UART_LINE + 1U];
+    uint32_t lineLength;
+    uint32_t resets;
+    uint64_t frames;
+    uint64_t nacks;
+    uint64_t chars;
+    uint64_t ledChanges;
+    uint64_t runs;
+} SimNode;
+
+// Sensor waveform: piecewise linear, one segment per temp or volt action
+typedef struct {
+    uint64_t at;
+    uint64_t until;
+    float from;
+    float to;
+} SimSegment;
+
+typedef struct {
+    SimSegment *segments;
+    uint32_t count;
+    uint32_t current;
+} SimWave;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static const SimEcu *const SIM_ptrEcu[SIM_ECUS] = {&SIM_stMaster, &SIM_stSlave};
+static SimNode SIM_stNode[SIM_ECUS];
+static SimWave SIM_stTemp;
+static SimWave SIM_stVolt;
+static uint64_t SIM_ui64Barrier = 0;                   // Time of the next scenario action
+static uint64_t SIM_ui64FramesById[SIM_CAN_IDS];
+static uint64_t SIM_ui64Digest = SIM_FNV_OFFSET;
+static uint32_t SIM_ui32Expectations = 0;
+static uint32_t SIM_ui32Failures = 0;
+static bool SIM_boolVerbose = false;
+
+static const char *const SIM_ptrLedNames[SIM_LEDS] = {"red", "blue", "green"};
+static const char *const SIM_ptrLedStates[] = {"off", "on", "blink"};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void SIM_voidDigest(uint64_t a_ui64At, uint32_t a_ui32Ecu, uint32_t a_ui32Kind, uint32_t a_ui32Value)
+{
+    uint32_t ui32Words[5] = {(uint32_t)a_ui64At, (uint32_t)(a_ui64At >> 32), a_ui32Ecu, a_ui32Kind, a_ui32Value};
+    const uint8_t *ptrByte = (const uint8_t *)ui32Words;
+    uint32_t i = 0;
+
+    for (i = 0; i < sizeof(ui32Words); i++) {
+        SIM_ui64Digest = (SIM_ui64Digest ^ ptrByte[i]) * SIM_FNV_PRIME;
+    }
+}
+
+static void SIM_voidLog(uint32_t a_ui32Ecu, uint64_t a_ui64At, const char *a_ptrText)
+{
+    char chTime[16];
+
+    SIM_voidFormatTime(a_ui64At, chTime, sizeof(chTime));
+    printf("[%s] %-7s %s\n", chTime, SIM_ptrEcu[a_ui32Ecu]->name, a_ptrText);
+}
+
+/***********************************************
+ * Function Name: SIM_ui64Progress
+ * Inputs: uint32_t a_ui32Ecu - ECU
+ * Outputs: uint64_t - Time up to which the ECU can no longer do anything the others could see
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Its clock if it stopped at its horizon, its next event if it sleeps, FAKE_NEVER once halted.
+ ***********************************************/
+static uint64_t SIM_ui64Progress(uint32_t a_ui32Ecu)
+{
+    switch (SIM_stNode[a_ui32Ecu].state) {
+    case SIM_RUNNING:
+        return SIM_ptrEcu[a_ui32Ecu]->now();
+    case SIM_ASLEEP:
+        return SIM_ptrEcu[a_ui32Ecu]->nextEvent();
+    default:
+        return FAKE_NEVER;
+    }
+}
+
+// Both ECUs hear each other
+static bool SIM_boolShared(uint32_t a_ui32Ecu, uint32_t a_ui32Other)
+{
+    return (a_ui32Ecu == a_ui32Other) || (SIM_stNode[a_ui32Ecu].connected && SIM_stNode[a_ui32Other].connected);
+}
+
+/***********************************************
+ * Function Name: SIM_ui64Arbitration
+ * Inputs: uint32_t a_ui32Ecu - ECU
+ * Outputs: uint64_t - Time of the next arbitration on its segment, FAKE_NEVER if no frame waits
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: The earliest request, once the bus is idle.
+ ***********************************************/
+static uint64_t SIM_ui64Arbitration(uint32_t a_ui32Ecu)
+{
+    uint64_t ui64First = FAKE_NEVER;
+    uint32_t i = 0;
+
+    for (i = 0; i < SIM_ECUS; i++) {
+        if (SIM_boolShared(a_ui32Ecu, i) && SIM_stNode[i].request && (SIM_stNode[i].state != SIM_HALTED) &&
+            (SIM_stNode[i].requestAt < ui64First)) {
+            ui64First = SIM_stNode[i].requestAt;
+        }
+    }
+    if (ui64First == FAKE_NEVER) {
+        return FAKE_NEVER;
+    }
+    return (ui64First > SIM_stNode[a_ui32Ecu].busFree) ? ui64First : SIM_stNode[a_ui32Ecu].busFree;
+}
+
+/***********************************************
+ * Function Name: SIM_ui64Horizon
+ * Inputs: uint32_t a_ui32Ecu - ECU about to run
+ * Outputs: uint64_t - Time it may run to
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Nothing can reach the ECU before the next scenario action, before a frame of the other ECU could
+ *              end (the other starts it at its progress at the earliest), nor before a frame arbitrated on its
+ *              segment could end.
+ ***********************************************/
+static uint64_t SIM_ui64Horizon(uint32_t a_ui32Ecu)
+{
+    uint64_t ui64Horizon = SIM_ui64Barrier;
+    uint64_t ui64At = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < SIM_ECUS; i++) {
+        if ((i != a_ui32Ecu) && SIM_boolShared(a_ui32Ecu, i) && (SIM_stNode[i].state != SIM_HALTED)) {
+            ui64At = SIM_ui64Progress(i);
+            if ((ui64At != FAKE_NEVER) && ((ui64At + SIM_LOOKAHEAD) < ui64Horizon)) {
+                ui64Horizon = ui64At + SIM_LOOKAHEAD;
+            }
+        }
+    }
+    ui64At = SIM_ui64Arbitration(a_ui32Ecu);
+    if ((ui64At != FAKE_NEVER) && ((ui64At + SIM_LOOKAHEAD) < ui64Horizon)) {
+        ui64Horizon = ui64At + SIM_LOOKAHEAD;
+    }
+    return ui64Horizon;
+}
+
+static void SIM_voidPost(uint32_t a_ui32Ecu, SimInput *a_ptrInput)
+{
+    if (SIM_stNode[a_ui32Ecu].state != SIM_HALTED) {
+        SIM_ptrEcu[a_ui32Ecu]->post(a_ptrInput);
+    }
+}
+
+/***********************************************
+ * Function Name: SIM_boolArbitrate
+ * Inputs: uint32_t a_ui32Ecu - ECU whose segment is arbitrated
+ *         uint64_t a_ui64Limit - Arbitrations from this time on wait for the scenario action due then
+ * Outputs: bool - true if a frame was started or a request found withdrawn
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Decides the next arbitration on the segment once every node of it has reached its time: the
+ *              frame with the lowest identifier wins, a data frame before a remote frame of the same identifier.
+ *              Its end is posted to the sender and the frame to the nodes on the bus.
+ ***********************************************/
+static bool SIM_boolArbitrate(uint32_t a_ui32Ecu, uint64_t a_ui64Limit)
+{
+    uint64_t ui64At = SIM_ui64Arbitration(a_ui32Ecu);
+    uint64_t ui64End = 0;
+    uint32_t ui32Winner = SIM_ECUS;
+    uint32_t ui32Key = 0;
+    uint32_t ui32Best = 0;
+    FAKE_CanFrame stFrame;
+    SimInput stInput;
+    uint32_t i = 0;
+    bool boolWithdrawn = false;
+
+    if ((ui64At == FAKE_NEVER) || (ui64At >= a_ui64Limit)) {
+        return false;
+    }
+    for (i = 0; i < SIM_ECUS; i++) {
+        if (SIM_boolShared(a_ui32Ecu, i) && (SIM_ui64Progress(i) < ui64At)) {
+            return false;
+        }
+    }
+
+    for (i = 0; i < SIM_ECUS; i++) {
+        if (!SIM_boolShared(a_ui32Ecu, i) || !SIM_stNode[i].request || (SIM_stNode[i].state == SIM_HALTED)) {
+            continue;
+        }
+        if (!SIM_ptrEcu[i]->canPeekTx(&stFrame)) {
+            SIM_stNode[i].request = false;
+            boolWithdrawn = true;
+            continue;
+        }
+        ui32Key = (stFrame.id << 1) | (stFrame.remote ? 1U : 0U);
+        if ((SIM_stNode[i].requestAt <= ui64At) && ((ui32Winner == SIM_ECUS) || (ui32Key < ui32Best))) {
+            ui32Winner = i;
+            ui32Best = ui32Key;
+        }
+    }
+    if (ui32Winner == SIM_ECUS) {
+        return boolWithdrawn;
+    }
+
+    (void)SIM_ptrEcu[ui32Winner]->canStartTx(&stFrame);
+    ui64End = ui64At + ((uint64_t)SIM_CAN_FRAME_BITS + (stFrame.remote ? 0U : (8U * stFrame.length))) *
+                       SIM_CAN_BIT_CYCLES;
+    memset(&stInput, 0, sizeof(stInput));
+    stInput.at = ui64End;
+    stInput.kind = SIM_IN_CAN_RX;
+    stInput.frame = stFrame;
+    for (i = 0; i < SIM_ECUS; i++) {
+        if ((i != ui32Winner) && SIM_boolShared(a_ui32Ecu, i) && (SIM_stNode[i].state != SIM_HALTED) &&
+            SIM_ptrEcu[i]->canOnBus()) {
+            SIM_voidPost(i, &stInput);
+            stInput.acked = true;
+        }
+        if (SIM_boolShared(a_ui32Ecu, i)) {
+            SIM_stNode[i].busFree = ui64End + ((uint64_t)SIM_CAN_IFS_BITS * SIM_CAN_BIT_CYCLES);
+        }
+    }
+    stInput.kind = SIM_IN_CAN_TX_DONE;
+    SIM_voidPost(ui32Winner, &stInput);
+
+    SIM_stNode[ui32Winner].frames++;
+    if (!stInput.acked) {
+        SIM_stNode[ui32Winner].nacks++;
+    }
+    SIM_ui64FramesById[stFrame.id & (SIM_CAN_IDS - 1U)]++;
+    SIM_voidDigest(ui64At, ui32Winner, 0U, ui32Best | ((uint32_t)stFrame.length << 12) |
+                   ((uint32_t)stFrame.data[0] << 16) | ((uint32_t)stFrame.data[1] << 24));
+    return true;
+}
+
+/***********************************************
+ * Board of the ECUs (sim.h)
+ ***********************************************/
+
+// A frame waits in the controller of the running ECU
+uint64_t SIM_ui64CanRequest(uint32_t a_ui32Ecu, uint64_t a_ui64At)
+{
+    SimNode *ptrNode = &SIM_stNode[a_ui32Ecu];
+    uint64_t ui64Horizon = 0;
+
+    if (!ptrNode->request) {
+        ptrNode->request = true;
+        ptrNode->requestAt = a_ui64At;
+    }
+    ui64Horizon = SIM_ui64Horizon(a_ui32Ecu);
+    if (ui64Horizon < ptrNode->horizon) {
+        ptrNode->horizon = ui64Horizon;
+    }
+    return ptrNode->horizon;
+}
+
+void SIM_voidGpioOutput(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Port, uint8_t a_ui8Old, uint8_t a_ui8New)
+{
+    SimLed *ptrLed = 0;
+    char chText[32];
+    uint32_t i = 0;
+
+    if (a_ui32Port != GPIO_PORTF_BASE) {
+        return;
+    }
+    for (i = 0; i < SIM_LEDS; i++) {
+        if (((a_ui8Old ^ a_ui8New) >> (i + SIM_LED_FIRST_PIN)) & 1U) {
+            ptrLed = &SIM_stNode[a_ui32Ecu].led[i];
+            ptrLed->level = (uint8_t)((a_ui8New >> (i + SIM_LED_FIRST_PIN)) & 1U);
+            ptrLed->changes++;
+            ptrLed->changed[1] = ptrLed->changed[0];
+            ptrLed->changed[0] = a_ui64At;
+            SIM_stNode[a_ui32Ecu].ledChanges++;
+            SIM_voidDigest(a_ui64At, a_ui32Ecu, 1U, (i << 1) | ptrLed->level);
+            if (SIM_boolVerbose) {
+                snprintf(chText, sizeof(chText), "led %s %s", SIM_ptrLedNames[i], ptrLed->level ? "on" : "off");
+                SIM_voidLog(a_ui32Ecu, a_ui64At, chText);
+            }
+        }
+    }
+}
+
+void SIM_voidUartTransmit(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Base, uint8_t a_ui8Char)
+{
+    SimNode *ptrNode = &SIM_stNode[a_ui32Ecu];
+
+    if (a_ui32Base != UART0_BASE) {
+        return;
+    }
+    ptrNode->chars++;
+    SIM_voidDigest(a_ui64At, a_ui32Ecu, 2U, a_ui8Char);
+    if (ptrNode->uartLength == SIM_UART_CAPTURE) {
+        ptrNode->uartLength = SIM_UART_CAPTURE / 2U;
+        memmove(ptrNode->uart, &ptrNode->uart[SIM_UART_CAPTURE / 2U], ptrNode->uartLength);
+    }
+    ptrNode->uart[ptrNode->uartLength++] = (char)a_ui8Char;
+    ptrNode->uart[ptrNode->uartLength] = '\0';
+
+    if (!SIM_boolVerbose || (a_ui8Char == '\r')) {
+        return;
+    }
+    if ((a_ui8Char == '\n') || (ptrNode->lineLength == SIM_UART_LINE)) {
+        ptrNode->line[ptrNode->lineLength] = '\0';
+        if (ptrNode->lineLength > 0U) {
+            SIM_voidLog(a_ui32Ecu, a_ui64At, ptrNode->line);
+        }
+        ptrNode->lineLength = 0;
+    }
+    if (a_ui8Char != '\n') {
+        ptrNode->line[ptrNode->lineLength++] = (char)a_ui8Char;
+    }
+}
+
+/***********************************************
+ * Function Name: SIM_fWave
+ * Inputs: SimWave *a_ptrWave - Waveform
+ *         uint64_t a_ui64At - Time, not before the previous one asked
+ * Outputs: float - Value
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static float SIM_fWave(SimWave *a_ptrWave, uint64_t a_ui64At)
+{
+    const SimSegment *ptrSegment = 0;
+
+    while (((a_ptrWave->current + 1U) < a_ptrWave->count) &&
+           (a_ptrWave->segments[a_ptrWave->current + 1U].at <= a_ui64At)) {
+        a_ptrWave->current++;
+    }
+    ptrSegment = &a_ptrWave->segments[a_ptrWave->current];
+    if (a_ui64At >= ptrSegment->until) {
+        return ptrSegment->to;
+    }
+    return ptrSegment->from + ((ptrSegment->to - ptrSegment->from) *
+                               (float)(a_ui64At - ptrSegment->at) / (float)(ptrSegment->until - ptrSegment->at));
+}
+
+static uint32_t SIM_ui32AdcCode(float a_fValue, float a_fFullScale)
+{
+    float fCode = (a_fValue / a_fFullScale) * (float)SIM_ADC_MAX + 0.5f;
+
+    if (fCode <= 0.0f) {
+        return 0;
+    }
+    return (fCode >= (float)SIM_ADC_MAX) ? SIM_ADC_MAX : (uint32_t)fCode;
+}
+
+// Slave_: temperature sensor on ADC0, known voltage on ADC1; nothing else is wired
+uint32_t SIM_ui32AdcSample(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Base, uint32_t a_ui32Channel)
+{
+    (void)a_ui32Channel;
+    if (a_ui32Ecu != SIM_SLAVE) {
+        return 0;
+    }
+    if (a_ui32Base == ADC0_BASE) {
+        return SIM_ui32AdcCode(SIM_fWave(&SIM_stTemp, a_ui64At), SIM_TEMP_FULL_SCALE);
+    }
+    if (a_ui32Base == ADC1_BASE) {
+        return SIM_ui32AdcCode(SIM_fWave(&SIM_stVolt, a_ui64At), SIM_VOLT_FULL_SCALE);
+    }
+    return 0;
+}
+
+void SIM_voidReset(uint32_t a_ui32Ecu, uint64_t a_ui64At, const char *a_ptrCause)
+{
+    char chText[64];
+
+    SIM_stNode[a_ui32Ecu].resets++;
+    SIM_voidDigest(a_ui64At, a_ui32Ecu, 3U, SIM_stNode[a_ui32Ecu].resets);
+    snprintf(chText, sizeof(chText), "reset: %s, halted", a_ptrCause);
+    SIM_voidLog(a_ui32Ecu, a_ui64At, chText);
+}
+
+/***********************************************
+ * Scenario
+ ***********************************************/
+
+/***********************************************
+ * Function Name: SIM_voidBuildWave
+ * Inputs: SimWave *a_ptrWave - Waveform to build
+ *         SimActionKind a_enumKind - SIM_ACT_TEMP or SIM_ACT_VOLT
+ *         float a_fStart - Value at power-on
+ *         const SimAction *a_ptrActions - Scenario
+ *         uint32_t a_ui32Count - Number of actions
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Each action starts a segment from the value the waveform has at its time.
+ ***********************************************/
+static void SIM_voidBuildWave(SimWave *a_ptrWave, SimActionKind a_enumKind, float a_fStart,
+                              const SimAction *a_ptrActions, uint32_t a_ui32Count)
+{
+    SimSegment *ptrSegment = 0;
+    uint32_t i = 0;
+
+    a_ptrWave->segments = malloc((a_ui32Count + 1U) * sizeof(SimSegment));
+    if (a_ptrWave->segments == 0) {
+        fprintf(stderr, "sim: out of memory\n");
+        exit(2);
+    }
+    a_ptrWave->segments[0].at = 0;
+    a_ptrWave->segments[0].until = 0;
+    a_ptrWave->segments[0].from = a_fStart;
+    a_ptrWave->segments[0].to = a_fStart;
+    a_ptrWave->count = 1U;
+    a_ptrWave->current = 0;
+    for (i = 0; i < a_ui32Count; i++) {
+        if (a_ptrActions[i].kind == a_enumKind) {
+            ptrSegment = &a_ptrWave->segments[a_ptrWave->count];
+            ptrSegment->at = a_ptrActions[i].at;
+            ptrSegment->until = a_ptrActions[i].at + ((uint64_t)a_ptrActions[i].rampMs * SIM_MS);
+            ptrSegment->from = SIM_fWave(a_ptrWave, a_ptrActions[i].at);
+            ptrSegment->to = a_ptrActions[i].value;
+            a_ptrWave->count++;
+        }
+    }
+    a_ptrWave->current = 0;
+}
+
+// State of one LED at the time of the expectation
+static SimLedState SIM_enumLedState(const SimLed *a_ptrLed, uint64_t a_ui64At)
+{
+    if ((a_ptrLed->changes >= 2U) && ((a_ptrLed->changed[1] + SIM_BLINK_WINDOW) >= a_ui64At)) {
+        return SIM_LED_BLINK;
+    }
+    return (a_ptrLed->level != 0U) ? SIM_LED_ON : SIM_LED_OFF;
+}
+
+/***********************************************
+ * Function Name: SIM_boolExpect
+ * Inputs: SimAction *a_ptrAction - Expectation due now
+ *         char *a_ptrActual - Receives what was found instead
+ *         uint32_t a_ui32Length - Size of a_ptrActual
+ * Outputs: bool - true if it holds
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static bool SIM_boolExpect(const SimAction *a_ptrAction, char *a_ptrActual, uint32_t a_ui32Length)
+{
+    SimNode *ptrNode = &SIM_stNode[a_ptrAction->ecu];
+    const uint8_t *ptrEeprom = 0;
+    SimLedState enumState = SIM_LED_OFF;
+    uint32_t ui32Word = 0;
+    uint32_t ui32Used = 0;
+    uint32_t i = 0;
+    bool boolHolds = true;
+
+    a_ptrActual[0] = '\0';
+    switch (a_ptrAction->kind) {
+    case SIM_ACT_EXPECT_LED:
+        for (i = 0; i < SIM_LEDS; i++) {
+            enumState = SIM_enumLedState(&ptrNode->led[i], a_ptrAction->at);
+            ui32Used += (uint32_t)snprintf(&a_ptrActual[ui32Used], a_ui32Length - ui32Used, "%s%s %s",
+                                           (i == 0U) ? "" : ", ", SIM_ptrLedNames[i], SIM_ptrLedStates[enumState]);
+            if (((a_ptrAction->pins >> (i + SIM_LED_FIRST_PIN)) & 1U) && (enumState != a_ptrAction->state)) {
+                boolHolds = false;
+            }
+        }
+        return boolHolds;
+    case SIM_ACT_EXPECT_UART:
+        boolHolds = strstr(ptrNode->uart, a_ptrAction->text) != 0;
+        if (!boolHolds) {
+            snprintf(a_ptrActual, a_ui32Length, "last: \"%s\"",
+                     &ptrNode->uart[(ptrNode->uartLength > 60U) ? (ptrNode->uartLength - 60U) : 0U]);
+        }
+        ptrNode->uartLength = 0;
+        ptrNode->uart[0] = '\0';
+        return boolHolds;
+    case SIM_ACT_EXPECT_EEPROM:
+        ptrEeprom = SIM_ptrEcu[a_ptrAction->ecu]->eeprom() + a_ptrAction->address;
+        ui32Word = (uint32_t)ptrEeprom[0] | ((uint32_t)ptrEeprom[1] << 8) | ((uint32_t)ptrEeprom[2] << 16) |
+                   ((uint32_t)ptrEeprom[3] << 24);
+        snprintf(a_ptrActual, a_ui32Length, "0x%08X", (unsigned)ui32Word);
+        return ui32Word == a_ptrAction->word;
+    case SIM_ACT_EXPECT_RESETS:
+        snprintf(a_ptrActual, a_ui32Length, "%u", (unsigned)ptrNode->resets);
+        return ptrNode->resets == a_ptrAction->word;
+    default:
+        return true;
+    }
+}
+
+/***********************************************
+ * Function Name: SIM_boolAction
+ * Inputs: const SimAction *a_ptrAction - Action due now; every ECU has reached its time
+ * Outputs: bool - true at the end of the scenario
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Posts the inputs of the action, or checks the expectation.
+ ***********************************************/
+static bool SIM_boolAction(const SimAction *a_ptrAction)
+{
+    char chActual[128];
+    char chTime[16];
+    SimInput stInput;
+    uint32_t i = 0;
+    bool boolHolds = true;
+
+    memset(&stInput, 0, sizeof(stInput));
+    stInput.at = a_ptrAction->at;
+    switch (a_ptrAction->kind) {
+    case SIM_ACT_PRESS:
+        stInput.kind = SIM_IN_GPIO;
+        stInput.pins = a_ptrAction->pins;
+        SIM_voidPost(a_ptrAction->ecu, &stInput);
+        stInput.at += (uint64_t)a_ptrAction->holdMs * SIM_MS;
+        stInput.level = a_ptrAction->pins;
+        SIM_voidPost(a_ptrAction->ecu, &stInput);
+        break;
+    case SIM_ACT_UART:
+        stInput.kind = SIM_IN_UART;
+        for (i = 0; a_ptrAction->text[i] != '\0'; i++) {
+            stInput.character = (uint8_t)a_ptrAction->text[i];
+            SIM_voidPost(a_ptrAction->ecu, &stInput);
+            stInput.at += SIM_UART_CHAR_CYCLES;
+        }
+        break;
+    case SIM_ACT_DISCONNECT:
+        SIM_stNode[a_ptrAction->ecu].connected = false;
+        break;
+    case SIM_ACT_CONNECT:
+        SIM_stNode[a_ptrAction->ecu].connected = true;
+        for (i = 0; i < SIM_ECUS; i++) {
+            if (SIM_stNode[i].connected && (SIM_stNode[i].busFree > SIM_stNode[a_ptrAction->ecu].busFree)) {
+                SIM_stNode[a_ptrAction->ecu].busFree = SIM_stNode[i].busFree;
+            }
+        }
+        for (i = 0; i < SIM_ECUS; i++) {
+            if (SIM_stNode[i].connected) {
+                SIM_stNode[i].busFree = SIM_stNode[a_ptrAction->ecu].busFree;
+            }
+        }
+        break;
+    case SIM_ACT_BUS_OFF:
+        stInput.kind = SIM_IN_CAN_BUS_OFF;
+        SIM_voidPost(a_ptrAction->ecu, &stInput);
+        break;
+    case SIM_ACT_EXPECT_LED:
+    case SIM_ACT_EXPECT_UART:
+    case SIM_ACT_EXPECT_EEPROM:
+    case SIM_ACT_EXPECT_RESETS:
+        boolHolds = SIM_boolExpect(a_ptrAction, chActual, sizeof(chActual));
+        SIM_ui32Expectations++;
+        if (!boolHolds) {
+            SIM_ui32Failures++;
+            SIM_voidFormatTime(a_ptrAction->at, chTime, sizeof(chTime));
+            printf("[%s] %-7s line %u: expectation failed, got %s\n", chTime, SIM_ptrEcu[a_ptrAction->ecu]->name,
+                   (unsigned)a_ptrAction->line, chActual);
+        }
+        break;
+    case SIM_ACT_END:
+        return true;
+    default:
+        break;
+    }
+    return false;
+}
+
+/***********************************************
+ * Function Name: SIM_voidRun
+ * Inputs: const SimAction *a_ptrActions - Scenario, ending with SIM_ACT_END
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Until the end of the scenario: decides the arbitrations both ECUs have reached, takes the next
+ *              action once both have reached its time, else runs the ECU that is behind up to its horizon.
+ ***********************************************/
+static void SIM_voidRun(const SimAction *a_ptrActions)
+{
+    const SimAction *ptrAction = a_ptrActions;
+    uint64_t ui64Behind = 0;
+    uint64_t ui64At = 0;
+    uint32_t ui32Ecu = 0;
+    uint32_t i = 0;
+    bool boolDecided = true;
+
+    while (1) {
+        SIM_ui64Barrier = ptrAction->at;
+        do {
+            boolDecided = false;
+            for (i = 0; i < SIM_ECUS; i++) {
+                boolDecided = SIM_boolArbitrate(i, SIM_ui64Barrier) || boolDecided;
+            }
+        } while (boolDecided);
+
+        ui64Behind = FAKE_NEVER;
+        for (i = 0; i < SIM_ECUS; i++) {
+            ui64At = SIM_ui64Progress(i);
+            if (ui64At < ui64Behind) {
+                ui64Behind = ui64At;
+                ui32Ecu = i;
+            }
+        }
+        if (ui64Behind >= SIM_ui64Barrier) {
+            if (SIM_boolAction(ptrAction)) {
+                return;
+            }
+            ptrAction++;
+            continue;
+        }
+        SIM_stNode[ui32Ecu].horizon = SIM_ui64Horizon(ui32Ecu);
+        SIM_stNode[ui32Ecu].state = SIM_ptrEcu[ui32Ecu]->run(SIM_stNode[ui32Ecu].horizon);
+        SIM_stNode[ui32Ecu].runs++;
+    }
+}
+
+static void SIM_voidReport(const char *a_ptrScenario, uint64_t a_ui64End)
+{
+    const SimNode *ptrNode = 0;
+    char chTime[16];
+    uint32_t ui32Ids = 0;
+    uint32_t i = 0;
+
+    SIM_voidFormatTime(a_ui64End, chTime, sizeof(chTime));
+    printf("== %s: %s simulated\n", a_ptrScenario, chTime);
+    for (i = 0; i < SIM_ECUS; i++) {
+        ptrNode = &SIM_stNode[i];
+        printf("%-7s %llu frames sent (%llu not acknowledged), %llu UART characters, %llu LED changes, %u resets\n",
+               SIM_ptrEcu[i]->name, (unsigned long long)ptrNode->frames, (unsigned long long)ptrNode->nacks,
+               (unsigned long long)ptrNode->chars, (unsigned long long)ptrNode->ledChanges,
+               (unsigned)ptrNode->resets);
+    }
+    printf("frames by id:");
+    for (i = 0; i < SIM_CAN_IDS; i++) {
+        if (SIM_ui64FramesById[i] != 0U) {
+            printf("%s 0x%03X %llu", ((ui32Ids % 6U) == 0U) ? "\n   " : ",", (unsigned)i,
+                   (unsigned long long)SIM_ui64FramesById[i]);
+            ui32Ids++;
+        }
+    }
+    printf("\ndigest %016llx\n", (unsigned long long)SIM_ui64Digest);
+    printf("%u expectations, %u failed\n", (unsigned)SIM_ui32Expectations, (unsigned)SIM_ui32Failures);
+}
+
+int main(int argc, char **argv)
+{
+    SimAction *ptrActions = 0;
+    uint32_t ui32Count = 0;
+    const char *ptrScenario = 0;
+    struct timespec stStart;
+    struct timespec stStop;
+    double dWall = 0;
+    double dSimulated = 0;
+    uint32_t i = 0;
+
+    if ((argc == 3) && (strcmp(argv[1], "-v") == 0)) {
+        SIM_boolVerbose = true;
+        ptrScenario = argv[2];
+    } else if (argc == 2) {
+        ptrScenario = argv[1];
+    } else {
+        fprintf(stderr, "usage: sim [-v] <scenario>\n");
+        return 2;
+    }
+    if (!SIM_boolLoadScenario(ptrScenario, &ptrActions, &ui32Count)) {
+        return 2;
+    }
+    SIM_voidBuildWave(&SIM_stTemp, SIM_ACT_TEMP, SIM_TEMP_START, ptrActions, ui32Count);
+    SIM_voidBuildWave(&SIM_stVolt, SIM_ACT_VOLT, SIM_VOLT_START, ptrActions, ui32Count);
+
+    for (i = 0; i < SIM_ECUS; i++) {
+        SIM_stNode[i].connected = true;
+        SIM_stNode[i].state = SIM_RUNNING;
+        SIM_ptrEcu[i]->powerOn(i);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stStart);
+    SIM_voidRun(ptrActions);
+    clock_gettime(CLOCK_MONOTONIC, &stStop);
+
+    SIM_voidReport(ptrScenario, ptrActions[ui32Count - 1U].at);
+    dWall = (double)(stStop.tv_sec - stStart.tv_sec) + ((double)(stStop.tv_nsec - stStart.tv_nsec) / 1e9);
+    dSimulated = (double)ptrActions[ui32Count - 1U].at / (double)FAKE_CPU_HZ;
+    fprintf(stderr, "sim: %.0f s simulated in %.1f s (%.0fx), %llu + %llu runs\n", dSimulated, dWall,
+            (dWall > 0) ? (dSimulated / dWall) : 0.0, (unsigned long long)SIM_stNode[SIM_MASTER].runs,
+            (unsigned long long)SIM_stNode[SIM_SLAVE].runs);
+    free(ptrActions);
+    return (SIM_ui32Failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/*
+ * sim.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Interface between the two-ECU simulator (sim.c, sim_scenario.c) and the ECU port (sim_ecu.c).
+ *                  An ECU image is the firmware of Master_ or Slave_, the fake MCU (test/fake) and the port, linked
+ *                  into one relocatable object that exports only its SimEcu (SIM_stMaster, SIM_stSlave): the two
+ *                  firmwares and their fakes keep their own globals in one process.
+ *               2) The port runs the firmware's main() on a stack of its own. It returns to the simulator when the
+ *                  ECU reaches the horizon the simulator gave it, or when it would sleep past it; everything that
+ *                  reaches the ECU from outside is posted to its inbox and applied on the ECU's own clock.
+ *               3) The board hooks of the fake (fake.h) forward to the SIM_ functions below with the ECU index.
+ *               4) The scenario: timed inputs (ADC waveforms, buttons, tester characters, bus faults) and timed
+ *                  expectations (LEDs, UART text, EEPROM words, resets), read from a text file by sim_scenario.c.
+ *
+ *      Usage rules:
+ *               - All times are in CPU cycles of the simulated 50 MHz clock, from power-on of both ECUs.
+ *               - An input is posted no earlier than the time the ECU has reached; the simulator guarantees it by
+ *                  never letting an ECU run past the earliest time something could still reach it.
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fake.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define SIM_ECUS                2U
+#define SIM_MASTER              0U
+#define SIM_SLAVE               1U
+
+#define SIM_MS                  (FAKE_CPU_HZ / 1000U)               // Cycles per millisecond
+#define SIM_S                   ((uint64_t)FAKE_CPU_HZ)             // Cycles per second
+
+#define SIM_TEXT_LEN            96U                                 // Tester input or expected UART text
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef enum {
+    SIM_RUNNING = 0,            // Stopped at its horizon, in the middle of its work
+    SIM_ASLEEP,                 // In WFI, nothing to do before its next event
+    SIM_HALTED                  // Reset by the watchdog: an image cannot be restarted in the same process
+} SimState;
+
+// What the world does to an ECU, applied by the port at the time given
+typedef enum {
+    SIM_IN_CAN_RX = 0,          // A frame of the other node ended on the bus
+    SIM_IN_CAN_TX_DONE,         // The frame this node started ended, acknowledged or not
+    SIM_IN_CAN_BUS_OFF,         // A burst of bit errors drives the controller bus-off
+    SIM_IN_GPIO,                // Input pins change level
+    SIM_IN_UART                 // A character arrives on UART0
+} SimInputKind;
+
+typedef struct {
+    uint64_t at;
+    SimInputKind kind;
+    bool acked;                 // SIM_IN_CAN_TX_DONE
+    uint8_t pins;               // SIM_IN_GPIO: pins of Port F driven
+    uint8_t level;              // SIM_IN_GPIO: their level
+    uint8_t character;          // SIM_IN_UART
+    FAKE_CanFrame frame;        // SIM_IN_CAN_RX
+} SimInput;
+
+// Exported by each ECU image
+typedef struct {
+    const char *name;
+    void (*powerOn)(uint32_t a_ui32Index);
+    SimState (*run)(uint64_t a_ui64Horizon);
+    uint64_t (*now)(void);
+    uint64_t (*nextEvent)(void);                    // Earliest event of the ECU itself, FAKE_NEVER if none
+    void (*post)(const SimInput *a_ptrInput);
+    bool (*canPeekTx)(FAKE_CanFrame *a_ptrFrame);
+    bool (*canStartTx)(FAKE_CanFrame *a_ptrFrame);
+    bool (*canOnBus)(void);
+    uint8_t *(*eeprom)(void);
+} SimEcu;
+
+// Scenario
+typedef enum {
+    SIM_ACT_TEMP = 0,           // Slave temperature sensor (ADC0): value, reached over rampMs
+    SIM_ACT_VOLT,               // Slave known voltage (ADC1): value, reached over rampMs
+    SIM_ACT_PRESS,              // Hold buttons (pins) for holdMs
+    SIM_ACT_UART,               // Send text to the tester UART, one character time apart
+    SIM_ACT_DISCONNECT,         // Unplug the ECU from the bus
+    SIM_ACT_CONNECT,            // Plug it back
+    SIM_ACT_BUS_OFF,            // Drive its controller bus-off
+    SIM_ACT_EXPECT_LED,         // LED pins are steady on, steady off or blinking (state)
+    SIM_ACT_EXPECT_UART,        // text was sent since the previous UART expectation of the ECU
+    SIM_ACT_EXPECT_EEPROM,      // The EEPROM word at address holds value
+    SIM_ACT_EXPECT_RESETS,      // The ECU was reset value times
+    SIM_ACT_END                 // Stop the run
+} SimActionKind;
+
+typedef enum {
+    SIM_LED_OFF = 0,
+    SIM_LED_ON,
+    SIM_LED_BLINK
+} SimLedState;
+
+typedef struct {
+    uint64_t at;
+    uint32_t line;              // In the scenario file
+    SimActionKind kind;
+    uint32_t ecu;
+    uint8_t pins;
+    SimLedState state;
+    float value;
+    uint32_t rampMs;
+    uint32_t holdMs;
+    uint32_t address;
+    uint32_t word;
+    char text[SIM_TEXT_LEN];
+} SimAction;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+extern const SimEcu SIM_stMaster;
+extern const SimEcu SIM_stSlave;
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+// Simulator, called by the ports
+uint64_t SIM_ui64CanRequest(uint32_t a_ui32Ecu, uint64_t a_ui64At);
+void SIM_voidGpioOutput(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Port, uint8_t a_ui8Old, uint8_t a_ui8New);
+void SIM_voidUartTransmit(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Base, uint8_t a_ui8Char);
+uint32_t SIM_ui32AdcSample(uint32_t a_ui32Ecu, uint64_t a_ui64At, uint32_t a_ui32Base, uint32_t a_ui32Channel);
+void SIM_voidReset(uint32_t a_ui32Ecu, uint64_t a_ui64At, const char *a_ptrCause);
+
+// Scenario file
+bool SIM_boolLoadScenario(const char *a_ptrPath, SimAction **a_pptrActions, uint32_t *a_ptrCount);
+void SIM_voidFormatTime(uint64_t a_ui64At, char *a_ptrText, uint32_t a_ui32Length);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,336 @@
+/*
+ * sim_ecu.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) ECU port of the simulator, compiled once per ECU image with SIM_PORT and SIM_NAME: runs the
+ *                  firmware's main() on a stack of its own and implements the board hooks of the fake.
+ *               2) The horizon: a fake timer at the time the simulator allowed the ECU to reach. When it fires, the
+ *                  ECU stops mid-work and the simulator gets control back; when the ECU would sleep past it, it
+ *                  stops in WFI instead, so the other ECU can run to the time of its next event.
+ *               3) The inbox: inputs posted by the simulator, kept in time order and applied by a fake timer, so a
+ *                  CAN frame or a key press reaches the firmware at the cycle it happens and preempts it as the
+ *                  interrupt would on the target.
+ *               4) The stack monitor port, as in test/unit/board.c: the host stack is not the painted system stack.
+ *
+ *      Usage rules:
+ *               - The simulator calls run, post, canPeekTx, canStartTx and canOnBus only while the ECU is stopped;
+ *                  only run switches to the firmware.
+ *               - The firmware stack is started with makecontext; the switches are _setjmp/_longjmp, which unlike
+ *                  swapcontext leave the signal mask alone and make no system call. The image is built without
+ *                  _FORTIFY_SOURCE, whose checked longjmp refuses a jump to another stack.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <ucontext.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "sim.h"
+#include "OS/stackmon.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define SIM_STACK_BYTES         (256U * 1024U)                      // Firmware, its handlers and the fake
+#define SIM_INBOX_LEN           256U
+#define SIM_BUTTON_PINS         (GPIO_PIN_0 | GPIO_PIN_4)           // SW2 and SW1, pulled up: released is high
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static void SIM_voidHorizonReached(void);
+static void SIM_voidInboxDue(void);
+
+static uint32_t SIM_ui32Index = 0;
+static SimState SIM_enumState = SIM_RUNNING;
+static uint64_t SIM_ui64Horizon = 0;
+static FAKE_Timer SIM_stHorizon = {FAKE_NEVER, SIM_voidHorizonReached, 0, false};
+
+static ucontext_t SIM_stStart;
+static bool SIM_boolStarted = false;
+static jmp_buf SIM_stFirmware;
+static jmp_buf SIM_stSimulator;
+static uint8_t SIM_ui8Stack[SIM_STACK_BYTES] __attribute__((aligned(16)));
+
+static SimInput SIM_stInbox[SIM_INBOX_LEN];
+static uint32_t SIM_ui32InboxCount = 0;
+static FAKE_Timer SIM_stInboxTimer = {FAKE_NEVER, SIM_voidInboxDue, 0, false};
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+int main(void);
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: SIM_voidYield
+ * Inputs: SimState a_enumState - Why the ECU stops
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Hands control back to the simulator, and returns when it runs the ECU again. The SCS words shared
+ *              with the other image are saved and put back around it.
+ ***********************************************/
+static void SIM_voidYield(SimState a_enumState)
+{
+    SIM_enumState = a_enumState;
+    FAKE_voidSuspend();
+    if (_setjmp(SIM_stFirmware) == 0) {
+        _longjmp(SIM_stSimulator, 1);
+    }
+    FAKE_voidResume();
+}
+
+static void SIM_voidHorizonReached(void)
+{
+    SIM_voidYield(SIM_RUNNING);
+}
+
+/***********************************************
+ * Function Name: SIM_ui64OwnEvent
+ * Inputs: N/A
+ * Outputs: uint64_t - Earliest event of the MCU and the inbox, the horizon left out
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static uint64_t SIM_ui64OwnEvent(void)
+{
+    uint64_t ui64Horizon = SIM_stHorizon.at;
+    uint64_t ui64Next = 0;
+
+    FAKE_voidTimerSet(&SIM_stHorizon, FAKE_NEVER);
+    ui64Next = FAKE_ui64NextEvent();
+    FAKE_voidTimerSet(&SIM_stHorizon, ui64Horizon);
+    return ui64Next;
+}
+
+/***********************************************
+ * Function Name: SIM_voidApply
+ * Inputs: const SimInput *a_ptrInput - Input due now
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static void SIM_voidApply(const SimInput *a_ptrInput)
+{
+    switch (a_ptrInput->kind) {
+    case SIM_IN_CAN_RX:
+        FAKE_voidCanReceive(&a_ptrInput->frame);
+        break;
+    case SIM_IN_CAN_TX_DONE:
+        FAKE_voidCanTxDone(a_ptrInput->acked);
+        break;
+    case SIM_IN_CAN_BUS_OFF:
+        FAKE_voidCanBusOff();
+        break;
+    case SIM_IN_GPIO:
+        FAKE_voidGpioInput(GPIO_PORTF_BASE, a_ptrInput->pins, a_ptrInput->level);
+        break;
+    case SIM_IN_UART:
+        FAKE_voidUartReceive(UART0_BASE, a_ptrInput->character);
+        break;
+    default:
+        break;
+    }
+}
+
+static void SIM_voidInboxDue(void)
+{
+    SimInput stInput;
+
+    while ((SIM_ui32InboxCount > 0U) && (SIM_stInbox[0].at <= FAKE_ui64Now)) {
+        stInput = SIM_stInbox[0];
+        SIM_ui32InboxCount--;
+        memmove(&SIM_stInbox[0], &SIM_stInbox[1], SIM_ui32InboxCount * sizeof(SimInput));
+        SIM_voidApply(&stInput);
+    }
+    FAKE_voidTimerSet(&SIM_stInboxTimer, (SIM_ui32InboxCount > 0U) ? SIM_stInbox[0].at : FAKE_NEVER);
+}
+
+/***********************************************
+ * Function Name: SIM_voidPost
+ * Inputs: const SimInput *a_ptrInput - Input, not before the time the ECU has reached
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Queues the input after those due earlier or at the same time.
+ ***********************************************/
+static void SIM_voidPost(const SimInput *a_ptrInput)
+{
+    uint32_t i = SIM_ui32InboxCount;
+
+    if (SIM_ui32InboxCount >= SIM_INBOX_LEN) {
+        fprintf(stderr, "%s: inbox full\n", SIM_NAME);
+        abort();
+    }
+    if (a_ptrInput->at < FAKE_ui64Now) {
+        fprintf(stderr, "%s: input posted in the past of the ECU\n", SIM_NAME);
+        abort();
+    }
+    while ((i > 0U) && (SIM_stInbox[i - 1U].at > a_ptrInput->at)) {
+        SIM_stInbox[i] = SIM_stInbox[i - 1U];
+        i--;
+    }
+    SIM_stInbox[i] = *a_ptrInput;
+    SIM_ui32InboxCount++;
+    FAKE_voidTimerSet(&SIM_stInboxTimer, SIM_stInbox[0].at);
+}
+
+static void SIM_voidStart(void)
+{
+    FAKE_voidResume();
+    FAKE_voidGpioInput(GPIO_PORTF_BASE, SIM_BUTTON_PINS, SIM_BUTTON_PINS);
+    (void)main();
+    fprintf(stderr, "%s: main returned\n", SIM_NAME);
+    abort();
+}
+
+/***********************************************
+ * Function Name: SIM_voidPowerOn
+ * Inputs: uint32_t a_ui32Index - Index of the ECU in the simulator
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Prepares main() to start at cycle 0 on the first run. Called for both images before either runs,
+ *              while the SCS pages still hold their power-on values.
+ ***********************************************/
+static void SIM_voidPowerOn(uint32_t a_ui32Index)
+{
+    SIM_ui32Index = a_ui32Index;
+    FAKE_voidSuspend();
+    getcontext(&SIM_stStart);
+    SIM_stStart.uc_stack.ss_sp = SIM_ui8Stack;
+    SIM_stStart.uc_stack.ss_size = sizeof(SIM_ui8Stack);
+    SIM_stStart.uc_link = 0;
+    makecontext(&SIM_stStart, SIM_voidStart, 0);
+    SIM_boolStarted = false;
+    SIM_enumState = SIM_RUNNING;
+}
+
+/***********************************************
+ * Function Name: SIM_enumRun
+ * Inputs: uint64_t a_ui64Horizon - Time the ECU may reach, after the one it has reached
+ * Outputs: SimState - Where the ECU stopped
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static SimState SIM_enumRun(uint64_t a_ui64Horizon)
+{
+    if (SIM_enumState != SIM_HALTED) {
+        SIM_ui64Horizon = a_ui64Horizon;
+        FAKE_voidTimerSet(&SIM_stHorizon, a_ui64Horizon);
+        if (_setjmp(SIM_stSimulator) == 0) {
+            if (!SIM_boolStarted) {
+                SIM_boolStarted = true;
+                setcontext(&SIM_stStart);
+            }
+            _longjmp(SIM_stFirmware, 1);
+        }
+    }
+    return SIM_enumState;
+}
+
+static uint64_t SIM_ui64Now(void)
+{
+    return FAKE_ui64Now;
+}
+
+const SimEcu SIM_PORT = {
+    SIM_NAME, SIM_voidPowerOn, SIM_enumRun, SIM_ui64Now, SIM_ui64OwnEvent, SIM_voidPost,
+    FAKE_boolCanPeekTx, FAKE_boolCanStartTx, FAKE_boolCanOnBus, FAKE_pui8Eeprom
+};
+
+/***********************************************
+ * Board hooks (fake.h)
+ ***********************************************/
+void BOARD_voidPoll(void)
+{
+}
+
+// The MCU sleeps to its next event if the horizon allows it, else the ECU stops in WFI until the simulator lets
+// it reach that event or posts an earlier one
+uint64_t BOARD_ui64Sleep(uint64_t a_ui64Until)
+{
+    uint64_t ui64Wake = 0;
+
+    (void)a_ui64Until;
+    while (1) {
+        ui64Wake = SIM_ui64OwnEvent();
+        if (ui64Wake <= SIM_ui64Horizon) {
+            return ui64Wake;
+        }
+        SIM_voidYield(SIM_ASLEEP);
+    }
+}
+
+// A frame waits in the controller: the simulator may have to stop the ECU earlier to arbitrate it
+void BOARD_voidCanRequest(void)
+{
+    SIM_ui64Horizon = SIM_ui64CanRequest(SIM_ui32Index, FAKE_ui64Now);
+    FAKE_voidTimerSet(&SIM_stHorizon, SIM_ui64Horizon);
+}
+
+void BOARD_voidUartTransmit(uint32_t a_ui32Base, uint8_t a_ui8Char)
+{
+    SIM_voidUartTransmit(SIM_ui32Index, FAKE_ui64Now, a_ui32Base, a_ui8Char);
+}
+
+void BOARD_voidGpioOutput(uint32_t a_ui32Port, uint8_t a_ui8Old, uint8_t a_ui8New)
+{
+    SIM_voidGpioOutput(SIM_ui32Index, FAKE_ui64Now, a_ui32Port, a_ui8Old, a_ui8New);
+}
+
+uint32_t BOARD_ui32AdcSample(uint32_t a_ui32Base, uint32_t a_ui32Channel)
+{
+    return SIM_ui32AdcSample(SIM_ui32Index, FAKE_ui64Now, a_ui32Base, a_ui32Channel);
+}
+
+// The image cannot start over in the same process: the ECU stays halted
+void BOARD_voidReset(const char *a_ptrCause)
+{
+    SIM_voidReset(SIM_ui32Index, FAKE_ui64Now, a_ptrCause);
+    while (1) {
+        SIM_voidYield(SIM_HALTED);
+    }
+}
+
+/***********************************************
+ * OS/stackmon.h port
+ ***********************************************/
+void OS_voidStackPaint(void)
+{
+}
+
+uint32_t OS_ui32StackUsed(void)
+{
+    return 0;
+}
+
+uint32_t OS_ui32StackHighWater(void)
+{
+    return 0;
+}
+
+// No TI sections on the host: only the stack the firmware runs on here is known
+void OS_voidGetRamBudget(RamBudget *a_ptrBudget)
+{
+    memset(a_ptrBudget, 0, sizeof(*a_ptrBudget));
+    a_ptrBudget->stackBytes = SIM_STACK_BYTES;
+}
@@ -0,0 +1,401 @@
+/*
+ * sim_scenario.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Read a scenario file of the simulator into its list of timed actions.
+ *               2) One action per line, '#' starts a comment:
+ *                      <time> temp <degC> [ramp <s>]           Slave temperature sensor, stepped or ramped
+ *                      <time> volt <V> [ramp <s>]              Slave known voltage
+ *                      <time> press <ecu> left|right|both <ms> Hold buttons
+ *                      <time> uart <ecu> "<text>"              Tester input, \r \n \" \\ escapes
+ *                      <time> unplug <ecu>                     Disconnect from the bus
+ *                      <time> plug <ecu>                       Connect again
+ *                      <time> busoff <ecu>                     Drive the CAN controller bus-off
+ *                      <time> expect <ecu> led red|green|blue|white on|off|blink
+ *                      <time> expect <ecu> uart "<text>"       Sent since the previous uart expectation
+ *                      <time> expect <ecu> eeprom <address> <word>
+ *                      <time> expect <ecu> resets <n>
+ *                      <time> end
+ *                  <time> is hh:mm:ss[.mmm] from power-on, or +s[.mmm] after the previous action; <ecu> is master
+ *                  or slave. Times never go back and the file ends with end.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define SIM_LINE_LEN            256U
+#define SIM_TOKENS              8U
+
+#define SIM_LED_RED             0x02U                               // PF1
+#define SIM_LED_BLUE            0x04U                               // PF2
+#define SIM_LED_GREEN           0x08U                               // PF3
+#define SIM_BUTTON_RIGHT        0x01U                               // PF0, SW2
+#define SIM_BUTTON_LEFT         0x10U                               // PF4, SW1
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    const char *name;
+    uint32_t value;
+} SimName;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static const SimName SIM_stEcuNames[] = {
+    {"master", SIM_MASTER}, {"slave", SIM_SLAVE}, {0, 0}
+};
+static const SimName SIM_stLedNames[] = {
+    {"red", SIM_LED_RED}, {"green", SIM_LED_GREEN}, {"blue", SIM_LED_BLUE},
+    {"white", SIM_LED_RED | SIM_LED_GREEN | SIM_LED_BLUE}, {0, 0}
+};
+static const SimName SIM_stLedStates[] = {
+    {"off", SIM_LED_OFF}, {"on", SIM_LED_ON}, {"blink", SIM_LED_BLINK}, {0, 0}
+};
+static const SimName SIM_stButtonNames[] = {
+    {"right", SIM_BUTTON_RIGHT}, {"left", SIM_BUTTON_LEFT}, {"both", SIM_BUTTON_RIGHT | SIM_BUTTON_LEFT}, {0, 0}
+};
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static bool SIM_boolName(const SimName *a_ptrNames, const char *a_ptrText, uint32_t *a_ptrValue)
+{
+    for (; (a_ptrText != 0) && (a_ptrNames->name != 0); a_ptrNames++) {
+        if (strcmp(a_ptrNames->name, a_ptrText) == 0) {
+            *a_ptrValue = a_ptrNames->value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool SIM_boolNumber(const char *a_ptrText, double *a_ptrValue)
+{
+    char *ptrEnd = 0;
+
+    if (a_ptrText == 0) {
+        return false;
+    }
+    *a_ptrValue = strtod(a_ptrText, &ptrEnd);
+    return (ptrEnd != a_ptrText) && (*ptrEnd == '\0');
+}
+
+static bool SIM_boolWord(const char *a_ptrText, uint32_t *a_ptrValue)
+{
+    char *ptrEnd = 0;
+
+    if (a_ptrText == 0) {
+        return false;
+    }
+    *a_ptrValue = (uint32_t)strtoul(a_ptrText, &ptrEnd, 0);
+    return (ptrEnd != a_ptrText) && (*ptrEnd == '\0');
+}
+
+/***********************************************
+ * Function Name: SIM_boolTime
+ * Inputs: const char *a_ptrText - hh:mm:ss[.mmm] or +s[.mmm]
+ *         uint64_t a_ui64Previous - Time of the previous action
+ *         uint64_t *a_ptrAt - Receives the time in cycles
+ * Outputs: bool - true if the text is a time
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static bool SIM_boolTime(const char *a_ptrText, uint64_t a_ui64Previous, uint64_t *a_ptrAt)
+{
+    unsigned int uiHours = 0;
+    unsigned int uiMinutes = 0;
+    double dSeconds = 0;
+    int intUsed = 0;
+
+    if (a_ptrText[0] == '+') {
+        if (!SIM_boolNumber(&a_ptrText[1], &dSeconds) || (dSeconds < 0)) {
+            return false;
+        }
+        *a_ptrAt = a_ui64Previous + (uint64_t)(dSeconds * 1000.0 + 0.5) * SIM_MS;
+        return true;
+    }
+    if ((sscanf(a_ptrText, "%u:%u:%lf%n", &uiHours, &uiMinutes, &dSeconds, &intUsed) != 3) ||
+        (a_ptrText[intUsed] != '\0') || (uiMinutes > 59U) || (dSeconds < 0) || (dSeconds >= 60.0)) {
+        return false;
+    }
+    *a_ptrAt = ((((uint64_t)uiHours * 3600U) + ((uint64_t)uiMinutes * 60U)) * 1000U +
+                (uint64_t)(dSeconds * 1000.0 + 0.5)) * SIM_MS;
+    return true;
+}
+
+/***********************************************
+ * Function Name: SIM_ui32Split
+ * Inputs: char *a_ptrLine - Line, modified in place
+ *         char **a_pptrTokens - Receives the tokens
+ * Outputs: uint32_t - Number of tokens, SIM_TOKENS + 1 if a quoted text is not closed
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Splits at blanks; a quoted text is one token, its escapes resolved. A '#' outside quotes ends the
+ *              line.
+ ***********************************************/
+static uint32_t SIM_ui32Split(char *a_ptrLine, char **a_pptrTokens)
+{
+    uint32_t ui32Count = 0;
+    char *ptrRead = a_ptrLine;
+    char *ptrWrite = 0;
+
+    while (ui32Count < SIM_TOKENS) {
+        while ((*ptrRead == ' ') || (*ptrRead == '\t') || (*ptrRead == '\r') || (*ptrRead == '\n')) {
+            ptrRead++;
+        }
+        if ((*ptrRead == '\0') || (*ptrRead == '#')) {
+            break;
+        }
+        if (*ptrRead == '"') {
+            ptrRead++;
+            ptrWrite = ptrRead;
+            a_pptrTokens[ui32Count++] = ptrWrite;
+            while (*ptrRead != '"') {
+                if (*ptrRead == '\0') {
+                    return SIM_TOKENS + 1U;
+                }
+                if ((ptrRead[0] == '\\') && (ptrRead[1] != '\0')) {
+                    ptrRead++;
+                    *ptrWrite = (*ptrRead == 'r') ? '\r' : ((*ptrRead == 'n') ? '\n' : *ptrRead);
+                } else {
+                    *ptrWrite = *ptrRead;
+                }
+                ptrWrite++;
+                ptrRead++;
+            }
+            ptrRead++;
+            *ptrWrite = '\0';
+        } else {
+            a_pptrTokens[ui32Count++] = ptrRead;
+            while ((*ptrRead != '\0') && (*ptrRead != ' ') && (*ptrRead != '\t') && (*ptrRead != '\r') &&
+                   (*ptrRead != '\n')) {
+                ptrRead++;
+            }
+            if (*ptrRead != '\0') {
+                *ptrRead++ = '\0';
+            }
+        }
+    }
+    return ui32Count;
+}
+
+static bool SIM_boolText(const char *a_ptrText, SimAction *a_ptrAction)
+{
+    if ((a_ptrText == 0) || (strlen(a_ptrText) >= SIM_TEXT_LEN)) {
+        return false;
+    }
+    strcpy(a_ptrAction->text, a_ptrText);
+    return true;
+}
+
+// Optional "ramp <s>" after a sensor value
+static bool SIM_boolRamp(char **a_pptrTokens, uint32_t a_ui32Count, SimAction *a_ptrAction)
+{
+    double dSeconds = 0;
+
+    a_ptrAction->rampMs = 0;
+    if (a_ui32Count == 3U) {
+        return true;
+    }
+    if ((a_ui32Count != 5U) || (strcmp(a_pptrTokens[3], "ramp") != 0) ||
+        !SIM_boolNumber(a_pptrTokens[4], &dSeconds) || (dSeconds < 0)) {
+        return false;
+    }
+    a_ptrAction->rampMs = (uint32_t)(dSeconds * 1000.0 + 0.5);
+    return true;
+}
+
+/***********************************************
+ * Function Name: SIM_boolParse
+ * Inputs: char **a_pptrTokens - Tokens of the line, time first
+ *         uint32_t a_ui32Count - Their number
+ *         SimAction *a_ptrAction - Receives the action, time and line already set
+ * Outputs: bool - true if the line is an action
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+static bool SIM_boolParse(char **a_pptrTokens, uint32_t a_ui32Count, SimAction *a_ptrAction)
+{
+    const char *ptrCommand = a_pptrTokens[1];
+    uint32_t ui32Value = 0;
+    double dValue = 0;
+
+    if (strcmp(ptrCommand, "end") == 0) {
+        a_ptrAction->kind = SIM_ACT_END;
+        return a_ui32Count == 2U;
+    }
+    if ((strcmp(ptrCommand, "temp") == 0) || (strcmp(ptrCommand, "volt") == 0)) {
+        a_ptrAction->kind = (ptrCommand[0] == 't') ? SIM_ACT_TEMP : SIM_ACT_VOLT;
+        a_ptrAction->ecu = SIM_SLAVE;
+        if ((a_ui32Count < 3U) || !SIM_boolNumber(a_pptrTokens[2], &dValue)) {
+            return false;
+        }
+        a_ptrAction->value = (float)dValue;
+        return SIM_boolRamp(a_pptrTokens, a_ui32Count, a_ptrAction);
+    }
+    if ((a_ui32Count < 3U) || !SIM_boolName(SIM_stEcuNames, a_pptrTokens[2], &a_ptrAction->ecu)) {
+        return false;
+    }
+    if (strcmp(ptrCommand, "press") == 0) {
+        a_ptrAction->kind = SIM_ACT_PRESS;
+        if ((a_ui32Count != 5U) || !SIM_boolName(SIM_stButtonNames, a_pptrTokens[3], &ui32Value) ||
+            !SIM_boolWord(a_pptrTokens[4], &a_ptrAction->holdMs)) {
+            return false;
+        }
+        a_ptrAction->pins = (uint8_t)ui32Value;
+        return true;
+    }
+    if (strcmp(ptrCommand, "uart") == 0) {
+        a_ptrAction->kind = SIM_ACT_UART;
+        return (a_ui32Count == 4U) && SIM_boolText(a_pptrTokens[3], a_ptrAction);
+    }
+    if ((strcmp(ptrCommand, "unplug") == 0) || (strcmp(ptrCommand, "plug") == 0) ||
+        (strcmp(ptrCommand, "busoff") == 0)) {
+        a_ptrAction->kind = (ptrCommand[0] == 'u') ? SIM_ACT_DISCONNECT :
+                            ((ptrCommand[0] == 'p') ? SIM_ACT_CONNECT : SIM_ACT_BUS_OFF);
+        return a_ui32Count == 3U;
+    }
+    if ((strcmp(ptrCommand, "expect") != 0) || (a_ui32Count < 5U)) {
+        return false;
+    }
+    if (strcmp(a_pptrTokens[3], "led") == 0) {
+        a_ptrAction->kind = SIM_ACT_EXPECT_LED;
+        if ((a_ui32Count != 6U) || !SIM_boolName(SIM_stLedNames, a_pptrTokens[4], &ui32Value)) {
+            return false;
+        }
+        a_ptrAction->pins = (uint8_t)ui32Value;
+        if (!SIM_boolName(SIM_stLedStates, a_pptrTokens[5], &ui32Value)) {
+            return false;
+        }
+        a_ptrAction->state = (SimLedState)ui32Value;
+        return true;
+    }
+    if (strcmp(a_pptrTokens[3], "uart") == 0) {
+        a_ptrAction->kind = SIM_ACT_EXPECT_UART;
+        return (a_ui32Count == 5U) && SIM_boolText(a_pptrTokens[4], a_ptrAction);
+    }
+    if (strcmp(a_pptrTokens[3], "eeprom") == 0) {
+        a_ptrAction->kind = SIM_ACT_EXPECT_EEPROM;
+        return (a_ui32Count == 6U) && SIM_boolWord(a_pptrTokens[4], &a_ptrAction->address) &&
+               ((a_ptrAction->address % 4U) == 0U) && (a_ptrAction->address < FAKE_EEPROM_BYTES) &&
+               SIM_boolWord(a_pptrTokens[5], &a_ptrAction->word);
+    }
+    if (strcmp(a_pptrTokens[3], "resets") == 0) {
+        a_ptrAction->kind = SIM_ACT_EXPECT_RESETS;
+        return (a_ui32Count == 5U) && SIM_boolWord(a_pptrTokens[4], &a_ptrAction->word);
+    }
+    return false;
+}
+
+/***********************************************
+ * Function Name: SIM_boolLoadScenario
+ * Inputs: const char *a_ptrPath - Scenario file
+ *         SimAction **a_pptrActions - Receives the actions, allocated
+ *         uint32_t *a_ptrCount - Receives their number, end included
+ * Outputs: bool - true if the whole file was read; errors are reported on stderr
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+bool SIM_boolLoadScenario(const char *a_ptrPath, SimAction **a_pptrActions, uint32_t *a_ptrCount)
+{
+    FILE *ptrFile = fopen(a_ptrPath, "r");
+    char chLine[SIM_LINE_LEN];
+    char *ptrTokens[SIM_TOKENS];
+    SimAction *ptrActions = 0;
+    SimAction stAction;
+    uint32_t ui32Capacity = 0;
+    uint32_t ui32Count = 0;
+    uint32_t ui32Tokens = 0;
+    uint32_t ui32Line = 0;
+    uint64_t ui64Previous = 0;
+    bool boolEnded = false;
+    bool boolOk = true;
+
+    if (ptrFile == 0) {
+        fprintf(stderr, "%s: cannot open\n", a_ptrPath);
+        return false;
+    }
+    while (boolOk && (fgets(chLine, sizeof(chLine), ptrFile) != 0)) {
+        ui32Line++;
+        ui32Tokens = SIM_ui32Split(chLine, ptrTokens);
+        if (ui32Tokens == 0U) {
+            continue;
+        }
+        memset(&stAction, 0, sizeof(stAction));
+        stAction.line = ui32Line;
+        if (boolEnded) {
+            fprintf(stderr, "%s:%u: action after end\n", a_ptrPath, (unsigned)ui32Line);
+            boolOk = false;
+        } else if ((ui32Tokens < 2U) || (ui32Tokens > SIM_TOKENS) ||
+                   !SIM_boolTime(ptrTokens[0], ui64Previous, &stAction.at) ||
+                   !SIM_boolParse(ptrTokens, ui32Tokens, &stAction)) {
+            fprintf(stderr, "%s:%u: not an action\n", a_ptrPath, (unsigned)ui32Line);
+            boolOk = false;
+        } else if (stAction.at < ui64Previous) {
+            fprintf(stderr, "%s:%u: time goes back\n", a_ptrPath, (unsigned)ui32Line);
+            boolOk = false;
+        } else {
+            if (ui32Count == ui32Capacity) {
+                ui32Capacity = (ui32Capacity == 0U) ? 64U : (2U * ui32Capacity);
+                ptrActions = realloc(ptrActions, ui32Capacity * sizeof(SimAction));
+                if (ptrActions == 0) {
+                    fprintf(stderr, "%s: out of memory\n", a_ptrPath);
+                    exit(2);
+                }
+            }
+            ptrActions[ui32Count++] = stAction;
+            ui64Previous = stAction.at;
+            boolEnded = (stAction.kind == SIM_ACT_END);
+        }
+    }
+    fclose(ptrFile);
+    if (boolOk && !boolEnded) {
+        fprintf(stderr, "%s: no end\n", a_ptrPath);
+        boolOk = false;
+    }
+    if (!boolOk) {
+        free(ptrActions);
+        return false;
+    }
+    *a_pptrActions = ptrActions;
+    *a_ptrCount = ui32Count;
+    return true;
+}
+
+/***********************************************
+ * Function Name: SIM_voidFormatTime
+ * Inputs: uint64_t a_ui64At - Time in cycles
+ *         char *a_ptrText - Receives hh:mm:ss.mmm
+ *         uint32_t a_ui32Length - Size of the text
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+void SIM_voidFormatTime(uint64_t a_ui64At, char *a_ptrText, uint32_t a_ui32Length)
+{
+    uint64_t ui64Ms = a_ui64At / SIM_MS;
+
+    snprintf(a_ptrText, a_ui32Length, "%02u:%02u:%02u.%03u", (unsigned)(ui64Ms / 3600000U),
+             (unsigned)((ui64Ms / 60000U) % 60U), (unsigned)((ui64Ms / 1000U) % 60U), (unsigned)(ui64Ms % 1000U));
+}
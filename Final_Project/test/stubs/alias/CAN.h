@@ -0,0 +1,9 @@
+/*
+ * CAN.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The firmware includes MCAL/CAN/can.h as "CAN.h"; the target file system ignores case, the host one does not.
+ */
+
+#include "MCAL/CAN/can.h"
@@ -0,0 +1,9 @@
+/*
+ * CAN_config.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The firmware includes MCAL/CAN/can_config.h as "CAN_config.h"; the target file system ignores case, the host one does not.
+ */
+
+#include "MCAL/CAN/can_config.h"
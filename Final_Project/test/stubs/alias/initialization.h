@@ -0,0 +1,9 @@
+/*
+ * initialization.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: The firmware includes HAL/Initialization.h as "initialization.h"; the target file system ignores case, the host one does not.
+ */
+
+#include "HAL/Initialization.h"
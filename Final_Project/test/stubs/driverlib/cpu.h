@@ -0,0 +1,19 @@
+/*
+ * cpu.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare driverlib/cpu.h: the sleep and masking instructions. Implemented by test/fake.
+ */
+
+#ifndef __DRIVERLIB_CPU_H__
+#define __DRIVERLIB_CPU_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern uint32_t CPUcpsid(void);
+extern uint32_t CPUcpsie(void);
+extern void CPUwfi(void);
+
+#endif /* __DRIVERLIB_CPU_H__ */
@@ -0,0 +1,26 @@
+/*
+ * pin_map.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare driverlib/pin_map.h: the alternate pin functions of the TM4C123GH6PM that the firmware selects.
+ */
+
+#ifndef __DRIVERLIB_PIN_MAP_H__
+#define __DRIVERLIB_PIN_MAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PA0_U0RX           0x00000001
+#define GPIO_PA1_U0TX           0x00000401
+#define GPIO_PA0_CAN1RX         0x00000008
+#define GPIO_PA1_CAN1TX         0x00000408
+#define GPIO_PB4_CAN0RX         0x00011008
+#define GPIO_PB5_CAN0TX         0x00011408
+#define GPIO_PD0_SSI1CLK        0x00030002
+#define GPIO_PD1_SSI1FSS        0x00030402
+#define GPIO_PD2_SSI1RX         0x00030802
+#define GPIO_PD3_SSI1TX         0x00030C02
+
+#endif /* __DRIVERLIB_PIN_MAP_H__ */
@@ -0,0 +1,27 @@
+/*
+ * ssi.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare driverlib/ssi.h: the synchronous serial interface (the target builds MCAL/SPI/ssi.c, the host uses test/fake).
+ */
+
+#ifndef __DRIVERLIB_SSI_H__
+#define __DRIVERLIB_SSI_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SSI_FRF_MOTO_MODE_0     0x00000000
+#define SSI_MODE_MASTER         0x00000000
+#define SSI_MODE_SLAVE          0x00000001
+
+extern void SSIConfigSetExpClk(uint32_t ui32Base, uint32_t ui32SSIClk, uint32_t ui32Protocol, uint32_t ui32Mode,
+                               uint32_t ui32BitRate, uint32_t ui32DataWidth);
+extern void SSIEnable(uint32_t ui32Base);
+extern void SSIDisable(uint32_t ui32Base);
+extern void SSIDataPut(uint32_t ui32Base, uint32_t ui32Data);
+extern int32_t SSIDataGetNonBlocking(uint32_t ui32Base, uint32_t *pui32Data);
+extern bool SSIBusy(uint32_t ui32Base);
+
+#endif /* __DRIVERLIB_SSI_H__ */
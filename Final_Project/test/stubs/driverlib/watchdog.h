@@ -0,0 +1,23 @@
+/*
+ * watchdog.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare driverlib/watchdog.h: the watchdog timer.
+ */
+
+#ifndef __DRIVERLIB_WATCHDOG_H__
+#define __DRIVERLIB_WATCHDOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern bool WatchdogLockState(uint32_t ui32Base);
+extern void WatchdogUnlock(uint32_t ui32Base);
+extern void WatchdogReloadSet(uint32_t ui32Base, uint32_t ui32LoadVal);
+extern void WatchdogStallEnable(uint32_t ui32Base);
+extern void WatchdogResetEnable(uint32_t ui32Base);
+extern void WatchdogEnable(uint32_t ui32Base);
+extern void WatchdogIntClear(uint32_t ui32Base);
+
+#endif /* __DRIVERLIB_WATCHDOG_H__ */
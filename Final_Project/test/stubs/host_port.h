@@ -0,0 +1,78 @@
+/*
+ * host_port.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Supply the TI ARM compiler intrinsics the firmware uses, for host builds with GCC. The file is
+ *                  included ahead of every source (-include), so the firmware is compiled unchanged.
+ *               2) __ldrex/__strex: the exclusive monitor is modelled per thread; the store succeeds only if the word
+ *                  still holds the value the load returned, which is what the retry loops of OS/atomic.h rely on and
+ *                  keeps them correct between host threads.
+ *               3) _disable_IRQ/_restore_interrupts: the PRIMASK of the fake interrupt controller (test/fake).
+ */
+
+#ifndef HOST_PORT_H_
+#define HOST_PORT_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static __thread uint32_t HOST_ui32Exclusive;    // Value read by the last __ldrex of this thread
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+extern bool IntMasterEnable(void);
+extern bool IntMasterDisable(void);
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+// CLZ instruction; 32 for a zero word as on the target
+static inline unsigned int __clz(unsigned int x)
+{
+    return (x == 0U) ? 32U : (unsigned int)__builtin_clz(x);
+}
+
+// LDREX
+static inline unsigned int __ldrex(void *ptr)
+{
+    HOST_ui32Exclusive = __atomic_load_n((volatile uint32_t *)ptr, __ATOMIC_SEQ_CST);
+    return HOST_ui32Exclusive;
+}
+
+// STREX, 0 = stored
+static inline int __strex(unsigned int val, void *ptr)
+{
+    uint32_t ui32Expected = HOST_ui32Exclusive;
+
+    return __atomic_compare_exchange_n((volatile uint32_t *)ptr, &ui32Expected, (uint32_t)val, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+// CPSID I, returns the previous PRIMASK
+static inline unsigned int _disable_IRQ(void)
+{
+    return IntMasterDisable() ? 1U : 0U;
+}
+
+// MSR PRIMASK
+static inline void _restore_interrupts(unsigned int state)
+{
+    if (state == 0U) {
+        (void)IntMasterEnable();
+    }
+}
+
+#endif /* HOST_PORT_H_ */
@@ -0,0 +1,46 @@
+/*
+ * hw_ints.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare inc/hw_ints.h: the exception and interrupt numbers of the TM4C123GH6PM
+ *               that the firmware uses.
+ */
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define FAULT_NMI               2
+#define FAULT_HARD              3
+#define FAULT_SVCALL            11
+#define FAULT_PENDSV            14
+#define FAULT_SYSTICK           15
+#define INT_GPIOA               16
+#define INT_GPIOB               17
+#define INT_GPIOC               18
+#define INT_GPIOD               19
+#define INT_GPIOE               20
+#define INT_UART0               21
+#define INT_UART1               22
+#define INT_SSI0                23
+#define INT_ADC0SS0             30
+#define INT_ADC0SS1             31
+#define INT_ADC0SS2             32
+#define INT_ADC0SS3             33
+#define INT_WATCHDOG            34
+#define INT_TIMER0A             35
+#define INT_TIMER0B             36
+#define INT_TIMER1A             37
+#define INT_TIMER1B             38
+#define INT_GPIOF               46
+#define INT_SSI1                50
+#define INT_CAN0                55
+#define INT_CAN1                56
+#define INT_ADC1SS0             64
+#define INT_ADC1SS1             65
+#define INT_ADC1SS2             66
+#define INT_ADC1SS3             67
+#define INT_WTIMER0A            110
+#define NUM_INTERRUPTS          155
+
+#endif /* __HW_INTS_H__ */
@@ -0,0 +1,34 @@
+/*
+ * hw_memmap.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare inc/hw_memmap.h: the peripheral base addresses of the TM4C123GH6PM that
+ *               the firmware uses, with their device values.
+ */
+
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#define WATCHDOG0_BASE          0x40000000
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTB_BASE         0x40005000
+#define GPIO_PORTC_BASE         0x40006000
+#define GPIO_PORTD_BASE         0x40007000
+#define SSI0_BASE               0x40008000
+#define SSI1_BASE               0x40009000
+#define UART0_BASE              0x4000C000
+#define UART1_BASE              0x4000D000
+#define GPIO_PORTE_BASE         0x40024000
+#define GPIO_PORTF_BASE         0x40025000
+#define TIMER0_BASE             0x40030000
+#define TIMER1_BASE             0x40031000
+#define WTIMER0_BASE            0x40036000
+#define ADC0_BASE               0x40038000
+#define ADC1_BASE               0x40039000
+#define CAN0_BASE               0x40040000
+#define CAN1_BASE               0x40041000
+#define EEPROM_BASE             0x400AF000
+#define SYSCTL_BASE             0x400FE000
+
+#endif /* __HW_MEMMAP_H__ */
@@ -0,0 +1,29 @@
+/*
+ * hw_nvic.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare inc/hw_nvic.h: the system control registers the firmware reads and
+ *               writes directly (SysTick and the interrupt control and state register).
+ */
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+#define NVIC_ST_CTRL            0xE000E010  // SysTick Control and Status
+#define NVIC_ST_RELOAD          0xE000E014  // SysTick Reload Value
+#define NVIC_ST_CURRENT         0xE000E018  // SysTick Current Value
+#define NVIC_INT_CTRL           0xE000ED04  // Interrupt Control and State
+
+#define NVIC_ST_CTRL_COUNT      0x00010000  // Count Flag
+#define NVIC_ST_CTRL_CLK_SRC    0x00000004  // Clock Source
+#define NVIC_ST_CTRL_INTEN      0x00000002  // Interrupt Enable
+#define NVIC_ST_CTRL_ENABLE     0x00000001  // Enable
+
+#define NVIC_INT_CTRL_NMI_SET   0x80000000  // NMI Set Pending
+#define NVIC_INT_CTRL_PEND_SV   0x10000000  // PendSV Set Pending
+#define NVIC_INT_CTRL_UNPEND_SV 0x08000000  // PendSV Clear Pending
+#define NVIC_INT_CTRL_PENDSTSET 0x04000000  // SysTick Set Pending
+#define NVIC_INT_CTRL_PENDSTCLR 0x02000000  // SysTick Clear Pending
+
+#endif /* __HW_NVIC_H__ */
@@ -0,0 +1,20 @@
+/*
+ * hw_types.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare inc/hw_types.h. Register accesses go through the same macros as on the
+ *               target; the fake register file of test/fake/fake_core.c is mapped at the device addresses.
+ */
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HWREG(x)                (*((volatile uint32_t *)(uintptr_t)(x)))
+#define HWREGH(x)               (*((volatile uint16_t *)(uintptr_t)(x)))
+#define HWREGB(x)               (*((volatile uint8_t *)(uintptr_t)(x)))
+
+#endif /* __HW_TYPES_H__ */
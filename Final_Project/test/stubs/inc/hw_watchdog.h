@@ -0,0 +1,13 @@
+/*
+ * hw_watchdog.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host stand-in for TivaWare inc/hw_watchdog.h. The firmware uses the driverlib calls only, so no register is
+ *               defined here.
+ */
+
+#ifndef __HW_WATCHDOG_H__
+#define __HW_WATCHDOG_H__
+
+#endif /* __HW_WATCHDOG_H__ */
@@ -0,0 +1,280 @@
+/*
+ * map_budget.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: RAM budget per module from a TI ARM linker map (Master_/Debug/Master_.map, Slave_/Debug/Slave_.map):
+ *               1) Read the SECTION ALLOCATION MAP and sum the .data, .bss, .vtable, .sysmem and .stack input
+ *                  sections per object module. Library members are named "lib:member", uninitialized globals the
+ *                  linker placed in .common by their symbol, "common:symbol", and the whole .stack section, which is
+ *                  mostly a hole, ".stack".
+ *               2) Print one line per module and the SRAM total, and compare each with the threshold of the budget
+ *                  file: lines of "ECU name maxBytes", where name is a module, "common:symbol" or "SRAM".
+ *
+ *      Usage rules:
+ *               - map_budget <budget file> <ECU> <map file>; exits 1 when a module or the total is over its
+ *                 threshold, 2 when a file cannot be read.
+ *               - Modules without a threshold are reported, not checked. Raise a threshold in the same change that
+ *                 legitimately grows the module, so the regression shows in the review.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define MAP_MAX_MODULES         128U
+#define MAP_NAME_LEN            96U
+#define MAP_LINE_LEN            512U
+#define MAP_SRAM                "SRAM"
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef enum {
+    MAP_DATA = 0,
+    MAP_BSS,
+    MAP_OTHER,                  // .vtable, .sysmem, .stack
+    MAP_KINDS,
+    MAP_NONE = MAP_KINDS        // Not a RAM output section
+} MapKind;
+
+typedef struct {
+    char name[MAP_NAME_LEN];
+    uint32_t bytes[MAP_KINDS];
+} MapModule;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static MapModule MAP_stModules[MAP_MAX_MODULES];
+static uint32_t MAP_ui32Modules = 0;
+static uint32_t MAP_ui32Total = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static MapKind MAP_enumKind(const char *a_ptrSection)
+{
+    if (strcmp(a_ptrSection, ".data") == 0) {
+        return MAP_DATA;
+    }
+    if (strcmp(a_ptrSection, ".bss") == 0) {
+        return MAP_BSS;
+    }
+    if ((strcmp(a_ptrSection, ".vtable") == 0) || (strcmp(a_ptrSection, ".sysmem") == 0) ||
+        (strcmp(a_ptrSection, ".stack") == 0)) {
+        return MAP_OTHER;
+    }
+    return MAP_NONE;
+}
+
+static MapModule *MAP_ptrModule(const char *a_ptrName)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < MAP_ui32Modules; i++) {
+        if (strcmp(MAP_stModules[i].name, a_ptrName) == 0) {
+            return &MAP_stModules[i];
+        }
+    }
+    if (MAP_ui32Modules == MAP_MAX_MODULES) {
+        fprintf(stderr, "map_budget: more than %u modules\n", (unsigned)MAP_MAX_MODULES);
+        exit(2);
+    }
+    snprintf(MAP_stModules[MAP_ui32Modules].name, MAP_NAME_LEN, "%.*s", (int)(MAP_NAME_LEN - 1U), a_ptrName);
+    return &MAP_stModules[MAP_ui32Modules++];
+}
+
+/*
+ * Description: Attributes one input section line of the allocation map, "  addr  length  who", where who is
+ *              "module.obj (.bss:...)", "lib.lib : member.obj (...)", ": member.obj (...)" for the next member of
+ *              the same library, "(.common:symbol)" or "--HOLE--". Holes count towards the output section only.
+ */
+static void MAP_voidInputSection(MapKind a_enumKind, const char *a_ptrLine, char *a_ptrLibrary)
+{
+    char chWho[MAP_LINE_LEN];
+    char chName[MAP_NAME_LEN];
+    char *ptrParen = NULL;
+    char *ptrColon = NULL;
+    unsigned int uiAddress = 0;
+    unsigned int uiLength = 0;
+    int intUsed = 0;
+
+    if (sscanf(a_ptrLine, " %x %x %n", &uiAddress, &uiLength, &intUsed) != 2) {
+        return;
+    }
+    snprintf(chWho, sizeof(chWho), "%s", a_ptrLine + intUsed);
+    chWho[strcspn(chWho, "\r\n")] = '\0';
+    if ((uiLength == 0U) || (strncmp(chWho, "--HOLE--", 8) == 0)) {
+        return;
+    }
+
+    if (strncmp(chWho, "(.common:", 9) == 0) {
+        chWho[strcspn(chWho, ")")] = '\0';
+        snprintf(chName, sizeof(chName), "common:%.*s", (int)(MAP_NAME_LEN - 8U), chWho + 9);
+    } else {
+        ptrParen = strstr(chWho, " (");
+        if (ptrParen != NULL) {
+            *ptrParen = '\0';
+        }
+        ptrColon = strstr(chWho, ": ");
+        if (ptrColon != NULL) {
+            // "lib : member", or ": member" continuing the library of the line before
+            *ptrColon = '\0';
+            if (strspn(chWho, " ") != strlen(chWho)) {
+                snprintf(a_ptrLibrary, MAP_NAME_LEN, "%.*s", (int)strcspn(chWho, " "), chWho);
+            }
+            snprintf(chName, sizeof(chName), "%.*s:%.*s", (int)(MAP_NAME_LEN / 2U), a_ptrLibrary,
+                     (int)(MAP_NAME_LEN / 2U - 2U), ptrColon + 2);
+        } else {
+            snprintf(chName, sizeof(chName), "%.*s", (int)(MAP_NAME_LEN - 1U), chWho);
+        }
+    }
+    MAP_ptrModule(chName)->bytes[a_enumKind] += uiLength;
+}
+
+static bool MAP_boolParse(const char *a_ptrPath)
+{
+    FILE *ptrFile = fopen(a_ptrPath, "r");
+    char chLine[MAP_LINE_LEN];
+    char chSection[MAP_NAME_LEN];
+    char chLibrary[MAP_NAME_LEN] = "";
+    bool boolInMap = false;
+    MapKind enumKind = MAP_NONE;
+    unsigned int uiPage = 0;
+    unsigned int uiOrigin = 0;
+    unsigned int uiLength = 0;
+
+    if (ptrFile == NULL) {
+        return false;
+    }
+    while (fgets(chLine, sizeof(chLine), ptrFile) != NULL) {
+        if (strncmp(chLine, "SECTION ALLOCATION MAP", 22) == 0) {
+            boolInMap = true;
+        } else if (strncmp(chLine, "MODULE SUMMARY", 14) == 0) {
+            break;
+        } else if (!boolInMap) {
+            continue;
+        } else if ((chLine[0] != ' ') && (chLine[0] != '\n') && (chLine[0] != '\r')) {
+            // Output section header: ".bss       0    20000470    000000ba     UNINITIALIZED"
+            enumKind = MAP_NONE;
+            if (sscanf(chLine, "%95s %x %x %x", chSection, &uiPage, &uiOrigin, &uiLength) == 4) {
+                enumKind = MAP_enumKind(chSection);
+                if (enumKind != MAP_NONE) {
+                    MAP_ui32Total += uiLength;
+                }
+                if (strcmp(chSection, ".stack") == 0) {
+                    MAP_ptrModule(".stack")->bytes[MAP_OTHER] += uiLength;
+                    enumKind = MAP_NONE;
+                }
+            }
+        } else if (enumKind != MAP_NONE) {
+            MAP_voidInputSection(enumKind, chLine, chLibrary);
+        }
+    }
+    fclose(ptrFile);
+    return boolInMap;
+}
+
+static uint32_t MAP_ui32Bytes(const MapModule *a_ptrModule)
+{
+    return a_ptrModule->bytes[MAP_DATA] + a_ptrModule->bytes[MAP_BSS] + a_ptrModule->bytes[MAP_OTHER];
+}
+
+static int MAP_intCompare(const void *a_ptrLeft, const void *a_ptrRight)
+{
+    uint32_t ui32Left = MAP_ui32Bytes((const MapModule *)a_ptrLeft);
+    uint32_t ui32Right = MAP_ui32Bytes((const MapModule *)a_ptrRight);
+
+    return (ui32Left < ui32Right) - (ui32Left > ui32Right);
+}
+
+// Threshold of a_ptrName for a_ptrEcu in the budget file, 0 when there is none
+static uint32_t MAP_ui32Threshold(FILE *a_ptrBudget, const char *a_ptrEcu, const char *a_ptrName)
+{
+    char chLine[MAP_LINE_LEN];
+    char chEcu[MAP_NAME_LEN];
+    char chName[MAP_NAME_LEN];
+    unsigned int uiBytes = 0;
+
+    rewind(a_ptrBudget);
+    while (fgets(chLine, sizeof(chLine), a_ptrBudget) != NULL) {
+        if ((chLine[0] != '#') && (sscanf(chLine, "%95s %95s %u", chEcu, chName, &uiBytes) == 3) &&
+            (strcmp(chEcu, a_ptrEcu) == 0) && (strcmp(chName, a_ptrName) == 0)) {
+            return uiBytes;
+        }
+    }
+    return 0;
+}
+
+// Prints one line; returns true when it is over its threshold
+static bool MAP_boolReport(FILE *a_ptrBudget, const char *a_ptrEcu, const char *a_ptrName, const uint32_t *a_ptrBytes,
+                           uint32_t a_ui32Bytes)
+{
+    uint32_t ui32Threshold = MAP_ui32Threshold(a_ptrBudget, a_ptrEcu, a_ptrName);
+    bool boolOver = (ui32Threshold != 0U) && (a_ui32Bytes > ui32Threshold);
+
+    if (a_ptrBytes != NULL) {
+        printf("  %-52s %6u %6u %6u %7u", a_ptrName, (unsigned)a_ptrBytes[MAP_DATA], (unsigned)a_ptrBytes[MAP_BSS],
+               (unsigned)a_ptrBytes[MAP_OTHER], (unsigned)a_ui32Bytes);
+    } else {
+        printf("  %-52s %6s %6s %6s %7u", a_ptrName, "", "", "", (unsigned)a_ui32Bytes);
+    }
+    if (ui32Threshold != 0U) {
+        printf(" %7u%s", (unsigned)ui32Threshold, boolOver ? "  OVER BUDGET" : "");
+    }
+    printf("\n");
+    return boolOver;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *ptrBudget = NULL;
+    uint32_t ui32Over = 0;
+    uint32_t i = 0;
+
+    if (argc != 4) {
+        fprintf(stderr, "usage: map_budget <budget file> <ECU> <map file>\n");
+        return 2;
+    }
+    ptrBudget = fopen(argv[1], "r");
+    if (ptrBudget == NULL) {
+        fprintf(stderr, "map_budget: cannot read %s\n", argv[1]);
+        return 2;
+    }
+    if (!MAP_boolParse(argv[3])) {
+        fprintf(stderr, "map_budget: no section allocation map in %s\n", argv[3]);
+        fclose(ptrBudget);
+        return 2;
+    }
+
+    qsort(MAP_stModules, MAP_ui32Modules, sizeof(MapModule), MAP_intCompare);
+    printf("%s (%s)\n  %-52s %6s %6s %6s %7s %7s\n", argv[2], argv[3], "module", ".data", ".bss", "other", "total",
+           "budget");
+    for (i = 0; i < MAP_ui32Modules; i++) {
+        ui32Over += MAP_boolReport(ptrBudget, argv[2], MAP_stModules[i].name, MAP_stModules[i].bytes,
+                                   MAP_ui32Bytes(&MAP_stModules[i])) ? 1U : 0U;
+    }
+    ui32Over += MAP_boolReport(ptrBudget, argv[2], MAP_SRAM, NULL, MAP_ui32Total) ? 1U : 0U;
+    fclose(ptrBudget);
+
+    if (ui32Over != 0U) {
+        printf("%s: %u over budget\n", argv[2], (unsigned)ui32Over);
+        return 1;
+    }
+    return 0;
+}
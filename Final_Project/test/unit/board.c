@@ -0,0 +1,168 @@
+/*
+ * board.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Board of the host unit tests: nothing is attached to the fake MCU, so a sleep ends at the next
+ *                  event at once, and the outputs are recorded for the checks.
+ *               2) The checks of unit.h.
+ *               3) The stack monitor port: the host stack is not the painted system stack, so the dispatcher's
+ *                  per-task stack depth reads 0.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "fake.h"
+#include "OS/stackmon.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+uint32_t UNIT_ui32Checks = 0;
+uint32_t UNIT_ui32Failures = 0;
+
+uint32_t UNIT_ui32CanRequests = 0;
+char UNIT_chUart[UNIT_UART_CAPTURE];
+uint32_t UNIT_ui32UartLength = 0;
+uint32_t UNIT_ui32AdcSample = 0;
+uint32_t UNIT_ui32Resets = 0;
+const char *UNIT_ptrResetCause = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: UNIT_voidCheck
+ * Inputs: bool a_boolPassed - Result of the check
+ *         const char *a_ptrFile - Source file of the check
+ *         int a_intLine - Its line
+ *         const char *a_ptrText - The condition as written
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Counts the check and reports it if it failed.
+ ***********************************************/
+void UNIT_voidCheck(bool a_boolPassed, const char *a_ptrFile, int a_intLine, const char *a_ptrText)
+{
+    UNIT_ui32Checks++;
+    if (!a_boolPassed) {
+        UNIT_ui32Failures++;
+        printf("%s:%d: check failed: %s\n", a_ptrFile, a_intLine, a_ptrText);
+    }
+}
+
+/***********************************************
+ * Function Name: UNIT_voidCheckEqual
+ * Inputs: uint64_t a_ui64Actual - Value computed
+ *         uint64_t a_ui64Expected - Value required
+ *         const char *a_ptrFile - Source file of the check
+ *         int a_intLine - Its line
+ *         const char *a_ptrText - The comparison as written
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: As UNIT_voidCheck, and prints both values on failure.
+ ***********************************************/
+void UNIT_voidCheckEqual(uint64_t a_ui64Actual, uint64_t a_ui64Expected, const char *a_ptrFile, int a_intLine,
+                         const char *a_ptrText)
+{
+    UNIT_voidCheck(a_ui64Actual == a_ui64Expected, a_ptrFile, a_intLine, a_ptrText);
+    if (a_ui64Actual != a_ui64Expected) {
+        printf("    got %llu, expected %llu\n", (unsigned long long)a_ui64Actual,
+               (unsigned long long)a_ui64Expected);
+    }
+}
+
+/***********************************************
+ * Function Name: UNIT_intReport
+ * Inputs: const char *a_ptrName - Test program
+ * Outputs: int - Exit status: 0 if every check passed
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: N/A
+ ***********************************************/
+int UNIT_intReport(const char *a_ptrName)
+{
+    printf("%s: %u checks, %u failed\n", a_ptrName, (unsigned)UNIT_ui32Checks, (unsigned)UNIT_ui32Failures);
+    return (UNIT_ui32Failures == 0U) ? 0 : 1;
+}
+
+/***********************************************
+ * Function Name: UNIT_voidUartClear
+ * Inputs: N/A
+ * Outputs: N/A
+ * Reentrancy: Non-Reentrant
+ * Synchronous: Synch
+ * Description: Forgets the UART output recorded so far.
+ ***********************************************/
+void UNIT_voidUartClear(void)
+{
+    UNIT_ui32UartLength = 0;
+    UNIT_chUart[0] = '\0';
+}
+
+/***********************************************
+ * Board hooks (fake.h)
+ ***********************************************/
+void BOARD_voidPoll(void)
+{
+}
+
+uint64_t BOARD_ui64Sleep(uint64_t a_ui64Until)
+{
+    return a_ui64Until;
+}
+
+void BOARD_voidCanRequest(void)
+{
+    UNIT_ui32CanRequests++;
+}
+
+void BOARD_voidUartTransmit(uint32_t a_ui32Base, uint8_t a_ui8Char)
+{
+    (void)a_ui32Base;
+    if (UNIT_ui32UartLength < (UNIT_UART_CAPTURE - 1U)) {
+        UNIT_chUart[UNIT_ui32UartLength] = (char)a_ui8Char;
+        UNIT_ui32UartLength++;
+        UNIT_chUart[UNIT_ui32UartLength] = '\0';
+    }
+}
+
+void BOARD_voidGpioOutput(uint32_t a_ui32Port, uint8_t a_ui8Old, uint8_t a_ui8New)
+{
+    (void)a_ui32Port;
+    (void)a_ui8Old;
+    (void)a_ui8New;
+}
+
+uint32_t BOARD_ui32AdcSample(uint32_t a_ui32Base, uint32_t a_ui32Channel)
+{
+    (void)a_ui32Base;
+    (void)a_ui32Channel;
+    return UNIT_ui32AdcSample;
+}
+
+void BOARD_voidReset(const char *a_ptrCause)
+{
+    UNIT_ui32Resets++;
+    UNIT_ptrResetCause = a_ptrCause;
+}
+
+/***********************************************
+ * OS/stackmon.h port
+ ***********************************************/
+void OS_voidStackPaint(void)
+{
+}
+
+uint32_t OS_ui32StackUsed(void)
+{
+    return 0;
+}
@@ -0,0 +1,348 @@
+/*
+ * test_can.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of MCAL/CAN/can.c on the CAN controller of the fake MCU, the test acting as the bus:
+ *               1) sealed frames: the checksum against an independent CRC-8/SAE-J1850 and the alive counter;
+ *               2) transmit order: lowest identifier first across the mailboxes, equal identifiers in CAN_Send
+ *                  order, a frame already on the bus left to complete, the queue full, the TXOK statistics;
+ *               3) receive: FIFO order, a full FIFO reported as an overrun, a full RX ring counted as dropped;
+ *               4) CAN_Receive rejecting a wrong length, a bad checksum and a repeated alive counter.
+ *               CAN_handler is the one of Master_/OS/scheduler.c without the OS events and the error job.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "fake.h"
+#include "CAN.h"
+#include "CAN_config.h"
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_FREE_ID            0x120U      // Received by the first FIFO, not described in can_db.h
+#define TEST_FREE_ID_HIGH       0x130U
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+void CAN_handler(void)
+{
+    uint32_t ui32Cause = CANIntStatus(CAN_BASE, CAN_INT_STS_CAUSE);
+
+    if ((ui32Cause >= 1U) && (ui32Cause <= 32U)) {
+        CANIntClear(CAN_BASE, ui32Cause);
+        (void)CAN_DrainReceiveObjects();
+        (void)CAN_ServiceTransmitObjects();
+    } else if (ui32Cause == CAN_INT_INTID_STATUS) {
+        (void)CANStatusGet(CAN_BASE, CAN_STS_CONTROL);
+    }
+}
+
+// CRC-8/SAE-J1850 through a lookup table, checked against the catalogue value of "123456789"
+static uint8_t TEST_ui8Crc8(const uint8_t *a_ptrData, uint32_t a_ui32Length)
+{
+    static uint8_t aui8Table[256];
+    static bool boolBuilt = false;
+    uint8_t ui8Crc = 0xFFU;
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    if (!boolBuilt) {
+        for (i = 0; i < 256U; i++) {
+            ui8Crc = (uint8_t)i;
+            for (j = 0; j < 8U; j++) {
+                ui8Crc = (uint8_t)((ui8Crc << 1) ^ ((ui8Crc & 0x80U) ? 0x1DU : 0x00U));
+            }
+            aui8Table[i] = ui8Crc;
+        }
+        boolBuilt = true;
+        ui8Crc = 0xFFU;
+    }
+    for (i = 0; i < a_ui32Length; i++) {
+        ui8Crc = aui8Table[ui8Crc ^ a_ptrData[i]];
+    }
+    return (uint8_t)(ui8Crc ^ 0xFFU);
+}
+
+// Checksum of a sealed frame: identifier low byte, high byte, then the data before the checksum byte
+static uint8_t TEST_ui8FrameCrc(uint32_t a_ui32Id, const uint8_t *a_ptrData, uint32_t a_ui32Length)
+{
+    uint8_t aui8Bytes[10];
+
+    aui8Bytes[0] = (uint8_t)a_ui32Id;
+    aui8Bytes[1] = (uint8_t)(a_ui32Id >> 8);
+    memcpy(&aui8Bytes[2], a_ptrData, a_ui32Length - 1U);
+    return TEST_ui8Crc8(aui8Bytes, a_ui32Length + 1U);
+}
+
+// The bus: sends every frame the controller offers, acknowledged; returns the number sent
+static uint32_t TEST_ui32BusRun(FAKE_CanFrame *a_ptrSent, uint32_t a_ui32Max)
+{
+    FAKE_CanFrame stFrame;
+    uint32_t ui32Count = 0;
+
+    while ((ui32Count < a_ui32Max) && FAKE_boolCanStartTx(&stFrame)) {
+        FAKE_voidSpend(100U);
+        FAKE_voidCanTxDone(true);
+        FAKE_voidSpend(FAKE_CALL_CYCLES);       // CAN_handler refills the mailbox
+        if (a_ptrSent != 0) {
+            a_ptrSent[ui32Count] = stFrame;
+        }
+        ui32Count++;
+    }
+    return ui32Count;
+}
+
+static void TEST_voidReceive(uint32_t a_ui32Id, const uint8_t *a_ptrData, uint8_t a_ui8Length)
+{
+    FAKE_CanFrame stFrame;
+
+    memset(&stFrame, 0, sizeof(stFrame));
+    stFrame.id = a_ui32Id;
+    stFrame.length = a_ui8Length;
+    memcpy(stFrame.data, a_ptrData, a_ui8Length);
+    FAKE_voidCanReceive(&stFrame);
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+}
+
+static void TEST_voidFlushReceived(void)
+{
+    CAN_Frame_t stFrame;
+
+    while (CAN_Receive(&stFrame)) {
+    }
+}
+
+static void TEST_voidInit(void)
+{
+    const uint8_t aui8Check[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    UNIT_CHECK_EQ(TEST_ui8Crc8(aui8Check, sizeof(aui8Check)), 0x4BU);
+
+    // The TX queue orders frames of one identifier by their time stamps: the time base runs first, as in main()
+    OS_voidTimeBaseInit();
+    CAN_Init();
+    CAN_ConfigureReceiveObjects();
+    IntMasterEnable();
+    UNIT_CHECK(FAKE_boolCanOnBus());
+}
+
+static void TEST_voidSealed(void)
+{
+    uint8_t aui8Data[CAN_DLC_TEMPERATURE] = {0};
+    FAKE_CanFrame astSent[4];
+    uint32_t i = 0;
+
+    CAN_Pack_TEMPERATURE_AVERAGE(aui8Data, 36.6f);
+    for (i = 0; i < 3U; i++) {
+        UNIT_CHECK(CAN_Send(CAN_ID_TEMPERATURE, aui8Data, CAN_DLC_TEMPERATURE));
+    }
+    UNIT_CHECK_EQ(TEST_ui32BusRun(astSent, 4U), 3U);
+
+    for (i = 0; i < 3U; i++) {
+        UNIT_CHECK_EQ(astSent[i].length, CAN_DLC_TEMPERATURE);
+        UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_AVERAGE(astSent[i].data), CAN_UnpackRaw_TEMPERATURE_AVERAGE(aui8Data));
+        UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_ALIVE_COUNTER(astSent[i].data), i);
+        UNIT_CHECK_EQ(astSent[i].data[CAN_DLC_TEMPERATURE - 1U],
+                      TEST_ui8FrameCrc(CAN_ID_TEMPERATURE, astSent[i].data, CAN_DLC_TEMPERATURE));
+    }
+
+    // An undescribed identifier goes out as given
+    aui8Data[2] = 0x77U;
+    UNIT_CHECK(CAN_Send(TEST_FREE_ID, aui8Data, 3U));
+    UNIT_CHECK_EQ(TEST_ui32BusRun(astSent, 4U), 1U);
+    UNIT_CHECK_EQ(astSent[0].data[2], 0x77U);
+}
+
+static void TEST_voidTransmitOrder(void)
+{
+    static const uint32_t aui32Ids[6] = {0x1F0U, 0x130U, 0x108U, 0x125U, 0x101U, 0x1A0U};
+    uint8_t aui8Data[8] = {0};
+    FAKE_CanFrame astSent[8];
+    CAN_TxStats_t stBefore;
+    CAN_TxStats_t stAfter;
+    uint32_t i = 0;
+
+    CAN_GetTxStats(&stBefore);
+
+    // The mailboxes hold frames in bus order, whatever the order of CAN_Send
+    for (i = 0; i < 6U; i++) {
+        UNIT_CHECK(CAN_Send(aui32Ids[i], aui8Data, 2U));
+    }
+    UNIT_CHECK_EQ(TEST_ui32BusRun(astSent, 8U), 6U);
+    for (i = 1; i < 6U; i++) {
+        UNIT_CHECK(astSent[i - 1U].id < astSent[i].id);
+    }
+
+    // A frame that won arbitration completes; a higher-priority frame queued meanwhile goes next
+    UNIT_CHECK(CAN_Send(0x1F0U, aui8Data, 2U));
+    UNIT_CHECK(FAKE_boolCanStartTx(&astSent[0]));
+    UNIT_CHECK(CAN_Send(0x1E0U, aui8Data, 2U));
+    UNIT_CHECK(CAN_Send(0x110U, aui8Data, 2U));
+    FAKE_voidCanTxDone(true);
+    FAKE_voidSpend(FAKE_CALL_CYCLES);
+    UNIT_CHECK_EQ(TEST_ui32BusRun(&astSent[1], 7U), 2U);
+    UNIT_CHECK_EQ(astSent[0].id, 0x1F0U);
+    UNIT_CHECK_EQ(astSent[1].id, 0x110U);
+    UNIT_CHECK_EQ(astSent[2].id, 0x1E0U);
+
+    CAN_GetTxStats(&stAfter);
+    UNIT_CHECK_EQ(stAfter.sent - stBefore.sent, 9U);
+    UNIT_CHECK_EQ(stAfter.depth, 0U);
+    UNIT_CHECK(stAfter.maxLatencyCycles > 0U);
+}
+
+static void TEST_voidQueueFull(void)
+{
+    uint8_t aui8Data[8] = {0};
+    FAKE_CanFrame astSent[CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN];
+    CAN_TxStats_t stBefore;
+    CAN_TxStats_t stAfter;
+    uint32_t i = 0;
+
+    CAN_GetTxStats(&stBefore);
+
+    // Mailboxes, then the queue, then refused
+    for (i = 0; i < (CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN); i++) {
+        aui8Data[0] = (uint8_t)i;
+        UNIT_CHECK(CAN_Send(TEST_FREE_ID_HIGH, aui8Data, 1U));
+    }
+    UNIT_CHECK(!CAN_Send(TEST_FREE_ID_HIGH, aui8Data, 1U));
+    CAN_GetTxStats(&stAfter);
+    UNIT_CHECK_EQ(stAfter.dropped - stBefore.dropped, 1U);
+    UNIT_CHECK_EQ(stAfter.depth, CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN);
+
+    // Equal identifiers keep their CAN_Send order through the queue and the mailboxes
+    UNIT_CHECK_EQ(TEST_ui32BusRun(astSent, CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN), CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN);
+    for (i = 0; i < (CAN_TX_MAILBOXES + CAN_TX_QUEUE_LEN); i++) {
+        UNIT_CHECK_EQ(astSent[i].data[0], i);
+    }
+    UNIT_CHECK(!FAKE_boolCanPeekTx(&astSent[0]));
+}
+
+static void TEST_voidReceiveOrder(void)
+{
+    CAN_RxCounters_t stBefore;
+    CAN_RxCounters_t stAfter;
+    CAN_Frame_t stFrame;
+    uint8_t aui8Data[8] = {0};
+    uint32_t i = 0;
+
+    TEST_voidFlushReceived();
+    CAN_GetRxCounters(&stBefore);
+    for (i = 0; i < 5U; i++) {
+        aui8Data[0] = (uint8_t)i;
+        TEST_voidReceive(TEST_FREE_ID, aui8Data, 8U);
+    }
+    for (i = 0; i < 5U; i++) {
+        UNIT_CHECK(CAN_Receive(&stFrame));
+        UNIT_CHECK_EQ(stFrame.data[0], i);
+        UNIT_CHECK_EQ(stFrame.object, MSG_OBJ_RX_1);        // Drained before the next frame came
+    }
+    UNIT_CHECK(!CAN_Receive(&stFrame));
+
+    // Interrupts masked: the FIFO of 8 fills in order, then its last object is overwritten
+    IntMasterDisable();
+    for (i = 0; i < 10U; i++) {
+        aui8Data[0] = (uint8_t)(0x10U + i);
+        TEST_voidReceive(TEST_FREE_ID, aui8Data, 8U);
+    }
+    IntMasterEnable();
+    for (i = 0; i < 7U; i++) {
+        UNIT_CHECK(CAN_Receive(&stFrame));
+        UNIT_CHECK_EQ(stFrame.data[0], 0x10U + i);
+    }
+    UNIT_CHECK(CAN_Receive(&stFrame));
+    UNIT_CHECK_EQ(stFrame.data[0], 0x19U);
+    UNIT_CHECK(!CAN_Receive(&stFrame));
+
+    // The diagnostic FIFO is separate
+    aui8Data[0] = 0xD1U;
+    TEST_voidReceive(0x2A0U, aui8Data, 8U);
+    UNIT_CHECK(CAN_Receive(&stFrame));
+    UNIT_CHECK_EQ(stFrame.object, MSG_OBJ_RX_9);
+
+    CAN_GetRxCounters(&stAfter);
+    UNIT_CHECK_EQ(stAfter.received - stBefore.received, 5U + 8U + 1U);
+    UNIT_CHECK_EQ(stAfter.overruns - stBefore.overruns, 1U);
+    UNIT_CHECK_EQ(stAfter.dropped, stBefore.dropped);
+}
+
+static void TEST_voidRingFull(void)
+{
+    CAN_RxCounters_t stBefore;
+    CAN_RxCounters_t stAfter;
+    uint8_t aui8Data[8] = {0};
+    uint32_t i = 0;
+
+    TEST_voidFlushReceived();
+    CAN_GetRxCounters(&stBefore);
+    for (i = 0; i < (CAN_RX_RING_LEN + 4U); i++) {
+        TEST_voidReceive(TEST_FREE_ID, aui8Data, 8U);
+    }
+    CAN_GetRxCounters(&stAfter);
+    UNIT_CHECK_EQ(stAfter.received - stBefore.received, CAN_RX_RING_LEN + 4U);
+    UNIT_CHECK_EQ(stAfter.dropped - stBefore.dropped, 4U);
+    TEST_voidFlushReceived();
+}
+
+static void TEST_voidAccept(void)
+{
+    CAN_RxCounters_t stBefore;
+    CAN_RxCounters_t stAfter;
+    CAN_Frame_t stFrame;
+    uint8_t aui8Data[CAN_DLC_STATE] = {0};
+
+    TEST_voidFlushReceived();
+    CAN_GetRxCounters(&stBefore);
+
+    CAN_PackRaw_STATE_CODE(aui8Data, 1U);
+    CAN_PackRaw_STATE_ALIVE_COUNTER(aui8Data, 3U);
+    aui8Data[CAN_DLC_STATE - 1U] = TEST_ui8FrameCrc(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    TEST_voidReceive(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    UNIT_CHECK(CAN_Receive(&stFrame));
+    UNIT_CHECK_EQ(CAN_UnpackRaw_STATE_CODE(stFrame.data), 1U);
+
+    // The same alive counter again: the sender is stuck
+    TEST_voidReceive(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    UNIT_CHECK(!CAN_Receive(&stFrame));
+
+    // Next counter with a corrupted payload, then with the wrong length
+    CAN_PackRaw_STATE_ALIVE_COUNTER(aui8Data, 4U);
+    aui8Data[CAN_DLC_STATE - 1U] = TEST_ui8FrameCrc(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    aui8Data[0] ^= 0x04U;
+    TEST_voidReceive(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    UNIT_CHECK(!CAN_Receive(&stFrame));
+    aui8Data[0] ^= 0x04U;
+    TEST_voidReceive(CAN_ID_STATE, aui8Data, 8U);
+    UNIT_CHECK(!CAN_Receive(&stFrame));
+
+    // Intact: accepted, the rejected frames did not move the counter
+    TEST_voidReceive(CAN_ID_STATE, aui8Data, CAN_DLC_STATE);
+    UNIT_CHECK(CAN_Receive(&stFrame));
+
+    CAN_GetRxCounters(&stAfter);
+    UNIT_CHECK_EQ(stAfter.rejected - stBefore.rejected, 3U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidInit);
+    UNIT_RUN(TEST_voidSealed);
+    UNIT_RUN(TEST_voidTransmitOrder);
+    UNIT_RUN(TEST_voidQueueFull);
+    UNIT_RUN(TEST_voidReceiveOrder);
+    UNIT_RUN(TEST_voidRingFull);
+    UNIT_RUN(TEST_voidAccept);
+    return UNIT_intReport("test_can");
+}
@@ -0,0 +1,164 @@
+/*
+ * test_can_db.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of the codecs generated by MCAL/CAN/can_db.h:
+ *               1) a round trip of every signal of the signal table (generated from the table itself, so a new
+ *                  signal is tested without editing this file): lowest, highest and a mixed raw value, without
+ *                  touching any bit outside the signal;
+ *               2) no two signals of a message overlap;
+ *               3) physical values: scaling, rounding and saturation;
+ *               4) the bus load of the packed layout against the old one value per 8-byte frame layout.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <math.h>
+#include <string.h>
+#include "unit.h"
+#include "MCAL/CAN/can_db.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_FRAME_BITS(dlc)    (47U + (8U * (dlc)))    // Without stuff bits
+
+// Round trip of one signal over a payload of 0x00 and one of 0xFF bytes
+#define TEST_SIGNAL_ROUND_TRIP(message, name, start, length, scale, offset) \
+    { \
+        static const uint32_t aui32Raw[3] = {0U, (uint32_t)((1ULL << (length)) - 1U), 0x5A5A5A5AUL & (uint32_t)((1ULL << (length)) - 1U)}; \
+        uint8_t aui8Data[8]; \
+        uint8_t aui8Outside[8]; \
+        uint32_t i = 0; \
+        uint32_t j = 0; \
+        for (i = 0; i < 3U; i++) { \
+            for (j = 0; j < 2U; j++) { \
+                memset(aui8Data, (j == 0U) ? 0x00 : 0xFF, sizeof(aui8Data)); \
+                CAN_PackRaw_##message##_##name(aui8Data, aui32Raw[i]); \
+                UNIT_CHECK_EQ(CAN_UnpackRaw_##message##_##name(aui8Data), aui32Raw[i]); \
+                memcpy(aui8Outside, aui8Data, sizeof(aui8Outside)); \
+                CAN_PackBits(aui8Outside, (start), (length), (j == 0U) ? 0U : 0xFFFFFFFFUL); \
+                UNIT_CHECK_EQ(TEST_ui32Differs(aui8Outside, (j == 0U) ? 0x00U : 0xFFU), 0U); \
+            } \
+        } \
+        TEST_ui32Signals++; \
+    }
+
+// Bits of each message claimed by its signals
+#define TEST_SIGNAL_CLAIM(message, name, start, length, scale, offset) \
+    { \
+        uint8_t aui8Bits[8] = {0}; \
+        uint32_t i = 0; \
+        CAN_PackBits(aui8Bits, (start), (length), 0xFFFFFFFFUL); \
+        for (i = 0; i < 8U; i++) { \
+            UNIT_CHECK_EQ(TEST_ui8Claimed[CAN_DB_INDEX_##message][i] & aui8Bits[i], 0U); \
+            TEST_ui8Claimed[CAN_DB_INDEX_##message][i] |= aui8Bits[i]; \
+        } \
+    }
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+const CAN_DbMessage_t g_stCanDbMessages[CAN_DB_MESSAGE_COUNT] = {
+    CAN_DB_MESSAGE_TABLE(CAN_DB_MESSAGE_ENTRY)
+};
+
+static uint32_t TEST_ui32Signals = 0;
+static uint8_t TEST_ui8Claimed[CAN_DB_MESSAGE_COUNT][8];
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+// Bytes of the payload that differ from the fill value
+static uint32_t TEST_ui32Differs(const uint8_t *a_ptrData, uint8_t a_ui8Fill)
+{
+    uint32_t ui32Count = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < 8U; i++) {
+        if (a_ptrData[i] != a_ui8Fill) {
+            ui32Count++;
+        }
+    }
+    return ui32Count;
+}
+
+static void TEST_voidRoundTrip(void)
+{
+    CAN_DB_SIGNAL_TABLE(TEST_SIGNAL_ROUND_TRIP)
+    printf("    %u signals\n", (unsigned)TEST_ui32Signals);
+}
+
+static void TEST_voidNoOverlap(void)
+{
+    memset(TEST_ui8Claimed, 0, sizeof(TEST_ui8Claimed));
+    CAN_DB_SIGNAL_TABLE(TEST_SIGNAL_CLAIM)
+
+    // A sealed message ends with the alive counter nibble and the checksum byte
+    UNIT_CHECK_EQ(TEST_ui8Claimed[CAN_DB_INDEX_STATE][CAN_DLC_STATE - 1U], 0xFFU);
+    UNIT_CHECK_EQ(TEST_ui8Claimed[CAN_DB_INDEX_STATE][CAN_DLC_STATE - 2U] & 0xF0U, 0xF0U);
+}
+
+static void TEST_voidPhysical(void)
+{
+    uint8_t aui8Data[8] = {0};
+
+    CAN_Pack_TEMPERATURE_AVERAGE(aui8Data, 23.46f);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_AVERAGE(aui8Data), 735U);       // Rounded to 0.1 degC
+    UNIT_CHECK(fabsf(CAN_Unpack_TEMPERATURE_AVERAGE(aui8Data) - 23.5f) < 0.01f);
+    CAN_Pack_TEMPERATURE_AVERAGE(aui8Data, -49.96f);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_AVERAGE(aui8Data), 0U);
+
+    // Saturation at both ends, and not a number
+    CAN_Pack_TEMPERATURE_AVERAGE(aui8Data, -80.0f);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_AVERAGE(aui8Data), 0U);
+    CAN_Pack_TEMPERATURE_AVERAGE(aui8Data, 400.0f);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_TEMPERATURE_AVERAGE(aui8Data), 2047U);
+    UNIT_CHECK(fabsf(CAN_Unpack_TEMPERATURE_AVERAGE(aui8Data) - 154.7f) < 0.01f);
+    CAN_Pack_VOLTAGE_SENSOR(aui8Data, NAN);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_VOLTAGE_SENSOR(aui8Data), 0U);
+
+    CAN_Pack_VOLTAGE_SENSOR(aui8Data, 12.34f);
+    UNIT_CHECK_EQ(aui8Data[0], 123U);
+
+    // Counters wrap in the raw codec
+    CAN_PackRaw_STATE_ALIVE_COUNTER(aui8Data, 0x13U);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_STATE_ALIVE_COUNTER(aui8Data), 3U);
+
+    // The lookup table is in table order with the described lengths
+    UNIT_CHECK_EQ(g_stCanDbMessages[CAN_DB_INDEX_TEMPERATURE].id, CAN_ID_TEMPERATURE);
+    UNIT_CHECK_EQ(g_stCanDbMessages[CAN_DB_INDEX_TEMPERATURE].dlc, CAN_DLC_TEMPERATURE);
+    UNIT_CHECK_EQ(g_stCanDbMessages[CAN_DB_INDEX_STATE].burst, 3U);
+}
+
+// Before the database every message went out as 8 bytes; the temperature and the voltage each had their own frame
+static void TEST_voidBusLoad(void)
+{
+    uint32_t ui32Old = 0;
+    uint32_t ui32New = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < CAN_DB_MESSAGE_COUNT; i++) {
+        ui32Old += TEST_FRAME_BITS(8U);
+        ui32New += TEST_FRAME_BITS(g_stCanDbMessages[i].dlc);
+    }
+    printf("    one frame of every message: %u bits packed, %u bits as 8-byte frames (%u%%)\n", (unsigned)ui32New,
+           (unsigned)ui32Old, (unsigned)((ui32New * 100U) / ui32Old));
+    UNIT_CHECK(ui32New < ui32Old);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidRoundTrip);
+    UNIT_RUN(TEST_voidNoOverlap);
+    UNIT_RUN(TEST_voidPhysical);
+    UNIT_RUN(TEST_voidBusLoad);
+    return UNIT_intReport("test_can_db");
+}
@@ -0,0 +1,243 @@
+/*
+ * test_com.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/com.c over the message table of MCAL/CAN/can_db.h, with CAN_Send recording the
+ *               frames instead of queuing them: the cyclic, mixed (fast-start burst) and direct transmission modes,
+ *               changes merged within the gap, the alive counter and checksum not counting as a change, and the
+ *               change-to-frame delay statistic. Ends with the STATE traffic of an overheat -> fault -> normal
+ *               sequence, compared with the old "send on every 200 ms run" policy.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "OS/com.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_LOG_LEN            256U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t id;
+    uint32_t tick;
+    uint8_t length;
+    uint8_t data[8];
+} TEST_Sent;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+volatile uint32_t g_ui32SysTickCount = 0;
+const CAN_DbMessage_t g_stCanDbMessages[CAN_DB_MESSAGE_COUNT] = {
+    CAN_DB_MESSAGE_TABLE(CAN_DB_MESSAGE_ENTRY)
+};
+
+static TEST_Sent TEST_stSent[TEST_LOG_LEN];
+static uint32_t TEST_ui32Sent = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+bool CAN_Send(uint32_t messageID, const uint8_t *data, uint8_t dataLength)
+{
+    if (TEST_ui32Sent < TEST_LOG_LEN) {
+        TEST_stSent[TEST_ui32Sent].id = messageID;
+        TEST_stSent[TEST_ui32Sent].tick = g_ui32SysTickCount;
+        TEST_stSent[TEST_ui32Sent].length = dataLength;
+        memcpy(TEST_stSent[TEST_ui32Sent].data, data, dataLength);
+        TEST_ui32Sent++;
+    }
+    return true;
+}
+
+static void TEST_voidReset(void)
+{
+    g_ui32SysTickCount = 0;
+    TEST_ui32Sent = 0;
+    OS_voidComInit();
+}
+
+// Ticks pass; OS_voidComMainFunction runs on every multiple of OS_COM_PERIOD_TICKS
+static void TEST_voidAdvanceTo(uint32_t a_ui32Tick)
+{
+    while (g_ui32SysTickCount < a_ui32Tick) {
+        g_ui32SysTickCount++;
+        if ((g_ui32SysTickCount % OS_COM_PERIOD_TICKS) == 0U) {
+            OS_voidComMainFunction();
+        }
+    }
+}
+
+static void TEST_voidWriteState(uint8_t a_ui8Code)
+{
+    uint8_t aui8Data[CAN_DLC_STATE] = {0};
+
+    CAN_PackRaw_STATE_CODE(aui8Data, a_ui8Code);
+    OS_voidComWrite(CAN_DB_INDEX_STATE, aui8Data);
+}
+
+static uint32_t TEST_ui32Count(uint32_t a_ui32Id, uint32_t a_ui32From, uint32_t a_ui32To)
+{
+    uint32_t ui32Count = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < TEST_ui32Sent; i++) {
+        if ((TEST_stSent[i].id == a_ui32Id) && (TEST_stSent[i].tick >= a_ui32From) && (TEST_stSent[i].tick < a_ui32To)) {
+            ui32Count++;
+        }
+    }
+    return ui32Count;
+}
+
+static void TEST_voidCyclic(void)
+{
+    uint8_t aui8Data[CAN_DLC_KEEP_ALIVE] = {0};
+
+    TEST_voidReset();
+    TEST_voidAdvanceTo(1000U);
+    UNIT_CHECK_EQ(TEST_ui32Sent, 0U);                   // Nothing before the first write
+
+    OS_voidComWrite(CAN_DB_INDEX_KEEP_ALIVE, aui8Data);  // Sent at once, the cycle starts here
+    UNIT_CHECK_EQ(TEST_ui32Sent, 1U);
+    TEST_voidAdvanceTo(2000U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_KEEP_ALIVE, 0U, 2001U), 11U);
+    UNIT_CHECK_EQ(TEST_stSent[1].tick, 1100U);
+    UNIT_CHECK_EQ(TEST_stSent[10].tick, 2000U);
+    UNIT_CHECK_EQ(TEST_stSent[0].length, CAN_DLC_KEEP_ALIVE);
+
+    // Writes between cycles only refresh the data
+    OS_voidComWrite(CAN_DB_INDEX_KEEP_ALIVE, aui8Data);
+    OS_voidComWrite(CAN_DB_INDEX_KEEP_ALIVE, aui8Data);
+    UNIT_CHECK_EQ(TEST_ui32Sent, 11U);
+}
+
+static void TEST_voidMixedBurst(void)
+{
+    ComStats stStats;
+
+    TEST_voidReset();
+    TEST_voidAdvanceTo(5000U);
+    TEST_voidWriteState(1U);                            // First write: 1 frame, then 2 more 20 ms apart
+    TEST_voidAdvanceTo(5100U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 5000U, 5100U), 3U);
+    UNIT_CHECK_EQ(TEST_stSent[1].tick, 5020U);
+    UNIT_CHECK_EQ(TEST_stSent[2].tick, 5040U);
+
+    // Then cyclic at 1 s, from the end of the burst
+    TEST_voidAdvanceTo(8000U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 5100U, 8000U), 2U);
+    UNIT_CHECK_EQ(TEST_stSent[3].tick, 6040U);
+
+    // An unchanged write sends nothing; a change starts a new burst at once
+    TEST_voidWriteState(1U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 8000U, 8001U), 0U);
+    TEST_voidWriteState(2U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 8000U, 8001U), 1U);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_STATE_CODE(TEST_stSent[TEST_ui32Sent - 1U].data), 2U);
+
+    // A change 5 ms after the second burst frame is merged with the next one and goes out when the gap ends, with
+    // the latest value
+    TEST_voidAdvanceTo(8025U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 8020U, 8021U), 1U);
+    TEST_voidWriteState(3U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 8025U, 8026U), 0U);
+    TEST_voidAdvanceTo(8026U);
+    TEST_voidWriteState(4U);
+    TEST_voidAdvanceTo(8040U);
+    UNIT_CHECK_EQ(TEST_ui32Count(CAN_ID_STATE, 8040U, 8041U), 1U);
+    UNIT_CHECK_EQ(CAN_UnpackRaw_STATE_CODE(TEST_stSent[TEST_ui32Sent - 1U].data), 4U);
+
+    OS_voidComGetStats(CAN_DB_INDEX_STATE, &stStats);
+    UNIT_CHECK_EQ(stStats.maxDelayTicks, 15U);         // 8025 -> 8040
+    UNIT_CHECK_EQ(stStats.sent, TEST_ui32Count(CAN_ID_STATE, 0U, 0xFFFFFFFFUL));
+}
+
+static void TEST_voidSealedBytes(void)
+{
+    uint8_t aui8Data[CAN_DLC_STATE] = {0};
+
+    TEST_voidReset();
+    TEST_voidWriteState(1U);
+    TEST_voidAdvanceTo(2000U);
+    TEST_ui32Sent = 0;
+
+    // Alive counter and checksum are left to CAN_Send: garbage there is not a change
+    CAN_PackRaw_STATE_CODE(aui8Data, 1U);
+    CAN_PackRaw_STATE_ALIVE_COUNTER(aui8Data, 9U);
+    CAN_PackRaw_STATE_CHECKSUM(aui8Data, 0xA5U);
+    OS_voidComWrite(CAN_DB_INDEX_STATE, aui8Data);
+    UNIT_CHECK_EQ(TEST_ui32Sent, 0U);
+}
+
+static void TEST_voidDirect(void)
+{
+    uint8_t aui8Data[CAN_DLC_VOLTAGE] = {0};
+    ComStats stStats;
+
+    TEST_voidReset();
+    OS_voidComWrite(CAN_DB_INDEX_VOLTAGE, aui8Data);
+    OS_voidComWrite(CAN_DB_MESSAGE_COUNT, aui8Data);   // Out of the table
+    TEST_voidAdvanceTo(3000U);
+    UNIT_CHECK_EQ(TEST_ui32Sent, 0U);
+    OS_voidComGetStats(CAN_DB_INDEX_VOLTAGE, &stStats);
+    UNIT_CHECK_EQ(stStats.written, 0U);
+}
+
+// OS_voidTempData and OS_voidCheckDTC write STATE on every 200 ms run; before, every run sent an 8-byte frame
+static void TEST_voidStateTraffic(void)
+{
+    const uint32_t ui32RunTicks = 200U;
+    const uint32_t ui32EndTick = 60000U;
+    uint32_t ui32Runs = 0;
+    uint32_t ui32Tick = 0;
+    uint32_t ui32Bits = 0;
+    uint32_t ui32OldBits = 0;
+    uint8_t ui8Code = 0;
+    ComStats stStats;
+
+    TEST_voidReset();
+    for (ui32Tick = ui32RunTicks; ui32Tick <= ui32EndTick; ui32Tick += ui32RunTicks) {
+        TEST_voidAdvanceTo(ui32Tick);
+        // 0..20 s normal, 20..30 s overheat, 30..40 s fault, then normal
+        ui8Code = (ui32Tick < 20000U) ? 0U : ((ui32Tick < 30000U) ? 1U : ((ui32Tick < 40000U) ? 2U : 0U));
+        TEST_voidWriteState(ui8Code);
+        ui32Runs++;
+    }
+    OS_voidComGetStats(CAN_DB_INDEX_STATE, &stStats);
+
+    // Frame bits without stuffing: 47 + 8 per data byte
+    ui32Bits = stStats.sent * (47U + (8U * CAN_DLC_STATE));
+    ui32OldBits = ui32Runs * (47U + (8U * 8U));
+    printf("    STATE over 60 s: %u frames, %u bit/s (was %u frames, %u bit/s), change-to-frame %u ms\n",
+           (unsigned)stStats.sent, (unsigned)(ui32Bits / 60U), (unsigned)ui32Runs, (unsigned)(ui32OldBits / 60U),
+           (unsigned)stStats.maxDelayTicks);
+
+    // Initial burst 3 + 3 changes x burst 3 + cyclic frames of the quiet periods
+    UNIT_CHECK(stStats.sent < (ui32Runs / 2U));
+    UNIT_CHECK(stStats.sent >= 12U);
+    UNIT_CHECK_EQ(stStats.maxDelayTicks, 0U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidCyclic);
+    UNIT_RUN(TEST_voidMixedBurst);
+    UNIT_RUN(TEST_voidSealedBytes);
+    UNIT_RUN(TEST_voidDirect);
+    UNIT_RUN(TEST_voidStateTraffic);
+    return UNIT_intReport("test_com");
+}
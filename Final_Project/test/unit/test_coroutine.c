@@ -0,0 +1,141 @@
+/*
+ * test_coroutine.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/coroutine.h: yield resumes after the yield, wait-until re-evaluates its condition on
+ *               every resume, sleep-for wakes on the first resume at or after its deadline (also across the 2^32 tick
+ *               wrap), spawn runs a child to its end, and a coroutine restarts after OS_CR_END.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "OS/coroutine.h"
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+volatile uint32_t g_ui32SysTickCount = 0;
+
+static OS_Coroutine TEST_stParent = OS_CR_INITIALIZER;
+static OS_Coroutine TEST_stChild = OS_CR_INITIALIZER;
+static uint32_t TEST_ui32Step = 0;
+static bool TEST_boolFlag = false;
+static uint32_t TEST_ui32ChildRuns = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static uint8_t TEST_ui8Steps(OS_Coroutine *a_ptrCr)
+{
+    OS_CR_BEGIN(a_ptrCr);
+    TEST_ui32Step = 1U;
+    OS_CR_YIELD(a_ptrCr);
+    TEST_ui32Step = 2U;
+    OS_CR_WAIT_UNTIL(a_ptrCr, TEST_boolFlag);
+    TEST_ui32Step = 3U;
+    OS_CR_SLEEP_FOR(a_ptrCr, 100U);
+    TEST_ui32Step = 4U;
+    OS_CR_END(a_ptrCr);
+}
+
+// Blinks twice, 10 ticks apart, then ends
+static uint8_t TEST_ui8Child(OS_Coroutine *a_ptrCr)
+{
+    OS_CR_BEGIN(a_ptrCr);
+    TEST_ui32ChildRuns++;
+    OS_CR_SLEEP_FOR(a_ptrCr, 10U);
+    TEST_ui32ChildRuns++;
+    OS_CR_SLEEP_FOR(a_ptrCr, 10U);
+    OS_CR_END(a_ptrCr);
+}
+
+static uint8_t TEST_ui8Parent(OS_Coroutine *a_ptrCr)
+{
+    OS_CR_BEGIN(a_ptrCr);
+    OS_CR_SPAWN(a_ptrCr, &TEST_stChild, TEST_ui8Child(&TEST_stChild));
+    TEST_ui32Step = 10U;
+    OS_CR_END(a_ptrCr);
+}
+
+static void TEST_voidPrimitives(void)
+{
+    OS_Coroutine stCr = OS_CR_INITIALIZER;
+
+    g_ui32SysTickCount = 0;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    UNIT_CHECK_EQ(TEST_ui32Step, 1U);
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    UNIT_CHECK_EQ(TEST_ui32Step, 2U);
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);     // Still waiting for the flag
+    UNIT_CHECK_EQ(TEST_ui32Step, 2U);
+
+    TEST_boolFlag = true;
+    g_ui32SysTickCount = 1000U;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    UNIT_CHECK_EQ(TEST_ui32Step, 3U);
+    g_ui32SysTickCount = 1099U;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    g_ui32SysTickCount = 1100U;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_ENDED);
+    UNIT_CHECK_EQ(TEST_ui32Step, 4U);
+    UNIT_CHECK_EQ(stCr.line, 0U);
+
+    // Restarts from the top
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    UNIT_CHECK_EQ(TEST_ui32Step, 1U);
+}
+
+static void TEST_voidSleepAcrossWrap(void)
+{
+    OS_Coroutine stCr = OS_CR_INITIALIZER;
+
+    TEST_boolFlag = true;
+    g_ui32SysTickCount = 0xFFFFFFF0UL;
+    (void)TEST_ui8Steps(&stCr);
+    (void)TEST_ui8Steps(&stCr);
+    UNIT_CHECK_EQ(TEST_ui32Step, 3U);               // Sleeping until 0x54, past the wrap
+
+    g_ui32SysTickCount = 0xFFFFFFFFUL;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    g_ui32SysTickCount = 0x53U;
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_WAITING);
+    g_ui32SysTickCount = 0x60U;                     // Resumed late: wakes at once
+    UNIT_CHECK_EQ(TEST_ui8Steps(&stCr), OS_CR_ENDED);
+}
+
+static void TEST_voidSpawn(void)
+{
+    uint32_t ui32Resumes = 0;
+
+    g_ui32SysTickCount = 0;
+    TEST_ui32Step = 0;
+    OS_CR_RESET(&TEST_stParent);
+    TEST_stChild.line = 123U;                        // Left mid-way by an earlier run: spawn starts it over
+
+    // Resumed every tick, as a 1 ms task would
+    while (TEST_ui8Parent(&TEST_stParent) == OS_CR_WAITING) {
+        g_ui32SysTickCount++;
+        ui32Resumes++;
+        if (ui32Resumes > 100U) {
+            break;
+        }
+    }
+    UNIT_CHECK_EQ(TEST_ui32ChildRuns, 2U);
+    UNIT_CHECK_EQ(TEST_ui32Step, 10U);
+    UNIT_CHECK_EQ(ui32Resumes, 20U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidPrimitives);
+    UNIT_RUN(TEST_voidSleepAcrossWrap);
+    UNIT_RUN(TEST_voidSpawn);
+    return UNIT_intReport("test_coroutine");
+}
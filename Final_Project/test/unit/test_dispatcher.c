@@ -0,0 +1,311 @@
+/*
+ * test_dispatcher.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/dispatcher.c on the fake MCU:
+ *               1) the generated task table is sorted by priority whatever the listing order;
+ *               2) the ready bitmap selects the highest priority over both words;
+ *               3) periodic releases over 60 simulated seconds match the configured periods and phase offsets;
+ *               4) releases the task could not take are counted as missed deadlines;
+ *               5) events release their tasks at once, coalesce, and the jitter statistic measures the
+ *                  event-to-activation latency;
+ *               6) utilisation and response-time analysis, and the schedulability verdict;
+ *               7) alive supervision finds a task that stopped running.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "fake.h"
+#include "OS/dispatcher.h"
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_TICK_CYCLES        50000U  // 1 ms at 50 MHz
+#define TEST_LOG_LEN            64U
+
+// Task n logs its number and spends TEST_ui32Cost[n] cycles
+#define TEST_TASK(n)            static void TEST_voidTask##n(void) { TEST_voidRun(n); }
+
+// Listed out of priority order on purpose
+#define TEST_TASK_TABLE(X) \
+    X(TEST_voidTask2, 100U, 7U, 3U, 0U,           1U) \
+    X(TEST_voidTask0, 10U,  3U, 1U, 0U,           5U) \
+    X(TEST_voidTask3, OS_PERIOD_NONE, 0U, 4U, OS_EVENT(3), 0U) \
+    X(TEST_voidTask1, 20U,  0U, 2U, OS_EVENT(3) | OS_EVENT(5), 2U)
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static uint32_t TEST_ui32Cost[OS_MAX_TASK_SLOTS];
+static uint8_t TEST_ui8Log[TEST_LOG_LEN];
+static uint32_t TEST_ui32LogLength = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidRun(uint8_t a_ui8Task)
+{
+    if (TEST_ui32LogLength < TEST_LOG_LEN) {
+        TEST_ui8Log[TEST_ui32LogLength] = a_ui8Task;
+        TEST_ui32LogLength++;
+    }
+    FAKE_voidSpend(TEST_ui32Cost[a_ui8Task]);
+}
+
+TEST_TASK(0)
+TEST_TASK(1)
+TEST_TASK(2)
+TEST_TASK(3)
+
+static const TaskConfig TEST_stTable[] = {
+    TEST_TASK_TABLE(OS_TASK_ENTRY)
+};
+static TaskControlBlock TEST_stTasks[OS_TASK_TABLE_COUNT(TEST_TASK_TABLE)];
+
+OS_STATIC_ASSERT(OS_TASK_TABLE_COUNT(TEST_TASK_TABLE) == 4U, TEST_TableCount);
+OS_STATIC_ASSERT(OS_TASK_TABLE_PRIOS(TEST_TASK_TABLE) == OS_TASK_PRIOS_EXPECTED(4U), TEST_TablePrios);
+OS_STATIC_ASSERT(OS_TASK_TABLE_TIMING_OK(TEST_TASK_TABLE), TEST_TableTiming);
+
+// A table of event-only tasks filling both bitmap words
+static TaskConfig TEST_stWideTable[OS_MAX_TASK_SLOTS];
+static TaskControlBlock TEST_stWideTasks[OS_MAX_TASK_SLOTS];
+
+static void TEST_voidReset(void)
+{
+    memset(TEST_ui32Cost, 0, sizeof(TEST_ui32Cost));
+    TEST_ui32LogLength = 0;
+    (void)OS_ui32TakeEvents(0xFFFFFFFFUL);
+    OS_voidDispatcherInit(TEST_stTable, TEST_stTasks, OS_TASK_TABLE_COUNT(TEST_TASK_TABLE), 0U);
+}
+
+static void TEST_voidWideTask(void)
+{
+}
+
+static void TEST_voidTableOrder(void)
+{
+    UNIT_CHECK(TEST_stTable[0].taskFunction == TEST_voidTask0);
+    UNIT_CHECK(TEST_stTable[1].taskFunction == TEST_voidTask1);
+    UNIT_CHECK(TEST_stTable[2].taskFunction == TEST_voidTask2);
+    UNIT_CHECK(TEST_stTable[3].taskFunction == TEST_voidTask3);
+    UNIT_CHECK_EQ(TEST_stTable[0].priority, 1U);
+    UNIT_CHECK_EQ(TEST_stTable[3].priority, 4U);
+    UNIT_CHECK_EQ(TEST_stTable[1].eventMask, OS_EVENT(3) | OS_EVENT(5));
+    UNIT_CHECK_EQ(TEST_stTable[2].offsetTicks, 7U);
+}
+
+static void TEST_voidHighestReady(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < OS_MAX_TASK_SLOTS; i++) {
+        TEST_stWideTable[i].taskFunction = TEST_voidWideTask;
+        TEST_stWideTable[i].periodTicks = OS_PERIOD_NONE;
+        TEST_stWideTable[i].priority = (uint8_t)(i + 1U);
+    }
+    OS_voidDispatcherInit(TEST_stWideTable, TEST_stWideTasks, OS_MAX_TASK_SLOTS, 0U);
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), OS_NO_TASK);
+
+    OS_voidSetTaskReady(63U);
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 63U);
+    OS_voidSetTaskReady(37U);
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 37U);
+    OS_voidSetTaskReady(31U);
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 31U);
+    OS_voidSetTaskReady(0U);
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 0U);
+
+    OS_voidDispatch();
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), OS_NO_TASK);
+    UNIT_CHECK_EQ(TEST_stWideTasks[0].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stWideTasks[31].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stWideTasks[37].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stWideTasks[63].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stWideTasks[1].stats.runCount, 0U);
+}
+
+// 60 s of 1 ms ticks, dispatching after every tick
+static void TEST_voidPeriodicRelease(void)
+{
+    uint32_t ui32Tick = 0;
+
+    TEST_voidReset();
+    UNIT_CHECK_EQ(OS_ui32TicksToNextRelease(), 13U);
+
+    for (ui32Tick = 1U; ui32Tick <= 60000U; ui32Tick++) {
+        OS_voidDispatcherTick(ui32Tick);
+        if (ui32Tick == 13U) {
+            UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 0U);
+        }
+        OS_voidDispatch();
+        if (ui32Tick == 13U) {
+            UNIT_CHECK_EQ(TEST_stTasks[0].lastRunTick, 13U);
+            UNIT_CHECK_EQ(OS_ui32TicksToNextRelease(), 7U);     // Task 1 at 20
+        }
+    }
+
+    // Releases at period + offset + k * period, up to 60000
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.runCount, ((60000U - 13U) / 10U) + 1U);
+    UNIT_CHECK_EQ(TEST_stTasks[1].stats.runCount, 60000U / 20U);
+    UNIT_CHECK_EQ(TEST_stTasks[2].stats.runCount, ((60000U - 107U) / 100U) + 1U);
+    UNIT_CHECK_EQ(TEST_stTasks[3].stats.runCount, 0U);
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.missedDeadlines, 0U);
+    UNIT_CHECK_EQ(TEST_stTasks[1].stats.missedDeadlines, 0U);
+    UNIT_CHECK_EQ(TEST_stTasks[2].stats.missedDeadlines, 0U);
+}
+
+static void TEST_voidMissedDeadlines(void)
+{
+    TEST_voidReset();
+
+    OS_voidDispatcherTick(13U);
+    OS_voidDispatcherTick(23U);         // Still ready from 13
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.missedDeadlines, 1U);
+    OS_voidDispatcherTick(55U);         // 33, 43 and 53 reached at once
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.missedDeadlines, 4U);
+    UNIT_CHECK_EQ(TEST_stTasks[0].nextReleaseTick, 63U);
+
+    OS_voidDispatch();
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.runCount, 1U);
+
+    // A late tick after the task ran: the release it gets is not a miss, the one jumped over is
+    OS_voidDispatcherTick(73U);
+    UNIT_CHECK_EQ(TEST_stTasks[0].stats.missedDeadlines, 5U);
+}
+
+static void TEST_voidEventRelease(void)
+{
+    TEST_voidReset();
+
+    OS_voidSetEvent(OS_EVENT(3));
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), 1U);      // Task 1 before task 3
+    OS_voidSetEvent(OS_EVENT(3) | OS_EVENT(5));     // Coalesced with the first
+    FAKE_voidSpend(1000U);                          // Latency before the dispatcher gets the CPU
+    OS_voidDispatch();
+
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 2U);
+    UNIT_CHECK_EQ(TEST_ui8Log[0], 1U);
+    UNIT_CHECK_EQ(TEST_ui8Log[1], 3U);
+    UNIT_CHECK_EQ(TEST_stTasks[1].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stTasks[3].stats.runCount, 1U);
+    UNIT_CHECK_EQ(TEST_stTasks[3].stats.missedDeadlines, 0U);
+
+    // Released at the first event: the latency is the spend above plus the calls in between
+    UNIT_CHECK(TEST_stTasks[1].stats.maxJitterCycles >= 1000U);
+    UNIT_CHECK(TEST_stTasks[1].stats.maxJitterCycles < 1200U);
+
+    UNIT_CHECK_EQ(OS_ui32TakeEvents(OS_EVENT(5)), OS_EVENT(5));
+    UNIT_CHECK_EQ(OS_ui32TakeEvents(OS_EVENT(3) | OS_EVENT(5)), OS_EVENT(3));
+    UNIT_CHECK_EQ(OS_ui32TakeEvents(0xFFFFFFFFUL), 0U);
+
+    // An event no task waits for releases nothing
+    OS_voidSetEvent(OS_EVENT(9));
+    UNIT_CHECK_EQ(OS_ui8HighestReadyTask(), OS_NO_TASK);
+}
+
+static void TEST_voidExecutionStats(void)
+{
+    TEST_voidReset();
+
+    TEST_ui32Cost[0] = 3000U;
+    OS_voidDispatcherTick(13U);
+    OS_voidDispatch();
+    TEST_ui32Cost[0] = 5000U;
+    OS_voidDispatcherTick(23U);
+    OS_voidDispatch();
+
+    // The cycle counter also counts the calls around the task body
+    UNIT_CHECK(TEST_stTasks[0].stats.minCycles >= 3000U);
+    UNIT_CHECK(TEST_stTasks[0].stats.minCycles < 3100U);
+    UNIT_CHECK(TEST_stTasks[0].stats.maxCycles >= 5000U);
+    UNIT_CHECK(TEST_stTasks[0].stats.maxCycles < 5100U);
+    UNIT_CHECK_EQ(OS_ui32TaskMeanCycles(&TEST_stTasks[0]),
+                  (TEST_stTasks[0].stats.minCycles + TEST_stTasks[0].stats.maxCycles) / 2U);
+}
+
+static void TEST_voidResponseTime(void)
+{
+    TEST_voidReset();
+
+    TEST_stTasks[0].stats.maxCycles = 5000U;        // Every 10 ms
+    TEST_stTasks[1].stats.maxCycles = 10000U;       // Every 20 ms
+    TEST_stTasks[2].stats.maxCycles = 20000U;       // Every 100 ms
+    TEST_stTasks[3].stats.maxCycles = 1000U;        // Event-only: blocks, not counted in the load
+
+    UNIT_CHECK_EQ(OS_ui32UtilizationPermille(TEST_TICK_CYCLES), 10U + 10U + 4U);
+
+    // Blocked by the longest lower-priority run, then the higher priorities once each
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(0U, TEST_TICK_CYCLES, 0U), 20000U + 5000U);
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(1U, TEST_TICK_CYCLES, 0U), 20000U + 5000U + 10000U);
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(2U, TEST_TICK_CYCLES, 0U), 1000U + 5000U + 10000U + 20000U);
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(3U, TEST_TICK_CYCLES, 0U), 0U);
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(2U, TEST_TICK_CYCLES, 30000U), 30000U + 5000U + 10000U + 20000U);
+    UNIT_CHECK(OS_boolIsSchedulable(TEST_TICK_CYCLES, 0U));
+
+    // A 12 ms run of the lowest periodic task blocks the 10 ms one past its deadline
+    TEST_stTasks[2].stats.maxCycles = 600000U;
+    UNIT_CHECK_EQ(OS_ui32TaskResponseCycles(0U, TEST_TICK_CYCLES, 0U), OS_RESPONSE_UNBOUNDED);
+    UNIT_CHECK(!OS_boolIsSchedulable(TEST_TICK_CYCLES, 0U));
+
+    // Overload
+    TEST_stTasks[2].stats.maxCycles = 20000U;
+    TEST_stTasks[0].stats.maxCycles = 600000U;
+    UNIT_CHECK(OS_ui32UtilizationPermille(TEST_TICK_CYCLES) > 1000U);
+    UNIT_CHECK(!OS_boolIsSchedulable(TEST_TICK_CYCLES, 0U));
+}
+
+static void TEST_voidAliveSupervision(void)
+{
+    uint32_t ui32Tick = 0;
+
+    TEST_voidReset();
+    (void)OS_ui8CheckAlive();
+
+    // One 100 ms window: task 0 runs 10 times, task 1 5 times, task 2 once
+    for (ui32Tick = 1U; ui32Tick <= 100U; ui32Tick++) {
+        OS_voidDispatcherTick(ui32Tick);
+        OS_voidDispatch();
+    }
+    (void)OS_ui8CheckAlive();
+    for (ui32Tick = 101U; ui32Tick <= 200U; ui32Tick++) {
+        OS_voidDispatcherTick(ui32Tick);
+        OS_voidDispatch();
+    }
+    UNIT_CHECK_EQ(OS_ui8CheckAlive(), OS_NO_TASK);
+
+    // Task 1 stops
+    TEST_stTasks[1].isEnabled = 0U;
+    for (ui32Tick = 201U; ui32Tick <= 300U; ui32Tick++) {
+        OS_voidDispatcherTick(ui32Tick);
+        OS_voidDispatch();
+    }
+    UNIT_CHECK_EQ(OS_ui8CheckAlive(), OS_NO_TASK);     // A disabled task is not supervised
+    TEST_stTasks[1].isEnabled = 1U;
+
+    // The dispatcher hangs in task 0: every supervised task misses, the highest priority is reported
+    UNIT_CHECK_EQ(OS_ui8CheckAlive(), 0U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidTableOrder);
+    UNIT_RUN(TEST_voidHighestReady);
+    UNIT_RUN(TEST_voidPeriodicRelease);
+    UNIT_RUN(TEST_voidMissedDeadlines);
+    UNIT_RUN(TEST_voidEventRelease);
+    UNIT_RUN(TEST_voidExecutionStats);
+    UNIT_RUN(TEST_voidResponseTime);
+    UNIT_RUN(TEST_voidAliveSupervision);
+    return UNIT_intReport("test_dispatcher");
+}
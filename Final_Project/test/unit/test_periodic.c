@@ -0,0 +1,111 @@
+/*
+ * test_periodic.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/periodic.h: the catch-up and skip policies, deadlines across the 2^32 tick wrap,
+ *               and a keep-alive sender polled with random loop latency, which must not lose a frame where the old
+ *               "tick % 100 == 0" gating loses most of them.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdlib.h>
+#include "unit.h"
+#include "OS/periodic.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_KEEP_ALIVE_PERIOD  100U
+#define TEST_RUN_TICKS          3600000U    // One hour of 1 ms ticks
+#define TEST_MAX_LATENCY        30U         // Ticks between two loop passes, at most
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidCatchUp(void)
+{
+    uint32_t ui32Deadline = 0;
+    uint32_t ui32Count = 0;
+
+    OS_voidPeriodicStart(&ui32Deadline, 10U, 100U);
+    UNIT_CHECK(!OS_boolPeriodicCatchUp(&ui32Deadline, 10U, 109U));
+    UNIT_CHECK(OS_boolPeriodicCatchUp(&ui32Deadline, 10U, 110U));
+    UNIT_CHECK(!OS_boolPeriodicCatchUp(&ui32Deadline, 10U, 110U));
+
+    // 45 ticks late: the five occurrences due come one per call, then it waits again
+    while (OS_boolPeriodicCatchUp(&ui32Deadline, 10U, 165U)) {
+        ui32Count++;
+    }
+    UNIT_CHECK_EQ(ui32Count, 5U);
+    UNIT_CHECK_EQ(ui32Deadline, 170U);
+}
+
+static void TEST_voidSkip(void)
+{
+    uint32_t ui32Deadline = 0;
+
+    OS_voidPeriodicStart(&ui32Deadline, 10U, 100U);
+    UNIT_CHECK_EQ(OS_ui32PeriodicSkip(&ui32Deadline, 10U, 105U), 0U);
+    UNIT_CHECK_EQ(OS_ui32PeriodicSkip(&ui32Deadline, 10U, 110U), 1U);
+    UNIT_CHECK_EQ(ui32Deadline, 120U);
+
+    // Late by 35: one occurrence standing for four deadlines, back on the raster
+    UNIT_CHECK_EQ(OS_ui32PeriodicSkip(&ui32Deadline, 10U, 155U), 4U);
+    UNIT_CHECK_EQ(ui32Deadline, 160U);
+    UNIT_CHECK(!OS_boolPeriodicIsDue(ui32Deadline, 159U));
+}
+
+static void TEST_voidWrap(void)
+{
+    uint32_t ui32Deadline = 0;
+
+    OS_voidPeriodicStart(&ui32Deadline, 100U, 0xFFFFFFC0UL);
+    UNIT_CHECK_EQ(ui32Deadline, 0x24U);
+    UNIT_CHECK(!OS_boolPeriodicIsDue(ui32Deadline, 0xFFFFFFFFUL));
+    UNIT_CHECK(OS_boolPeriodicIsDue(ui32Deadline, 0x24U));
+    UNIT_CHECK_EQ(OS_ui32PeriodicSkip(&ui32Deadline, 100U, 0x30U), 1U);
+    UNIT_CHECK_EQ(ui32Deadline, 0x88U);
+}
+
+static void TEST_voidRandomLatency(void)
+{
+    uint32_t ui32Now = 0;
+    uint32_t ui32Deadline = 0;
+    uint32_t ui32Sent = 0;
+    uint32_t ui32SentModulo = 0;
+    uint32_t ui32Expected = 0;
+
+    srand(1U);
+    OS_voidPeriodicStart(&ui32Deadline, TEST_KEEP_ALIVE_PERIOD, ui32Now);
+    while (ui32Now < TEST_RUN_TICKS) {
+        ui32Now += 1U + ((uint32_t)rand() % TEST_MAX_LATENCY);
+        while (OS_boolPeriodicCatchUp(&ui32Deadline, TEST_KEEP_ALIVE_PERIOD, ui32Now)) {
+            ui32Sent++;
+        }
+        if ((ui32Now % TEST_KEEP_ALIVE_PERIOD) == 0U) {
+            ui32SentModulo++;
+        }
+    }
+    ui32Expected = ui32Now / TEST_KEEP_ALIVE_PERIOD;
+
+    printf("    keep-alives due %u: sent %u with catch-up, %u with modulo gating\n", (unsigned)ui32Expected,
+           (unsigned)ui32Sent, (unsigned)ui32SentModulo);
+    UNIT_CHECK_EQ(ui32Sent, ui32Expected);
+    UNIT_CHECK(ui32SentModulo < (ui32Expected / 2U));
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidCatchUp);
+    UNIT_RUN(TEST_voidSkip);
+    UNIT_RUN(TEST_voidWrap);
+    UNIT_RUN(TEST_voidRandomLatency);
+    return UNIT_intReport("test_periodic");
+}
@@ -0,0 +1,274 @@
+/*
+ * test_spsc.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/spsc.c and OS/atomic.h:
+ *               1) ring order, a full ring refusing and counting pushes, and head/tail running across 2^32;
+ *               2) stress with two pthreads as producer and consumer, the consumer checking every element;
+ *               3) stress of the LDREX/STREX read-modify-write loops from several threads (the host port models
+ *                  the exclusive monitor, see stubs/host_port.h);
+ *               4) a seqlock writer against readers that must never see a torn copy.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <pthread.h>
+#include <sched.h>
+#include "unit.h"
+#include "OS/spsc.h"
+#include "OS/atomic.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_RING_LEN           8U
+#define TEST_STRESS_ELEMENTS    2000000U
+#define TEST_ATOMIC_THREADS     4U
+#define TEST_ATOMIC_ADDS        200000U
+#define TEST_SEQLOCK_WRITES     500000U
+
+
+/***********************************************
+ * Type Declarations (enums, structs and unions)
+ ***********************************************/
+typedef struct {
+    uint32_t sequence;
+    uint32_t check;             // ~sequence
+    uint64_t stamp;             // sequence * 3
+} TEST_Element;
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static TEST_Element TEST_stBuffer[TEST_RING_LEN];
+static SpscRing TEST_stRing;
+static uint32_t TEST_ui32ConsumerErrors = 0;
+
+static volatile uint32_t TEST_ui32Counter = 0;
+static volatile uint32_t TEST_ui32Bits = 0;
+
+static Seqlock TEST_stLock = OS_SEQLOCK_INITIALIZER;
+static TEST_Element TEST_stShared;
+static volatile bool TEST_boolWriterDone = false;
+static uint32_t TEST_ui32TornReads = 0;
+static uint32_t TEST_ui32Retries = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static TEST_Element TEST_stElement(uint32_t a_ui32Sequence)
+{
+    TEST_Element stElement;
+
+    stElement.sequence = a_ui32Sequence;
+    stElement.check = ~a_ui32Sequence;
+    stElement.stamp = (uint64_t)a_ui32Sequence * 3U;
+    return stElement;
+}
+
+static bool TEST_boolIntact(const TEST_Element *a_ptrElement)
+{
+    return (a_ptrElement->check == ~a_ptrElement->sequence) &&
+           (a_ptrElement->stamp == ((uint64_t)a_ptrElement->sequence * 3U));
+}
+
+static void TEST_voidRingOrder(void)
+{
+    TEST_Element stIn;
+    TEST_Element stOut;
+    uint32_t i = 0;
+
+    OS_voidSpscInit(&TEST_stRing, TEST_stBuffer, sizeof(TEST_Element), TEST_RING_LEN);
+    UNIT_CHECK(!OS_boolSpscPop(&TEST_stRing, &stOut));
+
+    for (i = 0; i < TEST_RING_LEN; i++) {
+        stIn = TEST_stElement(i);
+        UNIT_CHECK(OS_boolSpscPush(&TEST_stRing, &stIn));
+    }
+    stIn = TEST_stElement(99U);
+    UNIT_CHECK(!OS_boolSpscPush(&TEST_stRing, &stIn));
+    UNIT_CHECK_EQ(TEST_stRing.dropped, 1U);
+    UNIT_CHECK_EQ(OS_ui32SpscCount(&TEST_stRing), TEST_RING_LEN);
+
+    for (i = 0; i < TEST_RING_LEN; i++) {
+        UNIT_CHECK(OS_boolSpscPop(&TEST_stRing, &stOut));
+        UNIT_CHECK_EQ(stOut.sequence, i);
+    }
+    UNIT_CHECK(!OS_boolSpscPop(&TEST_stRing, &stOut));
+    UNIT_CHECK_EQ(OS_ui32SpscCount(&TEST_stRing), 0U);
+}
+
+static void TEST_voidIndexWrap(void)
+{
+    TEST_Element stIn;
+    TEST_Element stOut;
+    uint32_t i = 0;
+
+    OS_voidSpscInit(&TEST_stRing, TEST_stBuffer, sizeof(TEST_Element), TEST_RING_LEN);
+    TEST_stRing.head = 0xFFFFFFFDUL;
+    TEST_stRing.tail = 0xFFFFFFFDUL;
+
+    for (i = 0; i < TEST_RING_LEN; i++) {
+        stIn = TEST_stElement(i);
+        UNIT_CHECK(OS_boolSpscPush(&TEST_stRing, &stIn));
+    }
+    UNIT_CHECK_EQ(OS_ui32SpscCount(&TEST_stRing), TEST_RING_LEN);
+    UNIT_CHECK(!OS_boolSpscPush(&TEST_stRing, &stIn));
+    for (i = 0; i < TEST_RING_LEN; i++) {
+        UNIT_CHECK(OS_boolSpscPop(&TEST_stRing, &stOut));
+        UNIT_CHECK_EQ(stOut.sequence, i);
+    }
+    UNIT_CHECK_EQ(TEST_stRing.tail, 5U);
+}
+
+static void *TEST_ptrProducer(void *a_ptrArg)
+{
+    TEST_Element stIn;
+    uint32_t i = 0;
+
+    (void)a_ptrArg;
+    for (i = 0; i < TEST_STRESS_ELEMENTS; i++) {
+        stIn = TEST_stElement(i);
+        while (!OS_boolSpscPush(&TEST_stRing, &stIn)) {
+            sched_yield();
+        }
+    }
+    return 0;
+}
+
+static void *TEST_ptrConsumer(void *a_ptrArg)
+{
+    TEST_Element stOut;
+    uint32_t ui32Expected = 0;
+
+    (void)a_ptrArg;
+    while (ui32Expected < TEST_STRESS_ELEMENTS) {
+        if (!OS_boolSpscPop(&TEST_stRing, &stOut)) {
+            sched_yield();
+            continue;
+        }
+        if ((stOut.sequence != ui32Expected) || !TEST_boolIntact(&stOut)) {
+            TEST_ui32ConsumerErrors++;
+        }
+        ui32Expected++;
+    }
+    return 0;
+}
+
+static void TEST_voidRingStress(void)
+{
+    pthread_t stProducer;
+    pthread_t stConsumer;
+
+    OS_voidSpscInit(&TEST_stRing, TEST_stBuffer, sizeof(TEST_Element), TEST_RING_LEN);
+    pthread_create(&stConsumer, 0, TEST_ptrConsumer, 0);
+    pthread_create(&stProducer, 0, TEST_ptrProducer, 0);
+    pthread_join(stProducer, 0);
+    pthread_join(stConsumer, 0);
+
+    printf("    %u elements through a ring of %u, %u refused pushes retried\n", (unsigned)TEST_STRESS_ELEMENTS,
+           (unsigned)TEST_RING_LEN, (unsigned)TEST_stRing.dropped);
+    UNIT_CHECK_EQ(TEST_ui32ConsumerErrors, 0U);
+    UNIT_CHECK_EQ(TEST_stRing.head, TEST_STRESS_ELEMENTS);
+    UNIT_CHECK_EQ(TEST_stRing.tail, TEST_STRESS_ELEMENTS);
+}
+
+static void *TEST_ptrAtomicWorker(void *a_ptrArg)
+{
+    uint32_t ui32Bit = (uint32_t)(uintptr_t)a_ptrArg;
+    uint32_t ui32Old = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < TEST_ATOMIC_ADDS; i++) {
+        (void)OS_ui32AtomicFetchAdd(&TEST_ui32Counter, 1U);
+        (void)OS_ui32AtomicFetchOr(&TEST_ui32Bits, 1UL << ui32Bit);
+        (void)OS_ui32AtomicFetchAnd(&TEST_ui32Bits, ~(1UL << ui32Bit));
+        do {
+            ui32Old = TEST_ui32Counter;
+        } while (!OS_boolAtomicCompareExchange(&TEST_ui32Counter, ui32Old, ui32Old + 2U));
+    }
+    (void)OS_ui32AtomicFetchOr(&TEST_ui32Bits, 1UL << ui32Bit);
+    return 0;
+}
+
+static void TEST_voidAtomicStress(void)
+{
+    pthread_t stThread[TEST_ATOMIC_THREADS];
+    uint32_t i = 0;
+
+    TEST_ui32Counter = 0;
+    TEST_ui32Bits = 0;
+    for (i = 0; i < TEST_ATOMIC_THREADS; i++) {
+        pthread_create(&stThread[i], 0, TEST_ptrAtomicWorker, (void *)(uintptr_t)i);
+    }
+    for (i = 0; i < TEST_ATOMIC_THREADS; i++) {
+        pthread_join(stThread[i], 0);
+    }
+
+    // Every add survived, and no thread's OR or AND wiped another thread's bit
+    UNIT_CHECK_EQ(TEST_ui32Counter, TEST_ATOMIC_THREADS * TEST_ATOMIC_ADDS * 3U);
+    UNIT_CHECK_EQ(TEST_ui32Bits, (1UL << TEST_ATOMIC_THREADS) - 1UL);
+    UNIT_CHECK_EQ(OS_ui32AtomicExchange(&TEST_ui32Bits, 0U), (1UL << TEST_ATOMIC_THREADS) - 1UL);
+    UNIT_CHECK_EQ(TEST_ui32Bits, 0U);
+}
+
+static void *TEST_ptrSeqlockWriter(void *a_ptrArg)
+{
+    uint32_t i = 0;
+
+    (void)a_ptrArg;
+    for (i = 1U; i <= TEST_SEQLOCK_WRITES; i++) {
+        OS_voidSeqlockWriteBegin(&TEST_stLock);
+        TEST_stShared.sequence = i;
+        TEST_stShared.stamp = (uint64_t)i * 3U;
+        TEST_stShared.check = ~i;
+        OS_voidSeqlockWriteEnd(&TEST_stLock);
+    }
+    TEST_boolWriterDone = true;
+    return 0;
+}
+
+static void TEST_voidSeqlockStress(void)
+{
+    pthread_t stWriter;
+    TEST_Element stCopy;
+    uint32_t ui32Sequence = 0;
+    uint32_t ui32Last = 0;
+
+    TEST_stShared = TEST_stElement(0U);
+    pthread_create(&stWriter, 0, TEST_ptrSeqlockWriter, 0);
+    while (!TEST_boolWriterDone) {
+        do {
+            ui32Sequence = OS_ui32SeqlockReadBegin(&TEST_stLock);
+            stCopy = TEST_stShared;
+            TEST_ui32Retries++;
+        } while (OS_boolSeqlockReadRetry(&TEST_stLock, ui32Sequence));
+        TEST_ui32Retries--;
+        if (!TEST_boolIntact(&stCopy) || (stCopy.sequence < ui32Last)) {
+            TEST_ui32TornReads++;
+        }
+        ui32Last = stCopy.sequence;
+    }
+    pthread_join(stWriter, 0);
+
+    printf("    %u writes, %u reads retried\n", (unsigned)TEST_SEQLOCK_WRITES, (unsigned)TEST_ui32Retries);
+    UNIT_CHECK_EQ(TEST_ui32TornReads, 0U);
+    UNIT_CHECK_EQ(TEST_stLock.sequence, 2U * TEST_SEQLOCK_WRITES);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidRingOrder);
+    UNIT_RUN(TEST_voidIndexWrap);
+    UNIT_RUN(TEST_voidRingStress);
+    UNIT_RUN(TEST_voidAtomicStress);
+    UNIT_RUN(TEST_voidSeqlockStress);
+    return UNIT_intReport("test_spsc");
+}
@@ -0,0 +1,183 @@
+/*
+ * test_swtimer.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/swtimer.c: expiry ticks of one-shot and periodic timers, stop and restart, the
+ *               order of timers expiring on the same tick, a late service that must not make periodic timers drift,
+ *               the next-expiry query of the idle path, and the 2^32 tick wrap.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "OS/swtimer.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_LOG_LEN            64U
+#define TEST_CALLBACK(n)        static void TEST_voidExpired##n(void) { TEST_voidLog(n); }
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static uint32_t TEST_ui32Now = 0;
+static uint8_t TEST_ui8LogTimer[TEST_LOG_LEN];
+static uint32_t TEST_ui32LogTick[TEST_LOG_LEN];
+static uint32_t TEST_ui32LogLength = 0;
+static SoftTimer TEST_stTimer[4];
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidLog(uint8_t a_ui8Timer)
+{
+    if (TEST_ui32LogLength < TEST_LOG_LEN) {
+        TEST_ui8LogTimer[TEST_ui32LogLength] = a_ui8Timer;
+        TEST_ui32LogTick[TEST_ui32LogLength] = TEST_ui32Now;
+        TEST_ui32LogLength++;
+    }
+}
+
+TEST_CALLBACK(0)
+TEST_CALLBACK(1)
+TEST_CALLBACK(2)
+TEST_CALLBACK(3)
+
+// One tick and one scheduler loop pass
+static void TEST_voidAdvance(uint32_t a_ui32Ticks)
+{
+    while (a_ui32Ticks != 0U) {
+        TEST_ui32Now++;
+        OS_voidTimerTick(TEST_ui32Now);
+        OS_voidTimerService();
+        a_ui32Ticks--;
+    }
+}
+
+static void TEST_voidReset(uint32_t a_ui32Now)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < 4U; i++) {
+        OS_voidTimerStop(&TEST_stTimer[i]);
+    }
+    TEST_ui32Now = a_ui32Now;
+    OS_voidTimerTick(TEST_ui32Now);
+    OS_voidTimerService();
+    TEST_ui32LogLength = 0;
+    OS_voidTimerCreate(&TEST_stTimer[0], TEST_voidExpired0, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&TEST_stTimer[1], TEST_voidExpired1, 10U);
+    OS_voidTimerCreate(&TEST_stTimer[2], TEST_voidExpired2, OS_TIMER_ONE_SHOT);
+    OS_voidTimerCreate(&TEST_stTimer[3], TEST_voidExpired3, OS_TIMER_ONE_SHOT);
+}
+
+static void TEST_voidOneShot(void)
+{
+    TEST_voidReset(1000U);
+
+    UNIT_CHECK_EQ(OS_ui32TicksToNextExpiry(), OS_TIMER_NONE_ACTIVE);
+    OS_voidTimerStart(&TEST_stTimer[0], 5U);
+    UNIT_CHECK(OS_boolTimerIsActive(&TEST_stTimer[0]));
+    UNIT_CHECK_EQ(OS_ui32TicksToNextExpiry(), 5U);
+
+    TEST_voidAdvance(4U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 0U);
+    UNIT_CHECK_EQ(OS_ui32TicksToNextExpiry(), 1U);
+    TEST_voidAdvance(1U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 1U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[0], 1005U);
+    UNIT_CHECK(!OS_boolTimerIsActive(&TEST_stTimer[0]));
+    TEST_voidAdvance(20U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 1U);
+}
+
+static void TEST_voidPeriodic(void)
+{
+    TEST_voidReset(0U);
+
+    OS_voidTimerStart(&TEST_stTimer[1], 3U);
+    TEST_voidAdvance(35U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 4U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[0], 3U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[1], 13U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[3], 33U);
+
+    // A service 4 ticks after the expiry at 43 fires once and keeps the raster
+    TEST_ui32Now += 12U;
+    OS_voidTimerTick(TEST_ui32Now);
+    OS_voidTimerService();
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 5U);
+    UNIT_CHECK_EQ(OS_ui32TicksToNextExpiry(), 6U);     // 53, not 57
+    TEST_voidAdvance(6U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 6U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[5], 53U);
+}
+
+static void TEST_voidStopRestart(void)
+{
+    TEST_voidReset(0U);
+
+    OS_voidTimerStart(&TEST_stTimer[0], 10U);
+    OS_voidTimerStart(&TEST_stTimer[2], 20U);
+    OS_voidTimerStart(&TEST_stTimer[3], 30U);
+    TEST_voidAdvance(5U);
+
+    OS_voidTimerStop(&TEST_stTimer[0]);             // The others keep their expiry
+    OS_voidTimerStop(&TEST_stTimer[0]);
+    OS_voidTimerStart(&TEST_stTimer[3], 5U);        // Restart: from now, not from the first start
+    UNIT_CHECK_EQ(OS_ui32TicksToNextExpiry(), 5U);
+
+    TEST_voidAdvance(30U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 2U);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[0], 3U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[0], 10U);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[1], 2U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[1], 20U);
+}
+
+static void TEST_voidSameTick(void)
+{
+    TEST_voidReset(0U);
+
+    // Equal expiries fire in start order
+    OS_voidTimerStart(&TEST_stTimer[3], 8U);
+    OS_voidTimerStart(&TEST_stTimer[0], 8U);
+    OS_voidTimerStart(&TEST_stTimer[2], 8U);
+    TEST_voidAdvance(8U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 3U);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[0], 3U);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[1], 0U);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[2], 2U);
+}
+
+static void TEST_voidTickWrap(void)
+{
+    TEST_voidReset(0xFFFFFFFAUL);
+
+    OS_voidTimerStart(&TEST_stTimer[1], 4U);        // 0xFFFFFFFE, then every 10 across the wrap
+    OS_voidTimerStart(&TEST_stTimer[0], 12U);       // 6
+    TEST_voidAdvance(20U);
+    UNIT_CHECK_EQ(TEST_ui32LogLength, 3U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[0], 0xFFFFFFFEUL);
+    UNIT_CHECK_EQ(TEST_ui8LogTimer[1], 0U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[1], 6U);
+    UNIT_CHECK_EQ(TEST_ui32LogTick[2], 8U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidOneShot);
+    UNIT_RUN(TEST_voidPeriodic);
+    UNIT_RUN(TEST_voidStopRestart);
+    UNIT_RUN(TEST_voidSameTick);
+    UNIT_RUN(TEST_voidTickWrap);
+    return UNIT_intReport("test_swtimer");
+}
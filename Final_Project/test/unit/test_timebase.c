@@ -0,0 +1,88 @@
+/*
+ * test_timebase.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/timebase.c on the fake MCU: the count starts at zero, never goes back, crosses the
+ *               2^32-cycle boundary (86 s at 50 MHz) without a wrap, and the microsecond and second conversions are
+ *               exact over a simulated day.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include "unit.h"
+#include "fake.h"
+#include "OS/timebase.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_STEP_CYCLES        1000000000U     // 20 s at 50 MHz
+#define TEST_DAY_STEPS          4320U           // 24 h of steps
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidStart(void)
+{
+    uint64_t ui64First = 0;
+    uint64_t ui64Second = 0;
+
+    UNIT_CHECK_EQ(OS_ui64TimeCycles(), 0U);       // Not started
+    OS_voidTimeBaseInit();
+    ui64First = OS_ui64TimeCycles();
+    ui64Second = OS_ui64TimeCycles();
+    UNIT_CHECK(ui64First < 100U);
+    UNIT_CHECK(ui64Second > ui64First);             // Every driverlib call costs cycles on the fake
+
+    FAKE_voidSpend(FAKE_CPU_HZ / 1000U);
+    UNIT_CHECK(OS_ui64TimeUs() >= 1000U);
+    UNIT_CHECK(OS_ui64TimeUs() < 1010U);
+}
+
+static void TEST_voidNoWrap(void)
+{
+    uint64_t ui64Before = OS_ui64TimeCycles();
+    uint64_t ui64After = 0;
+    uint32_t i = 0;
+
+    // Past 2^32 cycles: a 32-bit count would have wrapped four times
+    for (i = 0; i < 20U; i++) {
+        FAKE_voidSpend(TEST_STEP_CYCLES);
+        ui64After = OS_ui64TimeCycles();
+        UNIT_CHECK(ui64After > ui64Before);
+        ui64Before = ui64After;
+    }
+    UNIT_CHECK(ui64After > (4ULL << 32));
+}
+
+static void TEST_voidDay(void)
+{
+    uint64_t ui64Start = OS_ui64TimeUs();
+    uint64_t ui64End = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < TEST_DAY_STEPS; i++) {
+        FAKE_voidSpend(TEST_STEP_CYCLES);
+    }
+    ui64End = OS_ui64TimeUs();
+
+    // 86400 s, plus the cycles of the two reads
+    UNIT_CHECK_EQ(OS_ui32UsToSeconds(ui64End - ui64Start), 86400U);
+    UNIT_CHECK_EQ(OS_ui64UsToCycles(1000U), FAKE_CPU_HZ / 1000U);
+    UNIT_CHECK_EQ(OS_ui64UsToCycles(86400ULL * OS_TIMEBASE_US_PER_S), 86400ULL * FAKE_CPU_HZ);
+    UNIT_CHECK_EQ(OS_ui32UsToSeconds(999999U), 0U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidStart);
+    UNIT_RUN(TEST_voidNoWrap);
+    UNIT_RUN(TEST_voidDay);
+    return UNIT_intReport("test_timebase");
+}
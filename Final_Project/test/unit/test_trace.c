@@ -0,0 +1,148 @@
+/*
+ * test_trace.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/trace.c on the fake MCU: the ring keeps the most recent OS_TRACE_EVENTS events and
+ *               the export counts the overwritten ones; the export is Chrome trace-event JSON with one event per line,
+ *               timestamps in microseconds from the first event, and every line within OS_TRACE_LINE_LEN; recording
+ *               restarts with an empty buffer after the export.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include <stdlib.h>
+#include "unit.h"
+#include "fake.h"
+#include "OS/trace.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_EVENTS             200U
+#define TEST_GAP_CYCLES         500U            // 10 us between two events
+#define TEST_OUTPUT_LEN         32768U
+#define TEST_HEADER_LINES       4U
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static char TEST_chOutput[TEST_OUTPUT_LEN];
+static uint32_t TEST_ui32Length = 0;
+static uint32_t TEST_ui32Lines = 0;
+static uint32_t TEST_ui32Longest = 0;
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidPut(const char *a_ptrText)
+{
+    uint32_t ui32Length = (uint32_t)strlen(a_ptrText);
+
+    TEST_ui32Lines++;
+    if (ui32Length > TEST_ui32Longest) {
+        TEST_ui32Longest = ui32Length;
+    }
+    if ((TEST_ui32Length + ui32Length) < TEST_OUTPUT_LEN) {
+        memcpy(&TEST_chOutput[TEST_ui32Length], a_ptrText, ui32Length + 1U);
+        TEST_ui32Length += ui32Length;
+    }
+}
+
+static void TEST_voidExport(void)
+{
+    uint32_t ui32Steps = 0;
+
+    TEST_ui32Length = 0;
+    TEST_ui32Lines = 0;
+    TEST_ui32Longest = 0;
+    TEST_chOutput[0] = '\0';
+    OS_voidTraceExportBegin(TEST_voidPut);
+    while (OS_boolTraceExportStep() && (ui32Steps < 1000U)) {
+        ui32Steps++;
+    }
+}
+
+// "ts" of the last event line of the output, in microseconds
+static double TEST_dLastTimestamp(void)
+{
+    const char *ptrLast = NULL;
+    const char *ptrFound = TEST_chOutput;
+
+    while ((ptrFound = strstr(ptrFound, "\"ts\":")) != NULL) {
+        ptrLast = ptrFound;
+        ptrFound++;
+    }
+    return (ptrLast != NULL) ? strtod(ptrLast + 5, NULL) : -1.0;
+}
+
+static void TEST_voidRing(void)
+{
+    uint32_t i = 0;
+    uint32_t ui32Cost = 0;
+    double dExpected = 0;
+
+    OS_CYCLE_COUNTER_INIT();
+    IntMasterEnable();
+    OS_voidTraceStart();
+    ui32Cost = OS_ui32TraceCostCycles();
+    for (i = 0; i < TEST_EVENTS; i++) {
+        OS_voidTraceRecord(OS_TRACE_CAN_RX, 17U, (uint16_t)(0x100U + i));
+        FAKE_voidSpend(TEST_GAP_CYCLES);
+    }
+    TEST_voidExport();
+
+    // The oldest 72 were overwritten: the first exported event is the 73rd
+    UNIT_CHECK(strstr(TEST_chOutput, "\"lost\":72") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "RX 0x147 obj 17") == NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "RX 0x148 obj 17") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "RX 0x1C7 obj 17") != NULL);
+
+    // 128 events 10 us and one recording apart, from ts 0
+    UNIT_CHECK(strstr(TEST_chOutput, "\"ts\":0.000}") != NULL);
+    dExpected = (double)(OS_TRACE_EVENTS - 1U) * (double)(TEST_GAP_CYCLES + ui32Cost) / (FAKE_CPU_HZ / 1e6);
+    UNIT_CHECK(abs((int)(TEST_dLastTimestamp() - dExpected)) <= 1);
+}
+
+static void TEST_voidJson(void)
+{
+    OS_voidTraceStart();
+    OS_voidTraceRecord(OS_TRACE_TASK_START, 2U, 0U);
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_CAN, 0U);
+    OS_voidTraceRecord(OS_TRACE_ISR_EXIT, OS_TRACE_ISR_CAN, 0U);
+    OS_voidTraceRecord(OS_TRACE_CAN_TX, 5U, 0x7FFU);
+    OS_voidTraceRecord(OS_TRACE_STATE, OS_TRACE_STATE_UART, 3U);
+    OS_voidTraceRecord(OS_TRACE_TASK_END, 2U, 0U);
+    OS_voidTraceRecord(OS_TRACE_ISR_ENTER, OS_TRACE_ISR_COUNT, 0U);        // Unknown source: skipped
+    TEST_voidExport();
+
+    UNIT_CHECK_EQ(TEST_ui32Lines, TEST_HEADER_LINES + 6U + 1U);
+    UNIT_CHECK(TEST_ui32Longest < OS_TRACE_LINE_LEN);
+    UNIT_CHECK(strncmp(TEST_chOutput, "{\"otherData\":{", 14) == 0);
+    UNIT_CHECK(strstr(TEST_chOutput, "\"lost\":0}") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "{\"name\":\"P3\",\"ph\":\"B\"") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "{\"name\":\"P3\",\"ph\":\"E\"") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "{\"name\":\"CAN\",\"ph\":\"B\"") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "{\"name\":\"TX 0x7FF\"") != NULL);
+    UNIT_CHECK(strstr(TEST_chOutput, "{\"name\":\"UartState\",\"ph\":\"C\",\"args\":{\"value\":3}") != NULL);
+    UNIT_CHECK_EQ(strcmp(&TEST_chOutput[TEST_ui32Length - 4U], "]}\r\n"), 0);
+
+    // Recording again, empty
+    OS_voidTraceRecord(OS_TRACE_TASK_START, 0U, 0U);
+    TEST_voidExport();
+    UNIT_CHECK_EQ(TEST_ui32Lines, TEST_HEADER_LINES + 1U + 1U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidRing);
+    UNIT_RUN(TEST_voidJson);
+    return UNIT_intReport("test_trace");
+}
@@ -0,0 +1,181 @@
+/*
+ * test_wdgm.c
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: Host tests of OS/wdgm.c on the fake MCU and its watchdog: a task that keeps running keeps the
+ *               watchdog serviced; a task that stops is found at the end of its supervision window, its record is
+ *               written to EEPROM by the deferred job, the watchdog resets within 3 windows, and the record is handed
+ *               over and erased at the next start-up. A deferred post refused by a full queue is retried.
+ */
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <string.h>
+#include "unit.h"
+#include "fake.h"
+#include "OS/wdgm.h"
+#include "OS/OS_config.h"
+#include "OS/timebase.h"
+#include "MCAL/NVM/NVM.h"
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define TEST_TICK_CYCLES        50000U  // 1 ms at 50 MHz
+
+#define TEST_TASK_TABLE(X) \
+    X(TEST_voidTask, 10U, 0U, 1U, 0U, 5U)
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+static bool TEST_boolHung = false;              // The task no longer completes
+static uint32_t TEST_ui32Now = 0;
+static void (*TEST_ptrJob)(void) = NULL;        // Last job posted
+static uint32_t TEST_ui32Posts = 0;
+static uint32_t TEST_ui32Refuse = 0;            // Posts still to refuse
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+static void TEST_voidTask(void)
+{
+}
+
+static const TaskConfig TEST_stTable[] = {
+    TEST_TASK_TABLE(OS_TASK_ENTRY)
+};
+static TaskControlBlock TEST_stTasks[OS_TASK_TABLE_COUNT(TEST_TASK_TABLE)];
+
+// SysTick and deferred-job ports of the watchdog manager
+uint32_t SYSTICK_ui32TickCycles(void)
+{
+    return TEST_TICK_CYCLES;
+}
+
+bool OS_boolDeferredPost(void (*a_ptrJob)(void))
+{
+    TEST_ui32Posts++;
+    if (TEST_ui32Refuse > 0U) {
+        TEST_ui32Refuse--;
+        return false;
+    }
+    TEST_ptrJob = a_ptrJob;
+    return true;
+}
+
+static void TEST_voidStartUp(void)
+{
+    TEST_boolHung = false;
+    TEST_ptrJob = NULL;
+    TEST_ui32Posts = 0;
+    TEST_ui32Now = 0;
+    UNIT_ui32Resets = 0;
+    OS_voidDispatcherInit(TEST_stTable, TEST_stTasks, OS_TASK_TABLE_COUNT(TEST_TASK_TABLE), 0U);
+    OS_voidWdgMInit(TEST_stTasks, 0U);
+}
+
+// One SysTick period: the interrupt part, then the dispatcher unless the task hangs
+static void TEST_voidTicks(uint32_t a_ui32Ticks)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < a_ui32Ticks; i++) {
+        FAKE_voidSpend(TEST_TICK_CYCLES);
+        TEST_ui32Now++;
+        OS_voidDispatcherTick(TEST_ui32Now);
+        OS_voidWdgMTick(TEST_ui32Now);
+        if (!TEST_boolHung) {
+            OS_voidDispatch();
+        }
+    }
+}
+
+static void TEST_voidServiced(void)
+{
+    WdgMRecord stRecord;
+
+    OS_voidTimeBaseInit();
+    TEST_voidStartUp();
+    UNIT_CHECK(!OS_boolWdgMLastReset(&stRecord));
+    UNIT_CHECK_EQ(stRecord.priority, OS_WDGM_NO_RECORD);
+
+    TEST_voidTicks(10U * OS_WDGM_WINDOW_TICKS);
+    UNIT_CHECK_EQ(UNIT_ui32Resets, 0U);
+    UNIT_CHECK_EQ(TEST_ui32Posts, 0U);
+}
+
+static void TEST_voidStuckTask(void)
+{
+    WdgMRecord stRecord;
+    uint32_t ui32Hang = 0;
+    uint32_t ui32Detected = 0;
+    uint32_t ui32Reset = 0;
+
+    TEST_voidStartUp();
+    TEST_voidTicks(OS_WDGM_WINDOW_TICKS + 500U);
+    TEST_boolHung = true;
+    ui32Hang = TEST_ui32Now;
+
+    // Detected at the end of the window after the one it last completed in
+    while ((TEST_ui32Posts == 0U) && (TEST_ui32Now < (ui32Hang + (3U * OS_WDGM_WINDOW_TICKS)))) {
+        TEST_voidTicks(1U);
+    }
+    ui32Detected = TEST_ui32Now;
+    UNIT_CHECK_EQ(ui32Detected, 3U * OS_WDGM_WINDOW_TICKS);
+    UNIT_CHECK(TEST_ptrJob != NULL);
+    UNIT_CHECK_EQ(UNIT_ui32Resets, 0U);
+
+    // The job runs in PendSV, the hung task does not keep it from the EEPROM
+    TEST_ptrJob();
+    memcpy(&stRecord, FAKE_pui8Eeprom() + EEPROM_WDGM_RECORD_ADDR, sizeof(stRecord));
+    UNIT_CHECK_EQ(stRecord.priority, 1U);
+    UNIT_CHECK(stRecord.stuckTicks >= (ui32Detected - ui32Hang));
+    UNIT_CHECK(stRecord.stuckTicks <= (ui32Detected - ui32Hang + 10U));
+    UNIT_CHECK(stRecord.detectedUs >= ((uint64_t)ui32Detected * 1000U));
+
+    // The watchdog is no longer serviced: reset within 3 windows of the detection
+    while ((UNIT_ui32Resets == 0U) && (TEST_ui32Now < (ui32Detected + (4U * OS_WDGM_WINDOW_TICKS)))) {
+        TEST_voidTicks(1U);
+    }
+    ui32Reset = TEST_ui32Now;
+    UNIT_CHECK_EQ(UNIT_ui32Resets, 1U);
+    UNIT_CHECK(ui32Reset <= (ui32Detected + (3U * OS_WDGM_WINDOW_TICKS)));
+    UNIT_CHECK_EQ(TEST_ui32Posts, 1U);
+
+    // Next start-up: the record is handed over and erased
+    TEST_voidStartUp();
+    UNIT_CHECK(OS_boolWdgMLastReset(&stRecord));
+    UNIT_CHECK_EQ(stRecord.priority, 1U);
+    memcpy(&stRecord, FAKE_pui8Eeprom() + EEPROM_WDGM_RECORD_ADDR, sizeof(stRecord));
+    UNIT_CHECK_EQ(stRecord.priority, OS_WDGM_NO_RECORD);
+}
+
+static void TEST_voidPostRetried(void)
+{
+    TEST_voidStartUp();
+    TEST_boolHung = true;
+    TEST_ui32Refuse = 2U;
+    TEST_voidTicks(OS_WDGM_WINDOW_TICKS + 1U);
+    UNIT_CHECK(TEST_ptrJob == NULL);
+    UNIT_CHECK_EQ(TEST_ui32Posts, 2U);
+    TEST_voidTicks(1U);
+    UNIT_CHECK(TEST_ptrJob != NULL);
+    TEST_voidTicks(10U);
+    UNIT_CHECK_EQ(TEST_ui32Posts, 3U);
+}
+
+int main(void)
+{
+    UNIT_RUN(TEST_voidServiced);
+    UNIT_RUN(TEST_voidStuckTask);
+    UNIT_RUN(TEST_voidPostRetried);
+    return UNIT_intReport("test_wdgm");
+}
@@ -0,0 +1,62 @@
+/*
+ * unit.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Checks and the test runner shared by the host unit tests: a failed check prints its location and
+ *                  the test goes on, and the program exits non-zero if any check failed.
+ *               2) The board the unit tests run the fake MCU on (board.c): time jumps straight to the next event,
+ *                  CAN requests and UART output are recorded, and the ADC returns UNIT_ui32AdcSample.
+ *
+ *      Usage rules:
+ *               - One test program per module; main() calls UNIT_RUN for each test function, then returns
+ *                 UNIT_intReport().
+ */
+
+#ifndef UNIT_H_
+#define UNIT_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+
+/***********************************************
+ * Definitions and Macros
+ ***********************************************/
+#define UNIT_UART_CAPTURE       4096U   // Characters of UART output kept by the board
+
+#define UNIT_CHECK(cond)        UNIT_voidCheck((cond), __FILE__, __LINE__, #cond)
+#define UNIT_CHECK_EQ(a, b)     UNIT_voidCheckEqual((uint64_t)(a), (uint64_t)(b), __FILE__, __LINE__, #a " == " #b)
+#define UNIT_RUN(test)          do { printf("  %s\n", #test); test(); } while (0)
+
+
+/***********************************************
+ * Global and Static Variables
+ ***********************************************/
+extern uint32_t UNIT_ui32Checks;
+extern uint32_t UNIT_ui32Failures;
+
+// Board state
+extern uint32_t UNIT_ui32CanRequests;           // BOARD_voidCanRequest calls
+extern char UNIT_chUart[UNIT_UART_CAPTURE];     // UART output, terminated
+extern uint32_t UNIT_ui32UartLength;
+extern uint32_t UNIT_ui32AdcSample;             // Returned for every channel
+extern uint32_t UNIT_ui32Resets;                // BOARD_voidReset calls
+extern const char *UNIT_ptrResetCause;          // Cause of the last one
+
+
+/***********************************************
+ * Functions Prototypes
+ ***********************************************/
+void UNIT_voidCheck(bool a_boolPassed, const char *a_ptrFile, int a_intLine, const char *a_ptrText);
+void UNIT_voidCheckEqual(uint64_t a_ui64Actual, uint64_t a_ui64Expected, const char *a_ptrFile, int a_intLine,
+                         const char *a_ptrText);
+int UNIT_intReport(const char *a_ptrName);
+void UNIT_voidUartClear(void);
+
+#endif /* UNIT_H_ */
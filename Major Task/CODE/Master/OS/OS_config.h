@@ -24,16 +24,47 @@ typedef enum {
     TASK_RUNNING
 } TaskState;
 
+// Static description of a task, generated into a const table (flash)
 typedef struct {
     void (*taskFunction)(void);
     uint32_t periodTicks;
+    uint8_t priority;            // 1 = highest, equals table index + 1
+} TaskConfig;
+
+// Run-time state of a task (RAM), same index as its TaskConfig entry
+typedef struct {
     uint32_t lastRunTick;
-    uint8_t priority;
     TaskState state;
     uint8_t isEnabled;           // Task enabled/disabled
 } TaskControlBlock;
 
 #define MAX_TASKS 10U
-TaskControlBlock taskList[MAX_TASKS];
+#define OS_SCHEDULER_PERIOD_TICKS 50U   // Ticks between scheduler runs from the main loop
+
+// Compile-time check, usable at file scope
+#define OS_STATIC_ASSERT(cond, name)        typedef char name[(cond) ? 1 : -1]
+
+/**
+ * Task table: X(function, periodTicks, priority)
+ *      priority   // 1 = highest, unique and contiguous from 1
+ *
+ *      Each entry is placed at index priority - 1 by a designated initializer, so the table is sorted by the
+ *      compiler and kept in flash; only the run-time state (taskList) is in RAM.
+ */
+#define OS_TASK_TABLE(X) \
+    X(OS_voidCanSend,                   100U, 1U)   /* Send CAN messages */ \
+    X(APP_ui32CheckButtons,             100U, 2U)   /* Check button states */ \
+    X(APP_voidStateControl,             100U, 3U)   /* Control the state */ \
+    X(OS_voidCANReceiveMessage,         100U, 4U)   /* Receive CAN messages */ \
+    X(APP_voidUartControl,              100U, 5U)   /* Control UART */ \
+    X(OS_voidCheckCANCommunication,     100U, 6U)   /* Check CAN communication status */ \
+    X(APP_voidCheckCommunication,       100U, 7U)   /* Check overall communication */ \
+    X(OS_voidCheckIdle,                 100U, 8U)   /* Check idle state */
+
+#define OS_TASK_ENTRY(fn, period, prio)         [(prio) - 1U] = {(fn), (period), (prio)},
+#define OS_TASK_COUNT_ONE(fn, period, prio)     + 1U
+#define OS_TASK_PRIO_BIT(fn, period, prio)      | (1UL << ((prio) - 1U))
+#define OS_TASK_COUNT                           (0U OS_TASK_TABLE(OS_TASK_COUNT_ONE))
+#define OS_TASK_PRIOS                           (0UL OS_TASK_TABLE(OS_TASK_PRIO_BIT))
 
-#endif /* CAN_CONFIG_H_ */
+#endif /* OS_CONFIG_H_ */
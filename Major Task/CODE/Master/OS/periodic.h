@@ -0,0 +1,109 @@
+/*
+ * periodic.h
+ *
+ *  Created on: 17 Oct 2026
+ *      Author: Team: 4
+ *      purpose: 1) Provide deadline-based periodic events on the system tick, to replace "tick % period == 0" gating,
+ *                  which drops the event whenever the caller does not happen to run on that exact tick.
+ *               2) Keep the deadlines on the raster now + k * period, so the events do not drift with the latency of
+ *                  the caller, and let the caller choose what happens to deadlines it was too late for:
+ *                  - catch-up: one occurrence per call until every missed deadline has been delivered;
+ *                  - skip: a single occurrence that reports how many deadlines it stands for.
+ *
+ *      Usage rules:
+ *               - The deadline is a uint32_t owned by the caller, set once with OS_voidPeriodicStart.
+ *               - Comparisons are made by signed difference, so the deadline stays valid across the 2^32 tick wrap
+ *                 as long as the caller polls at least once every 2^31 ticks.
+ *               - The period must not be 0.
+ */
+
+#ifndef PERIODIC_H_
+#define PERIODIC_H_
+
+
+/***********************************************
+ * Includes
+ ***********************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/***********************************************
+ * Functions Definitions
+ ***********************************************/
+
+/***********************************************
+ * Function Name: OS_voidPeriodicStart
+ * Inputs: uint32_t *a_ptrDeadline - Deadline of the event
+ *         uint32_t a_ui32Period - Period in ticks
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: N/A
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Places the first deadline one period after now.
+ ***********************************************/
+static inline void OS_voidPeriodicStart(uint32_t *a_ptrDeadline, uint32_t a_ui32Period, uint32_t a_ui32Now)
+{
+    *a_ptrDeadline = a_ui32Now + a_ui32Period;
+}
+
+/***********************************************
+ * Function Name: OS_boolPeriodicIsDue
+ * Inputs: uint32_t a_ui32Deadline - Deadline of the event
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: bool - true once now has reached the deadline
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Does not consume the deadline.
+ ***********************************************/
+static inline bool OS_boolPeriodicIsDue(uint32_t a_ui32Deadline, uint32_t a_ui32Now)
+{
+    return ((int32_t)(a_ui32Now - a_ui32Deadline) >= 0);
+}
+
+/***********************************************
+ * Function Name: OS_boolPeriodicCatchUp
+ * Inputs: uint32_t *a_ptrDeadline - Deadline of the event
+ *         uint32_t a_ui32Period - Period in ticks
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: bool - true if the event occurs on this call
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Catch-up policy. Moves the deadline on by a single period per occurrence, so a caller that was late
+ *              by n periods gets the n missed occurrences on its next n calls. For counted events (keep-alive frames,
+ *              integrators) where every occurrence matters.
+ ***********************************************/
+static inline bool OS_boolPeriodicCatchUp(uint32_t *a_ptrDeadline, uint32_t a_ui32Period, uint32_t a_ui32Now)
+{
+    if (!OS_boolPeriodicIsDue(*a_ptrDeadline, a_ui32Now)) {
+        return false;
+    }
+    *a_ptrDeadline += a_ui32Period;
+    return true;
+}
+
+/***********************************************
+ * Function Name: OS_ui32PeriodicSkip
+ * Inputs: uint32_t *a_ptrDeadline - Deadline of the event
+ *         uint32_t a_ui32Period - Period in ticks
+ *         uint32_t a_ui32Now - Current tick
+ * Outputs: uint32_t - Deadlines reached since the previous occurrence, 0 if the event is not due
+ * Reentrancy: Reentrant
+ * Synchronous: Synch
+ * Description: Skip policy. Moves the deadline onto the first raster point after now, so a late caller gets one
+ *              occurrence; a result above 1 counts the deadlines merged into it. For state refreshes (scheduling,
+ *              supervision windows, reports) where only the latest occurrence matters.
+ ***********************************************/
+static inline uint32_t OS_ui32PeriodicSkip(uint32_t *a_ptrDeadline, uint32_t a_ui32Period, uint32_t a_ui32Now)
+{
+    uint32_t ui32Reached = 0;
+
+    if (!OS_boolPeriodicIsDue(*a_ptrDeadline, a_ui32Now)) {
+        return 0;
+    }
+    ui32Reached = 1U + ((a_ui32Now - *a_ptrDeadline) / a_ui32Period);
+    *a_ptrDeadline += ui32Reached * a_ui32Period;
+    return ui32Reached;
+}
+
+#endif /* PERIODIC_H_ */
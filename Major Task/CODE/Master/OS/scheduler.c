@@ -12,20 +12,20 @@
  * Includes
  ***********************************************/
 #include <OS/scheduler.h>
+#include <OS/periodic.h>
 
 /***********************************************
  * Global and Static Variables
  ***********************************************/
 uint32_t APP_ui32UartCurrentState = 0x16;
 uint8_t APP_ui32counter = 0;
-uint8_t ui8taskCount = 0;
 uint32_t APP_ui32idleCounter = 0;
 uint32_t APP_ui32holdButton1count = 0;
 uint32_t APP_ui32holdButton2count = 0;
 uint32_t OS_ui32CurrentError = 0;
 uint32_t OS_ui32PrevError = 0x12;
 uint32_t OS_ui32index = 0;
-uint32_t OS_ui32time = 100;
+uint32_t OS_ui32SchedulerDeadline = 0;  // Tick of the next scheduler run
 
 
 static uint8_t APP_ui8PrevState = 0;
@@ -35,6 +35,16 @@ bool APP_boollast_sw2_state = false;
 bool OS_boolidleFlag = false;
 bool APP_boolStateInit = false;
 bool APP_boolUnidentifiedFlag = false;
+
+// Task table generated from OS_TASK_TABLE: const (flash) and sorted by priority, run-time state in taskList
+OS_STATIC_ASSERT(OS_TASK_COUNT <= MAX_TASKS, OS_assertTaskCountFitsMaxTasks);
+OS_STATIC_ASSERT(OS_TASK_COUNT < 32U, OS_assertTaskCountFitsPriorityMask);
+OS_STATIC_ASSERT(OS_TASK_PRIOS == ((1UL << OS_TASK_COUNT) - 1UL), OS_assertTaskPrioritiesUniqueFromOne);
+
+const TaskConfig OS_stTaskTable[OS_TASK_COUNT] = {
+    OS_TASK_TABLE(OS_TASK_ENTRY)
+};
+TaskControlBlock taskList[OS_TASK_COUNT];
 /***********************************************
  * Functions Definitions
  ***********************************************/
@@ -74,7 +84,8 @@ void SYSTICK_handler(void) {
  *              It ensures that the initialization of the OS occurs only once
  *              and periodically calls the `APP_voidScheduler` function based
  *              on the system tick count. The scheduler is executed every 50
- *              milliseconds.
+ *              milliseconds, on a deadline rather than on the exact tick, so a
+ *              loop pass that is late does not lose the run.
  ***********************************************/
 void APP_voidOS(void) {
     // Static variable to track if initialization has been performed
@@ -84,17 +95,18 @@ void APP_voidOS(void) {
     if (!initFlag) {
         OS_voidInit();  // Initialize the OS
         OS_voidInitTasks();
+        OS_voidPeriodicStart(&OS_ui32SchedulerDeadline, OS_SCHEDULER_PERIOD_TICKS, g_ui32SysTickCount);
         initFlag = true; // Mark initialization as complete
     } else {
         // No action required after initialization
     }
 
-    // Check if 50 milliseconds have passed based on the system tick
-    if (g_ui32SysTickCount % (uint32_t)50 == 0x00U) {
+    // Check if the 50 millisecond deadline has been reached; runs missed by a late pass are merged into one
+    if (OS_ui32PeriodicSkip(&OS_ui32SchedulerDeadline, OS_SCHEDULER_PERIOD_TICKS, g_ui32SysTickCount) != 0x00U) {
         //APP_voidScheduler(); // Call the scheduler function
         OS_voidSchedulerr();
     } else {
-        // No action required if not a multiple of 50 ms
+        // No action required before the deadline
     }
 }
 
@@ -189,77 +201,6 @@ void APP_voidScheduler(void)
     OS_voidSchedulerr();
 }
 
-/***********************************************
- * Function Name: OS_voidAddTask
- * Inputs:
- *  - taskFunction: Pointer to the task function to be added
- *  - periodTicks: Periodicity of the task in ticks
- *  - priority: Priority of the task (lower value indicates higher priority)
- * Outputs: N/A
- * Reentrancy: Non-Reentrant
- * Synchronous: Synch
- * Description: Adds a new task to the task list with the specified function, periodicity,
- *              and priority. Initializes task parameters like last run tick, state,
- *              and enables the task by default.
- ***********************************************/
-
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority) {
-    // Check if there is space for more tasks in the task list
-    if (ui8taskCount < MAX_TASKS) {
-        // Assign the task function to the corresponding slot in the task list
-        taskList[ui8taskCount].taskFunction = taskFunction;
-
-        // Set the task's periodicity (in ticks)
-        taskList[ui8taskCount].periodTicks = periodTicks;
-
-        // Initialize the last run tick to 0
-        taskList[ui8taskCount].lastRunTick = 0x00U;
-
-        // Set the task's priority
-        taskList[ui8taskCount].priority = priority;
-
-        // Enable the task by default
-        taskList[ui8taskCount].isEnabled = 0x01U;
-
-        // Set the task's initial state to READY
-        taskList[ui8taskCount].state = TASK_READY;
-
-        // Increment the task count to reflect the addition of a new task
-        ui8taskCount++;
-    }
-}
-
-/***********************************************
- * Function Name: OS_voidSortTasksByPriority
- * Inputs: N/A
- * Outputs: N/A
- * Reentrancy: Non-Reentrant
- * Synchronous: Synchronous
- * Description: Sorts the tasks in the task list based on their priority in ascending order.
- *              Lower priority values are considered higher priority tasks.
- ***********************************************/
-
-void OS_voidSortTasksByPriority(void) {
-    uint8_t i = 0;
-    uint8_t j = 0;
-
-    // Loop through each task in the task list
-    for (i = 0; i < ui8taskCount - 1; i++) {
-        // Compare with each subsequent task to find the lowest priority task
-        for (j = i + 1; j < ui8taskCount; j++) {
-            // If the current task's priority is higher than the next task's priority, swap them
-            if (taskList[i].priority > taskList[j].priority) {
-                // Temporary variable to store the task being swapped
-                TaskControlBlock temp = taskList[i];
-
-                // Swap the two tasks in the list
-                taskList[i] = taskList[j];
-                taskList[j] = temp;
-            }
-        }
-    }
-}
-
 /***********************************************
  * Function Name: OS_voidSchedulerr
  * Inputs: N/A
@@ -268,40 +209,34 @@ void OS_voidSortTasksByPriority(void) {
  * Synchronous: Synchronous
  * Description: This function is responsible for selecting and executing the highest-priority
  *              task from the task list based on the current system tick and task readiness.
+ *              The task table is sorted by priority, so the first due task is the one to run.
  ***********************************************/
 
 void OS_voidSchedulerr(void) {
     uint32_t currentTick = g_ui32SysTickCount;  // Get the current system tick count
-    uint8_t highestPriorityIndex = MAX_TASKS;   // Initialize index for highest priority task
+    uint8_t highestPriorityIndex = OS_TASK_COUNT;   // Initialize index for highest priority task
     uint8_t i = 0;  // Loop variable
 
-    // Conditions to check if the task is enabled, ready, and if priority conditions are met
-    bool check_en = (taskList[i].isEnabled);
-    bool check_task = (taskList[i].state == TASK_READY);
-    bool check_priority = (highestPriorityIndex == MAX_TASKS);
-    bool list = (taskList[i].priority < taskList[highestPriorityIndex].priority);
-
-    // Loop through all tasks to find the task with the highest priority
-    for (i = 0; i < ui8taskCount; i++) {
-        // Check if the task is enabled and ready to run
-        if (check_en && check_task) {
-            // Check if enough time has passed to run the task based on its period
-            if ((currentTick - taskList[i].lastRunTick) >= taskList[i].periodTicks) {
-                // If it's the first task or the current task has a higher priority, update the highestPriorityIndex
-                if (check_priority || list) {
-                    highestPriorityIndex = i;
-                }
-            }
+    // Loop through the tasks in priority order and stop at the first one that is due
+    for (i = 0; i < OS_TASK_COUNT; i++) {
+        // Conditions to check if the task is enabled and ready
+        bool check_en = (taskList[i].isEnabled);
+        bool check_task = (taskList[i].state == TASK_READY);
+
+        // Check if enough time has passed to run the task based on its period
+        if (check_en && check_task && ((currentTick - taskList[i].lastRunTick) >= OS_stTaskTable[i].periodTicks)) {
+            highestPriorityIndex = i;
+            break;
         }
     }
 
     // Execute the highest-priority task if one is found
-    if (highestPriorityIndex < MAX_TASKS) {
+    if (highestPriorityIndex < OS_TASK_COUNT) {
         // Mark the task as running
         taskList[highestPriorityIndex].state = TASK_RUNNING;
 
         // Execute the task's function
-        taskList[highestPriorityIndex].taskFunction();
+        OS_stTaskTable[highestPriorityIndex].taskFunction();
 
         // Update the last run tick for the task
         taskList[highestPriorityIndex].lastRunTick = currentTick;
@@ -312,9 +247,6 @@ void OS_voidSchedulerr(void) {
         // If no tasks are ready, the idle task can be run (not implemented here)
         // OS_IdleTask();
     }
-
-    // Optionally, if no tasks are ready, the idle task can be run
-    // OS_IdleTask();
 }
 
 /***********************************************
@@ -323,24 +255,24 @@ void OS_voidSchedulerr(void) {
  * Outputs: N/A
  * Reentrancy: Non-Reentrant
  * Synchronous: Synchronous
- * Description: This function initializes the tasks by adding them to the task list
- *              with their respective functions, periods, and priorities.
- *              It then sorts the tasks based on their priorities.
+ * Description: This function initializes the run-time state of the tasks listed in the
+ *              const task table. The table is generated from OS_TASK_TABLE and already
+ *              sorted by priority, so nothing is built or sorted at startup.
  ***********************************************/
 
 void OS_voidInitTasks(void) {
-    // Add tasks to the task list with the respective function, period, and priority
-    OS_voidAddTask(&OS_voidCanSend, OS_ui32time, (uint8_t)1);           // Task to send CAN messages
-    OS_voidAddTask(&APP_ui32CheckButtons, OS_ui32time, (uint8_t)2);      // Task to check button states
-    OS_voidAddTask(&APP_voidStateControl, OS_ui32time, (uint8_t)3);      // Task to control the state
-    OS_voidAddTask(&OS_voidCANReceiveMessage, OS_ui32time, (uint8_t)4);  // Task to receive CAN messages
-    OS_voidAddTask(&APP_voidUartControl, OS_ui32time, (uint8_t)5);       // Task to control UART
-    OS_voidAddTask(&OS_voidCheckCANCommunication, OS_ui32time, (uint8_t)6);  // Task to check CAN communication status
-    OS_voidAddTask(&APP_voidCheckCommunication, OS_ui32time, (uint8_t)7);  // Task to check overall communication
-    OS_voidAddTask(&OS_voidCheckIdle, OS_ui32time, (uint8_t)8);          // Task to check idle state
-
-    // Sort the tasks based on their priorities
-    OS_voidSortTasksByPriority();
+    uint8_t i = 0;
+
+    for (i = 0; i < OS_TASK_COUNT; i++) {
+        // Initialize the last run tick to 0
+        taskList[i].lastRunTick = 0x00U;
+
+        // Enable the task by default
+        taskList[i].isEnabled = 0x01U;
+
+        // Set the task's initial state to READY
+        taskList[i].state = TASK_READY;
+    }
 }
 
 
@@ -83,8 +83,6 @@ void OS_voidInit(void);
 void OS_voidHALInit(void);
 void OS_voidMCALInit(void);
 void OS_voidCanSend(void);
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority);
-void OS_voidSortTasksByPriority(void);
 void OS_voidSchedulerr(void);
 void OS_voidInitTasks(void);
 void APP_voidStateControl(void);
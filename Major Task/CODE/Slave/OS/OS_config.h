@@ -45,25 +45,51 @@
 // Task Configuration (Define Task Functions)
 // =============================================
 
-// Task list (to be initialized in OS_Config.c)
-//extern TaskConfig taskList[];
-
 typedef enum {
     TASK_READY,
     TASK_WAITING,
     TASK_RUNNING
 } TaskState;
 
+// Static description of a task, generated into a const table (flash)
 typedef struct {
     void (*taskFunction)(void);
     uint32_t periodTicks;
+    uint8_t priority;            // 1 = highest, equals table index + 1
+} TaskConfig;
+
+// Run-time state of a task (RAM), same index as its TaskConfig entry
+typedef struct {
     uint32_t lastRunTick;
-    uint8_t priority;
     TaskState state;
     uint8_t isEnabled;           // Task enabled/disabled
 } TaskControlBlock;
 
 #define MAX_TASKS 0x10U
-TaskControlBlock taskList[MAX_TASKS];
+#define OS_SCHEDULER_PERIOD_TICKS 0x10U   // Ticks between scheduler runs from the main loop
+
+// Compile-time check, usable at file scope
+#define OS_STATIC_ASSERT(cond, name)        typedef char name[(cond) ? 1 : -1]
+
+/**
+ * Task table: X(function, periodTicks, priority)
+ *      priority   // 1 = highest, unique and contiguous from 1
+ *
+ *      Each entry is placed at index priority - 1 by a designated initializer, so the table is sorted by the
+ *      compiler and kept in flash; only the run-time state (taskList) is in RAM.
+ */
+#define OS_TASK_TABLE(X) \
+    X(CAN_ReceiveMessage,               100U, 1U)   /* Runs every 100ms */ \
+    X(OS_voidQueueControl,              200U, 2U)   /* Runs every 200ms */ \
+    X(OS_voidCheckErrors,               50U,  3U)   /* Runs every 50ms */ \
+    X(OS_voidCheckCANCommunication,     50U,  4U)   /* Runs every 50ms */ \
+    X(OS_voidCheckIdle,                 500U, 5U)   /* Runs every 500ms */ \
+    X(OS_voidStateControll,             500U, 6U)   /* Runs every 500ms */
+
+#define OS_TASK_ENTRY(fn, period, prio)         [(prio) - 1U] = {(fn), (period), (prio)},
+#define OS_TASK_COUNT_ONE(fn, period, prio)     + 1U
+#define OS_TASK_PRIO_BIT(fn, period, prio)      | (1UL << ((prio) - 1U))
+#define OS_TASK_COUNT                           (0U OS_TASK_TABLE(OS_TASK_COUNT_ONE))
+#define OS_TASK_PRIOS                           (0UL OS_TASK_TABLE(OS_TASK_PRIO_BIT))
 
-#endif /* CAN_CONFIG_H_ */
+#endif /* OS_CONFIG_H_ */
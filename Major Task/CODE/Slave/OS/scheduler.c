@@ -18,6 +18,7 @@
  * Includes
  ***********************************************/
 #include "scheduler.h"
+#include "periodic.h"
 //#include "HAL/Initialization.h"
 
 
@@ -36,16 +37,19 @@ uint32_t APP_uint32CurrentStateIndex =0;
 uint32_t APP_uint32checkcounter = 0;
 uint32_t APP_uint32i=0;
 uint32_t OS_delayCount=0;
+uint32_t OS_ui32SchedulerDeadline=0; // Tick of the next scheduler run
 
-uint32_t OS_ui32time1 = 100;
-uint32_t OS_ui32time2 = 200;
-uint32_t OS_ui32time3 = 50;
-uint32_t OS_ui32time4 = 500;
-
+uint8_t UNIDENTIFIED = 0x30;
 
+// Task table generated from OS_TASK_TABLE: const (flash) and sorted by priority, run-time state in taskList
+OS_STATIC_ASSERT(OS_TASK_COUNT <= MAX_TASKS, OS_assertTaskCountFitsMaxTasks);
+OS_STATIC_ASSERT(OS_TASK_COUNT < 32U, OS_assertTaskCountFitsPriorityMask);
+OS_STATIC_ASSERT(OS_TASK_PRIOS == ((1UL << OS_TASK_COUNT) - 1UL), OS_assertTaskPrioritiesUniqueFromOne);
 
-uint8_t UNIDENTIFIED = 0x30;
-uint8_t ui8taskCount = 0;
+const TaskConfig OS_stTaskTable[OS_TASK_COUNT] = {
+    OS_TASK_TABLE(OS_TASK_ENTRY)
+};
+TaskControlBlock taskList[OS_TASK_COUNT];
 
 
 /***********************************************
@@ -150,78 +154,46 @@ void OS_voidCheckUnidentified(void)
 
 }
 
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority) {
-
-    bool check_list = (ui8taskCount < MAX_TASKS);
-    if (check_list) {
-        taskList[ui8taskCount].taskFunction = taskFunction;
-        taskList[ui8taskCount].periodTicks = periodTicks;
-        taskList[ui8taskCount].lastRunTick = 0x00U;  // Initialize last run to 0
-        taskList[ui8taskCount].priority = priority;
-        taskList[ui8taskCount].isEnabled = 0x01U;    // Enable by default
-        taskList[ui8taskCount].state = TASK_READY; // Set state to READY
-        ui8taskCount++;
-    }
-}
-
-void OS_voidSortTasksByPriority(void) {
-    uint8_t i = 0;
-    uint8_t j = 0;
-    for (i = 0; i < ui8taskCount - 1; i++) {
-        for (j = i + 1; j < ui8taskCount; j++) {
-            if (taskList[i].priority > taskList[j].priority) {
-                TaskControlBlock temp = taskList[i];
-                taskList[i] = taskList[j];
-                taskList[j] = temp;
-            }
-        }
-    }
-}
-
 void OS_voidSchedulerr(void) {
     uint32_t currentTick = g_ui32SysTickCount;
-    uint8_t highestPriorityIndex = MAX_TASKS;
+    uint8_t highestPriorityIndex = OS_TASK_COUNT;
     uint8_t i = 0;
 
-    bool check_en = (taskList[i].isEnabled);
-    bool check_task = (taskList[i].state == TASK_READY);
-    bool check_priority = (highestPriorityIndex == MAX_TASKS);
-    bool list =(taskList[i].priority < taskList[highestPriorityIndex].priority);
-    for ( i = 0; i < ui8taskCount; i++) {
+    // The table is sorted by priority: the first due task is the highest priority one
+    for ( i = 0; i < OS_TASK_COUNT; i++) {
+        bool check_en = (taskList[i].isEnabled);
+        bool check_task = (taskList[i].state == TASK_READY);
         if (check_en && check_task) {
             // Check if the task is ready to run
-            if ((currentTick - taskList[i].lastRunTick) >= taskList[i].periodTicks) {
-                if (check_priority || list) {
-                    highestPriorityIndex = i;
-                }
+            if ((currentTick - taskList[i].lastRunTick) >= OS_stTaskTable[i].periodTicks) {
+                highestPriorityIndex = i;
+                break;
             }
         }
     }
 
     // Execute the highest-priority task, if any
+    bool check_priority = (highestPriorityIndex < OS_TASK_COUNT);
     if (check_priority) {
         taskList[highestPriorityIndex].state = TASK_RUNNING;
-        taskList[highestPriorityIndex].taskFunction();
+        OS_stTaskTable[highestPriorityIndex].taskFunction();
         taskList[highestPriorityIndex].lastRunTick = currentTick;
         taskList[highestPriorityIndex].state = TASK_READY;
     } else {
         // Run idle task if no tasks are ready
         //OS_IdleTask();
     }
-
-    // If no tasks are ready, run the idle task
-    //OS_IdleTask();
 }
 
 void OS_voidInitTasks(void) {
-    OS_voidAddTask(&CAN_ReceiveMessage, OS_ui32time1, (uint8_t)1);     // Runs every 100ms
-    OS_voidAddTask(&OS_voidQueueControl, OS_ui32time2, (uint8_t)2);    // Runs every 200ms
-    OS_voidAddTask(&OS_voidCheckErrors, OS_ui32time3, (uint8_t)(uint8_t)3);           // Runs every 50ms
-    OS_voidAddTask(&OS_voidCheckCANCommunication, OS_ui32time3, (uint8_t)3); // Runs every 50ms
-    OS_voidAddTask(&OS_voidCheckIdle, OS_ui32time4, (uint8_t)4);        // Runs every 500ms
-    OS_voidAddTask(&OS_voidStateControll, OS_ui32time4, (uint8_t)5);           // Runs every 1000ms
-
-    OS_voidSortTasksByPriority();
+    uint8_t i = 0;
+
+    // The const table is already sorted; only the run-time state is initialised
+    for (i = 0; i < OS_TASK_COUNT; i++) {
+        taskList[i].lastRunTick = 0x00U;  // Initialize last run to 0
+        taskList[i].isEnabled = 0x01U;    // Enable by default
+        taskList[i].state = TASK_READY; // Set state to READY
+    }
 }
 
 void OS_voidStateControll(void)
@@ -349,11 +321,12 @@ void APP_voidOS(void)
     {
         OS_voidInit();
         OS_voidInitTasks();
+        OS_voidPeriodicStart(&OS_ui32SchedulerDeadline, OS_SCHEDULER_PERIOD_TICKS, g_ui32SysTickCount);
         initFlag = true;
 
     }else{}
 
-    bool systick_fire = (g_ui32SysTickCount%0x10U==0x00U);
+    bool systick_fire = (OS_ui32PeriodicSkip(&OS_ui32SchedulerDeadline, OS_SCHEDULER_PERIOD_TICKS, g_ui32SysTickCount)!=0x00U);
     if(systick_fire){
         Scheduler();
     }else{}
@@ -77,8 +77,6 @@ void OS_voidQueueControl(void);
 void OS_voidCheckUnidentified(void);
 void OS_voidCheckSlaveButtons(void);
 void OS_voidCheckErrors(void);
-void OS_voidAddTask(void (*taskFunction)(void), uint32_t periodTicks, uint8_t priority);
-void OS_voidSortTasksByPriority(void);
 void OS_voidSchedulerr(void);
 void OS_voidInitTasks(void);
 void APP_ui32CheckButtons(void);